@@ -0,0 +1,295 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                            Common Harness
+*
+* Filename : bench.c
+*********************************************************************************************************
+* Note(s)  : (1) Each Bench/bench_*.c provides BenchMain().  main() initializes the kernel and starts the
+*                control task, which calls BenchMain() and exits the process once it returns.  BenchMain()
+*                creates the kernel objects and the tasks of its bench itself.
+*
+*            (2) Build a bench together with this file, the kernel sources, a POSIX port, uC/CPU and an
+*                application os_cfg.h/os_cfg_app.h, e.g. those of Cfg/Template.  The header of each bench
+*                lists the configuration it needs.  The POSIX GNU port needs OS_CFG_DBG_EN, the POSIX
+*                ucontext port larger stacks for the kernel tasks:
+*
+*                    cc -O2 -I<cfg> -IBench -ISource -IPorts/POSIX/GNU -I<uC-CPU> -I<uC-LIB> -o bench_kernel
+*                        Bench/bench.c Bench/bench_kernel.c Source/os_*.c Ports/POSIX/GNU/os_cpu_c.c
+*                        <uC-CPU sources> <cfg>/os_app_hooks.c -lpthread
+*
+*            (3) Results are printed in CSV, in nanoseconds measured on the host's monotonic clock.  Benches
+*                timing a whole run keep the fastest of BENCH_RUN_QTY runs, see BenchRunBest(), to filter
+*                out the host's jitter.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <time.h>
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+OS_TCB                BenchCtrlTCB;
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_STK       BenchCtrlStk[BENCH_CTRL_STK_SIZE];
+
+static  int           BenchArgc;
+static  char        **BenchArgv;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  BenchCtrlTask (void  *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                                main()
+*********************************************************************************************************
+*/
+
+int  main (int     argc,
+           char  **argv)
+{
+    OS_ERR  err;
+
+
+    BenchArgc = argc;
+    BenchArgv = argv;
+
+    OSInit(&err);
+    BenchErrChk(err, "OSInit");
+
+    BenchTaskCreate(&BenchCtrlTCB,
+                     BenchCtrlTask,
+                     (void *)0,
+                     BENCH_TASK_CTRL_PRIO,
+                    &BenchCtrlStk[0],
+                     BENCH_CTRL_STK_SIZE);
+
+    OSStart(&err);
+
+    return (1);                                                 /* OSStart() never returns on success.                  */
+}
+
+
+/*
+*********************************************************************************************************
+*                                             CONTROL TASK
+*
+* Description: Runs the bench linked in, see Note #1.
+*********************************************************************************************************
+*/
+
+static  void  BenchCtrlTask (void  *p_arg)
+{
+    (void)p_arg;
+
+    BenchMain(BenchArgc, BenchArgv);
+
+    fflush(stdout);
+    exit(0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             CREATE A TASK
+*
+* Description: Creates a task of a bench, exiting the process on error.
+*
+* Arguments  : p_tcb        is a pointer to the task's TCB.
+*
+*              p_task       is a pointer to the task's code.
+*
+*              p_arg        is the argument passed to the task.
+*
+*              prio         is the task's priority.
+*
+*              p_stk        is a pointer to the base of the task's stack.
+*
+*              stk_size     is the size of the stack, in number of CPU_STK elements.
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+void  BenchTaskCreate (OS_TCB        *p_tcb,
+                       OS_TASK_PTR    p_task,
+                       void          *p_arg,
+                       OS_PRIO        prio,
+                       CPU_STK       *p_stk,
+                       CPU_STK_SIZE   stk_size)
+{
+    OS_ERR  err;
+
+
+    OSTaskCreate(p_tcb,
+                 "Bench",
+                 p_task,
+                 p_arg,
+                 prio,
+                 p_stk,
+                 stk_size / 10u,
+                 stk_size,
+                 0u,
+                 0u,
+                 0u,
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 &err);
+    BenchErrChk(err, "OSTaskCreate");
+}
+
+
+/*
+*********************************************************************************************************
+*                                            CHECK AN ERROR
+*
+* Description: Exits the process if a kernel service failed, naming the service.
+*
+* Arguments  : err          is the error code returned by the service.
+*
+*              p_what       is the name of the service.
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+void  BenchErrChk (OS_ERR       err,
+                   const char  *p_what)
+{
+    if (err != OS_ERR_NONE) {
+        printf("Error %u in %s()\r\n", (unsigned)err, p_what);
+        exit(1);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           TIME THE BEST RUN
+*
+* Description: Calls a run of a bench BENCH_RUN_QTY times and keeps the fastest, see Note #3.
+*
+* Arguments  : p_run        is the run to time.
+*
+*              p_arg        is the argument passed to the run.
+*
+* Returns    : The duration of the fastest run, in ns.
+*********************************************************************************************************
+*/
+
+CPU_INT64U  BenchRunBest (BENCH_RUN_FNCT   p_run,
+                          void            *p_arg)
+{
+    CPU_INT32U  run;
+    CPU_INT64U  ts_start;
+    CPU_INT64U  ts_delta;
+    CPU_INT64U  ts_best;
+
+
+    ts_best = 0u;
+    for (run = 0u; run < BENCH_RUN_QTY; run++) {
+        ts_start = BenchTimeGet();
+        p_run(p_arg);
+        ts_delta = BenchTimeGet() - ts_start;
+        if ((run == 0u) || (ts_delta < ts_best)) {
+            ts_best = ts_delta;
+        }
+    }
+
+    return (ts_best);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             GET THE TIME
+*
+* Description: Reads the host's monotonic clock.
+*
+* Arguments  : none
+*
+* Returns    : The time, in ns.
+*********************************************************************************************************
+*/
+
+CPU_INT64U  BenchTimeGet (void)
+{
+    struct  timespec  ts;
+
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((CPU_INT64U)ts.tv_sec * 1000000000u) + (CPU_INT64U)ts.tv_nsec);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          COMPARE TWO SAMPLES
+*
+* Description: qsort() comparison of two CPU_INT64U samples, in increasing order.
+*
+* Arguments  : p_a          is a pointer to the first sample.
+*
+*              p_b          is a pointer to the second sample.
+*
+* Returns    : < 0, 0 or > 0 if the first sample is smaller, equal or larger.
+*********************************************************************************************************
+*/
+
+int  BenchCmp (const  void  *p_a,
+               const  void  *p_b)
+{
+    CPU_INT64U  a;
+    CPU_INT64U  b;
+
+
+    a = *(const CPU_INT64U *)p_a;
+    b = *(const CPU_INT64U *)p_b;
+
+    return ((a > b) - (a < b));
+}
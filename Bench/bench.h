@@ -0,0 +1,99 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                            Common Harness
+*
+* Filename : bench.h
+*********************************************************************************************************
+* Note(s)  : (1) See bench.c.
+*********************************************************************************************************
+*/
+
+#ifndef  BENCH_H
+#define  BENCH_H
+
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <os.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_RUN_QTY                          5u              /* Best of BENCH_RUN_QTY runs, see bench.c Note #3.     */
+
+#define  BENCH_CTRL_STK_SIZE                 4096u
+#define  BENCH_TASK_CTRL_PRIO                  30u              /* Control task, running BenchMain().                   */
+
+
+/*
+*********************************************************************************************************
+*                                              DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  void  (*BENCH_RUN_FNCT)(void  *p_arg);                 /* One run of a bench, timed by BenchRunBest().         */
+
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern  OS_TCB  BenchCtrlTCB;
+
+
+/*
+*********************************************************************************************************
+*                                          FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void        BenchMain       (int              argc,             /* Provided by each bench, see bench.c Note #1.         */
+                             char            *argv[]);
+
+void        BenchTaskCreate (OS_TCB          *p_tcb,
+                             OS_TASK_PTR      p_task,
+                             void            *p_arg,
+                             OS_PRIO          prio,
+                             CPU_STK         *p_stk,
+                             CPU_STK_SIZE     stk_size);
+
+void        BenchErrChk     (OS_ERR           err,
+                             const  char     *p_what);
+
+CPU_INT64U  BenchRunBest    (BENCH_RUN_FNCT   p_run,
+                             void            *p_arg);
+
+CPU_INT64U  BenchTimeGet    (void);
+
+int         BenchCmp        (const  void     *p_a,
+                             const  void     *p_b);
+
+#endif
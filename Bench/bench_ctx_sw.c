@@ -0,0 +1,163 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                     Context Switch Ping-Pong
+*
+* Filename : bench_ctx_sw.c
+*********************************************************************************************************
+* Note(s)  : (1) Two tasks hand the CPU back and forth through their task semaphores: the high priority
+*                task pends, the low priority task posts, which switches to the high priority task,
+*                which pends again and switches back.  Each round thus costs two context switches.
+*
+*            (2) Build it once per context switch implementation to compare them, e.g. with
+*                -DOS_CPU_CFG_CTX_SW_FUTEX_EN=0u and -DOS_CPU_CFG_CTX_SW_FUTEX_EN=1u, or against the POSIX
+*                ucontext port.  See bench.c for the build.
+*
+*            (3) The result line reports nanoseconds per round trip: min, average, 99th percentile and
+*                max, see bench.c Note #3.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+
+#include  <stdio.h>
+#include  <stdlib.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_ROUND_QTY                   100000u
+#define  BENCH_ROUND_WARMUP_QTY              1000u
+
+#define  BENCH_TASK_STK_SIZE                 4096u
+#define  BENCH_TASK_PING_PRIO                   5u
+#define  BENCH_TASK_PONG_PRIO                   6u              /* The control task, while it runs the bench.           */
+
+#if   !defined(OS_CPU_CFG_CTX_SW_FUTEX_EN)                      /* POSIX ucontext port.                                 */
+#define  BENCH_CTX_SW_IMPL_NAME            "ucontext"
+#define  BENCH_CTX_SW_SPIN_CNT                  0u
+#elif (OS_CPU_CFG_CTX_SW_FUTEX_EN > 0u)
+#define  BENCH_CTX_SW_IMPL_NAME            "futex"
+#define  BENCH_CTX_SW_SPIN_CNT             OS_CPU_CFG_CTX_SW_SPIN_CNT
+#else
+#define  BENCH_CTX_SW_IMPL_NAME            "semaphore"
+#define  BENCH_CTX_SW_SPIN_CNT             OS_CPU_CFG_CTX_SW_SPIN_CNT
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB       BenchPingTCB;
+static  CPU_STK      BenchPingStk[BENCH_TASK_STK_SIZE];
+
+static  CPU_INT64U   BenchRoundTbl[BENCH_ROUND_QTY];            /* Duration of each round, in ns.                       */
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  BenchPingTask (void  *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH TASKS
+*
+* Description: The ping task waits for the pong task, i.e. the control task, on its task semaphore, see
+*              Note #1.
+*********************************************************************************************************
+*/
+
+static  void  BenchPingTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+}
+
+
+void  BenchMain (int    argc,
+                 char  *argv[])
+{
+    CPU_INT32U  ix;
+    CPU_INT64U  ts_start;
+    CPU_INT64U  sum;
+    OS_ERR      err;
+
+
+    (void)argc;
+    (void)argv;
+
+    BenchTaskCreate(&BenchPingTCB,
+                     BenchPingTask,
+                     (void *)0,
+                     BENCH_TASK_PING_PRIO,
+                    &BenchPingStk[0u],
+                     BENCH_TASK_STK_SIZE);
+
+    OSTaskChangePrio((OS_TCB *)0, BENCH_TASK_PONG_PRIO, &err);
+    BenchErrChk(err, "OSTaskChangePrio");
+
+    for (ix = 0u; ix < BENCH_ROUND_WARMUP_QTY; ix++) {
+        (void)OSTaskSemPost(&BenchPingTCB, OS_OPT_POST_NONE, &err);
+    }
+
+    sum = 0u;
+    for (ix = 0u; ix < BENCH_ROUND_QTY; ix++) {
+        ts_start          = BenchTimeGet();
+        (void)OSTaskSemPost(&BenchPingTCB, OS_OPT_POST_NONE, &err);
+        BenchRoundTbl[ix] = BenchTimeGet() - ts_start;
+        sum              += BenchRoundTbl[ix];
+    }
+
+    qsort(BenchRoundTbl, BENCH_ROUND_QTY, sizeof(BenchRoundTbl[0u]), BenchCmp);
+
+    printf("bench,impl,spin_cnt,rounds,min_ns,avg_ns,p99_ns,max_ns\r\n");
+    printf("ctx_sw_ping_pong,%s,%u,%u,%llu,%llu,%llu,%llu\r\n",
+           BENCH_CTX_SW_IMPL_NAME,
+           (unsigned)BENCH_CTX_SW_SPIN_CNT,
+           (unsigned)BENCH_ROUND_QTY,
+           (unsigned long long)BenchRoundTbl[0u],
+           (unsigned long long)(sum / BENCH_ROUND_QTY),
+           (unsigned long long)BenchRoundTbl[(BENCH_ROUND_QTY * 99u) / 100u],
+           (unsigned long long)BenchRoundTbl[BENCH_ROUND_QTY - 1u]);
+}
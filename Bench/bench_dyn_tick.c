@@ -0,0 +1,232 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                     Periodic versus Dynamic Tick
+*
+* Filename : bench_dyn_tick.c
+*********************************************************************************************************
+* Note(s)  : (1) A few tasks run periodically, with periods from 10 ms to 2 s, as a typical low duty cycle
+*                application would.  The bench counts the tick interrupts taken and measures how late each
+*                task wakes up compared to its ideal period, on the host's monotonic clock.
+*
+*            (2) Runs on the POSIX GNU port with the real host tick.  Build it once with OS_CFG_DYN_TICK_EN
+*                disabled and once enabled to compare both modes, see bench.c for the build.
+*
+*            (3) The result line reports the tick interrupts per second and the wake-up lateness in
+*                microseconds: min, average, 99th percentile and max.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+#include  <os_cfg_app.h>
+
+#include  <stdio.h>
+#include  <stdlib.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_DURATION_SEC                     10u
+
+#define  BENCH_TASK_QTY                          6u
+#define  BENCH_TASK_STK_SIZE                  1024u
+#define  BENCH_TASK_PRIO                        10u
+#define  BENCH_TASK_MAIN_PRIO                    5u             /* The control task, ahead of the periodic tasks.       */
+
+#define  BENCH_SAMPLE_QTY                     2048u
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+#define  BENCH_TICK_MODE_NAME              "dynamic"
+#else
+#define  BENCH_TICK_MODE_NAME              "periodic"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  const  CPU_INT32U  BenchTaskPeriodTbl[BENCH_TASK_QTY] = {  /* Task periods, in ms.                         */
+    10u, 50u, 100u, 250u, 1000u, 2000u
+};
+
+static  OS_TCB        BenchTaskTCB[BENCH_TASK_QTY];
+static  CPU_STK       BenchTaskStk[BENCH_TASK_QTY][BENCH_TASK_STK_SIZE];
+
+static  CPU_INT64S    BenchSampleTbl[BENCH_SAMPLE_QTY];         /* Lateness of each wake-up, in ns.                     */
+static  CPU_INT32U    BenchSampleCtr;
+static  CPU_BOOLEAN   BenchSampleEn;
+static  CPU_INT32U    BenchTickCtr;                             /* Tick interrupts taken while sampling.                */
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        BenchTask     (void  *p_arg);
+static  void        BenchTickHook (void);
+
+static  int         BenchLateCmp  (const  void  *p_a,
+                                   const  void  *p_b);
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH TASKS
+*
+* Description: The bench task starts the tick and the periodic tasks, lets them run for BENCH_DURATION_SEC
+*              and prints the results, see Note #1.
+*********************************************************************************************************
+*/
+
+void  BenchMain (int    argc,
+                 char  *argv[])
+{
+    CPU_INT32U  ix;
+    CPU_INT64S  sum;
+    OS_ERR      err;
+    CPU_SR_ALLOC();
+
+
+    (void)argc;
+    (void)argv;
+
+    OSTaskChangePrio((OS_TCB *)0, BENCH_TASK_MAIN_PRIO, &err);
+    BenchErrChk(err, "OSTaskChangePrio");
+
+    OS_AppTimeTickHookPtr = BenchTickHook;
+    OS_CPU_SysTickInit();
+
+    for (ix = 0u; ix < BENCH_TASK_QTY; ix++) {
+        BenchTaskCreate(&BenchTaskTCB[ix],
+                         BenchTask,
+                        (void *)&BenchTaskPeriodTbl[ix],
+                         BENCH_TASK_PRIO,
+                        &BenchTaskStk[ix][0u],
+                         BENCH_TASK_STK_SIZE);
+    }
+
+    OSTimeDly(OS_CFG_TICK_RATE_HZ, OS_OPT_TIME_DLY, &err);      /* Let every task settle on its period.                 */
+    CPU_CRITICAL_ENTER();
+    BenchTickCtr  = 0u;
+    BenchSampleEn = OS_TRUE;
+    CPU_CRITICAL_EXIT();
+
+    OSTimeDly(BENCH_DURATION_SEC * OS_CFG_TICK_RATE_HZ, OS_OPT_TIME_DLY, &err);
+
+    CPU_CRITICAL_ENTER();
+    BenchSampleEn = OS_FALSE;
+    CPU_CRITICAL_EXIT();
+
+    qsort(BenchSampleTbl, BenchSampleCtr, sizeof(BenchSampleTbl[0u]), BenchLateCmp);
+    sum = 0;
+    for (ix = 0u; ix < BenchSampleCtr; ix++) {
+        sum += BenchSampleTbl[ix];
+    }
+
+    printf("bench,mode,tick_hz,ticks_per_sec,wakeups,late_min_us,late_avg_us,late_p99_us,late_max_us\r\n");
+    printf("dyn_tick,%s,%u,%.1f,%u,%.1f,%.1f,%.1f,%.1f\r\n",
+           BENCH_TICK_MODE_NAME,
+           (unsigned)OS_CFG_TICK_RATE_HZ,
+           (double)BenchTickCtr / (double)BENCH_DURATION_SEC,
+           (unsigned)BenchSampleCtr,
+           (double)BenchSampleTbl[0u] / 1000.0,
+           (double)(sum / (CPU_INT64S)BenchSampleCtr) / 1000.0,
+           (double)BenchSampleTbl[(BenchSampleCtr * 99u) / 100u] / 1000.0,
+           (double)BenchSampleTbl[BenchSampleCtr - 1u] / 1000.0);
+}
+
+
+static  void  BenchTask (void  *p_arg)
+{
+    CPU_INT32U  period_ms;
+    OS_TICK     dly;
+    CPU_INT64U  period_ns;
+    CPU_INT64U  ts_ideal;
+    CPU_INT64U  ts;
+    OS_ERR      err;
+    CPU_SR_ALLOC();
+
+
+    period_ms = *(const CPU_INT32U *)p_arg;
+    period_ns = (CPU_INT64U)period_ms * 1000000u;
+
+    dly       = (period_ms * OS_CFG_TICK_RATE_HZ) / 1000u;
+
+    OSTimeDly(dly, OS_OPT_TIME_PERIODIC, &err);                 /* The first period sets the reference.                 */
+    ts_ideal  = BenchTimeGet();
+
+    for (;;) {
+        OSTimeDly(dly, OS_OPT_TIME_PERIODIC, &err);
+        ts        = BenchTimeGet();
+        ts_ideal += period_ns;
+
+        CPU_CRITICAL_ENTER();
+        if ((BenchSampleEn  == OS_TRUE) &&
+            (BenchSampleCtr <  BENCH_SAMPLE_QTY)) {
+            BenchSampleTbl[BenchSampleCtr] = (CPU_INT64S)(ts - ts_ideal);
+            BenchSampleCtr++;
+        }
+        CPU_CRITICAL_EXIT();
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchTickHook (void)                              /* Called by each tick interrupt.                       */
+{
+    if (BenchSampleEn == OS_TRUE) {
+        BenchTickCtr++;
+    }
+}
+
+
+
+static  int  BenchLateCmp (const  void  *p_a,
+                           const  void  *p_b)
+{
+    CPU_INT64S  a;
+    CPU_INT64S  b;
+
+
+    a = *(const CPU_INT64S *)p_a;
+    b = *(const CPU_INT64S *)p_b;
+
+    return ((a > b) - (a < b));
+}
@@ -0,0 +1,214 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                         Event Flag Group Posts
+*
+* Filename : bench_flag_post.c
+*********************************************************************************************************
+* Note(s)  : (1) 'waiters' tasks wait on an event flag group, each for all of the flags of its pair, one of
+*                which is never posted.  The bench task then sets and clears, in turn:
+*
+*                    other    A flag no task waits on.
+*                    one      A flag a single task waits on.
+*                    all      A flag all the tasks wait on.
+*
+*                No task is ever readied, so each post only costs the look up of the waiting tasks.  Only the
+*                'other' posts skip the waiting tasks, see OSFlagPost() Note #2; 'one' and 'all' go through all of
+*                them, see OSFlagPost() Note #3.
+*
+*                With OS_CFG_FLAG_WAIT_LIST_EN, each waiter is filed under one of its two flags, see OSFlagPost()
+*                Note #4.  A post then only looks at the waiters filed under the posted flag, and files them under
+*                their other flag, so the cost no longer depends on the number of waiters.
+*
+*            (2) Needs 32 bit OS_FLAGS.  Build it with and without OS_CFG_FLAG_WAIT_LIST_EN to compare.  See
+*                bench.c for the build.
+*
+*            (3) Results are in nanoseconds per post, of the fastest run, see bench.c Note #3.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+
+#include  <stdio.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_ROUND_QTY                    20000u
+
+#define  BENCH_WAITER_QTY_MAX                  64u
+#define  BENCH_TASK_STK_SIZE                 1024u
+
+#define  BENCH_TASK_WAITER_PRIO                20u
+
+#define  BENCH_FLAG_OTHER            (OS_FLAGS)0x00000001u      /* Flag no task waits on.                               */
+#define  BENCH_FLAG_ALL              (OS_FLAGS)0x80000000u      /* Flag all the tasks wait on, never left set.          */
+#define  BENCH_FLAG_WAITER_QTY                 30u              /* Flags 1 to 30 are shared out among the waiters.      */
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB        BenchWaiterTCB[BENCH_WAITER_QTY_MAX];
+static  CPU_STK       BenchWaiterStk[BENCH_WAITER_QTY_MAX][BENCH_TASK_STK_SIZE];
+
+static  OS_FLAG_GRP   BenchFlagGrp;
+
+static  const  OS_OBJ_QTY  BenchWaiterQtyTbl[] = { 1u, 8u, 16u, 32u, 50u, 64u };
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        BenchWaiterTask (void        *p_arg);
+
+static  void        BenchRun        (OS_OBJ_QTY   waiter_qty,
+                                     const  char  *p_mode,
+                                     OS_FLAGS     flags);
+
+static  void        BenchRunRounds  (void        *p_arg);
+
+static  OS_FLAGS    BenchFlagGet    (OS_OBJ_QTY   ix);
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH TASKS
+*
+* Description: The control task adds waiters up to each count of BenchWaiterQtyTbl[] and posts, see Note #1.
+*              Waiter 'ix' waits forever on its flag and on BENCH_FLAG_ALL, the last waiter added is the one
+*              waiting on the flag posted in the 'one' mode.
+*********************************************************************************************************
+*/
+
+void  BenchMain (int    argc,
+                 char  *argv[])
+{
+    OS_OBJ_QTY   waiter_qty;
+    CPU_INT32U   lvl;
+    OS_ERR       err;
+
+
+    (void)argc;
+    (void)argv;
+
+    OSFlagCreate(&BenchFlagGrp, "Bench Flags", 0u, &err);
+    BenchErrChk(err, "OSFlagCreate");
+
+    printf("bench,mode,waiters,rounds,ns_per_post\r\n");
+
+    waiter_qty = 0u;
+    for (lvl = 0u; lvl < (sizeof(BenchWaiterQtyTbl) / sizeof(BenchWaiterQtyTbl[0])); lvl++) {
+        while (waiter_qty < BenchWaiterQtyTbl[lvl]) {           /* Higher priority, the waiter pends at once.           */
+            BenchTaskCreate(&BenchWaiterTCB[waiter_qty],
+                             BenchWaiterTask,
+                             (void *)(CPU_ADDR)waiter_qty,
+                             BENCH_TASK_WAITER_PRIO,
+                            &BenchWaiterStk[waiter_qty][0u],
+                             BENCH_TASK_STK_SIZE);
+            waiter_qty++;
+        }
+
+        BenchRun(waiter_qty, "other", BENCH_FLAG_OTHER);
+        if (waiter_qty <= BENCH_FLAG_WAITER_QTY) {              /* Only then is the last waiter alone on its flag.      */
+            BenchRun(waiter_qty, "one", BenchFlagGet(waiter_qty - 1u));
+        }
+        BenchRun(waiter_qty, "all", BENCH_FLAG_ALL);
+    }
+}
+
+
+static  void  BenchWaiterTask (void  *p_arg)
+{
+    OS_FLAGS  flags;
+    OS_ERR    err;
+
+
+    flags = BenchFlagGet((OS_OBJ_QTY)(CPU_ADDR)p_arg) | BENCH_FLAG_ALL;
+    for (;;) {
+        (void)OSFlagPend(&BenchFlagGrp,
+                          flags,
+                          0u,
+                         (OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_BLOCKING),
+                         (CPU_TS *)0,
+                         &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchRun (OS_OBJ_QTY    waiter_qty,
+                        const  char  *p_mode,
+                        OS_FLAGS      flags)
+{
+    CPU_INT64U  ts_best;
+
+
+    ts_best = BenchRunBest(BenchRunRounds, (void *)&flags);
+
+    printf("flag_post,%s,%u,%u,%llu\r\n",
+           p_mode,
+           (unsigned)waiter_qty,
+           (unsigned)BENCH_ROUND_QTY,
+           (unsigned long long)(ts_best / (2u * BENCH_ROUND_QTY)));
+}
+
+
+static  void  BenchRunRounds (void  *p_arg)
+{
+    OS_FLAGS    flags;
+    CPU_INT32U  round;
+    OS_ERR      err;
+
+
+    flags = *(OS_FLAGS *)p_arg;
+    for (round = 0u; round < BENCH_ROUND_QTY; round++) {
+        (void)OSFlagPost(&BenchFlagGrp, flags, OS_OPT_POST_FLAG_SET, &err);
+        (void)OSFlagPost(&BenchFlagGrp, flags, OS_OPT_POST_FLAG_CLR, &err);
+    }
+}
+
+
+static  OS_FLAGS  BenchFlagGet (OS_OBJ_QTY  ix)
+{
+    return ((OS_FLAGS)((OS_FLAGS)1u << (1u + (ix % BENCH_FLAG_WAITER_QTY))));
+}
+
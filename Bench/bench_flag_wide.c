@@ -0,0 +1,246 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                        Wide Event Flag Matching
+*
+* Filename : bench_flag_wide.c
+*********************************************************************************************************
+* Note(s)  : (1) 'waiters' tasks wait on an event flag group, each for all of the flags of its pair, one of
+*                which is never posted.  The bench task then sets and clears the flag all the tasks wait on,
+*                which matches every waiting task without readying any:
+*
+*                    narrow   An OS_FLAG_GRP, with 32 bit OS_FLAGS.
+*                    wide     An OS_FLAG_WIDE_GRP, with the waited for flags in its first and last words.
+*
+*            (2) Needs 32 bit OS_FLAGS and OS_CFG_FLAG_WIDE_EN, e.g. with a width of 128 or 256.  See bench.c
+*                for the build.
+*
+*            (3) Results are in nanoseconds per post, of the fastest run, see bench.c Note #3.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+
+#include  <stdio.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_ROUND_QTY                    20000u
+
+#define  BENCH_WAITER_QTY_MAX                  32u
+#define  BENCH_TASK_STK_SIZE                 1024u
+
+#define  BENCH_TASK_WAITER_PRIO                20u
+
+#define  BENCH_FLAG_ALL              (OS_FLAGS)0x00000001u      /* Flag all the tasks wait on, never left set.          */
+#define  BENCH_FLAG_NEVER            (OS_FLAGS)0x80000000u      /* Flag no task ever gets.                              */
+
+#define  BENCH_FLAG_WIDE_ALL                    0u              /* Wide flags, first and last of the group.             */
+#define  BENCH_FLAG_WIDE_NEVER      (OS_CFG_FLAG_WIDE_WIDTH - 1u)
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB            BenchWaiterTCB[2u][BENCH_WAITER_QTY_MAX];
+static  CPU_STK           BenchWaiterStk[2u][BENCH_WAITER_QTY_MAX][BENCH_TASK_STK_SIZE];
+
+static  OS_FLAG_GRP       BenchFlagGrp;
+static  OS_FLAG_WIDE_GRP  BenchFlagWideGrp;
+
+static  OS_FLAGS_WIDE     BenchFlagsWideAll;
+
+static  const  OS_OBJ_QTY  BenchWaiterQtyTbl[] = { 1u, 8u, 16u, 32u };
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        BenchWaiterTask     (void        *p_arg);
+static  void        BenchWaiterWideTask (void        *p_arg);
+
+static  void        BenchRun            (OS_OBJ_QTY   waiter_qty,
+                                         CPU_BOOLEAN  wide);
+static  void        BenchRunNarrow      (void        *p_arg);
+static  void        BenchRunWide        (void        *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH TASKS
+*
+* Description: The control task adds waiters on both groups up to each count of BenchWaiterQtyTbl[] and posts,
+*              see Note #1.  Waiters wait forever on the flag posted and on a flag never posted.
+*********************************************************************************************************
+*/
+
+void  BenchMain (int    argc,
+                 char  *argv[])
+{
+    OS_OBJ_QTY   waiter_qty;
+    CPU_INT32U   lvl;
+    CPU_INT32U   grp;
+    OS_ERR       err;
+
+
+    (void)argc;
+    (void)argv;
+
+    OSFlagCreate(&BenchFlagGrp, "Bench Flags", 0u, &err);
+    BenchErrChk(err, "OSFlagCreate");
+    OSFlagWideCreate(&BenchFlagWideGrp, "Bench Wide Flags", (OS_FLAGS_WIDE *)0, &err);
+    BenchErrChk(err, "OSFlagWideCreate");
+    OS_FLAG_WIDE_BIT_SET(&BenchFlagsWideAll, BENCH_FLAG_WIDE_ALL);
+
+    printf("bench,mode,width,waiters,rounds,ns_per_post\r\n");
+
+    waiter_qty = 0u;
+    for (lvl = 0u; lvl < (sizeof(BenchWaiterQtyTbl) / sizeof(BenchWaiterQtyTbl[0])); lvl++) {
+        while (waiter_qty < BenchWaiterQtyTbl[lvl]) {           /* Higher priority, the waiters pend at once.           */
+            for (grp = 0u; grp < 2u; grp++) {
+                BenchTaskCreate(&BenchWaiterTCB[grp][waiter_qty],
+                                 (grp == 0u) ? BenchWaiterTask : BenchWaiterWideTask,
+                                 (void *)0,
+                                 BENCH_TASK_WAITER_PRIO,
+                                &BenchWaiterStk[grp][waiter_qty][0u],
+                                 BENCH_TASK_STK_SIZE);
+            }
+            waiter_qty++;
+        }
+
+        BenchRun(waiter_qty, OS_FALSE);
+        BenchRun(waiter_qty, OS_TRUE);
+    }
+}
+
+
+static  void  BenchWaiterTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSFlagPend(&BenchFlagGrp,
+                         (BENCH_FLAG_ALL | BENCH_FLAG_NEVER),
+                          0u,
+                         (OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_BLOCKING),
+                         (CPU_TS *)0,
+                         &err);
+    }
+}
+
+
+static  void  BenchWaiterWideTask (void  *p_arg)
+{
+    OS_FLAGS_WIDE  flags;
+    CPU_DATA       ix;
+    OS_ERR         err;
+
+
+    (void)p_arg;
+
+    for (ix = 0u; ix < OS_FLAG_WIDE_WORD_QTY; ix++) {
+        flags.Word[ix] = 0u;
+    }
+    OS_FLAG_WIDE_BIT_SET(&flags, BENCH_FLAG_WIDE_ALL);
+    OS_FLAG_WIDE_BIT_SET(&flags, BENCH_FLAG_WIDE_NEVER);
+
+    for (;;) {
+        OSFlagWidePend(&BenchFlagWideGrp,
+                       &flags,
+                        0u,
+                       (OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_BLOCKING),
+                       (OS_FLAGS_WIDE *)0,
+                       (CPU_TS *)0,
+                       &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchRun (OS_OBJ_QTY   waiter_qty,
+                        CPU_BOOLEAN  wide)
+{
+    CPU_INT64U  ts_best;
+
+
+    ts_best = BenchRunBest((wide == OS_TRUE) ? BenchRunWide : BenchRunNarrow, (void *)0);
+
+    printf("flag_wide,%s,%u,%u,%u,%llu\r\n",
+           (wide == OS_TRUE) ? "wide" : "narrow",
+           (wide == OS_TRUE) ? (unsigned)OS_CFG_FLAG_WIDE_WIDTH : (unsigned)(sizeof(OS_FLAGS) * 8u),
+           (unsigned)waiter_qty,
+           (unsigned)BENCH_ROUND_QTY,
+           (unsigned long long)(ts_best / (2u * BENCH_ROUND_QTY)));
+}
+
+
+static  void  BenchRunNarrow (void  *p_arg)
+{
+    CPU_INT32U  round;
+    OS_ERR      err;
+
+
+    (void)p_arg;
+
+    for (round = 0u; round < BENCH_ROUND_QTY; round++) {
+        (void)OSFlagPost(&BenchFlagGrp, BENCH_FLAG_ALL, OS_OPT_POST_FLAG_SET, &err);
+        (void)OSFlagPost(&BenchFlagGrp, BENCH_FLAG_ALL, OS_OPT_POST_FLAG_CLR, &err);
+    }
+}
+
+
+static  void  BenchRunWide (void  *p_arg)
+{
+    CPU_INT32U  round;
+    OS_ERR      err;
+
+
+    (void)p_arg;
+
+    for (round = 0u; round < BENCH_ROUND_QTY; round++) {
+        OSFlagWidePost(&BenchFlagWideGrp, &BenchFlagsWideAll, OS_OPT_POST_FLAG_SET, (OS_FLAGS_WIDE *)0, &err);
+        OSFlagWidePost(&BenchFlagWideGrp, &BenchFlagsWideAll, OS_OPT_POST_FLAG_CLR, (OS_FLAGS_WIDE *)0, &err);
+    }
+}
@@ -0,0 +1,330 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                 Interrupt Disable Time of ISR Posts
+*
+* Filename : bench_isr_post.c
+*********************************************************************************************************
+* Note(s)  : (1) An ISR posts to an event flag group that 'waiters' tasks pend on.  The waiters wait for the
+*                posted flag and for another flag, which is never posted.  The ISR alternately sets and clears
+*                the posted flag, so OSFlagPost() goes through all of them without readying any.  The bench
+*                reports how long interrupts were disabled:
+*
+*                    isr_med/isr_max  Median and max over the rounds of the longest critical section between
+*                                     OSIntEnter() and OSIntExit(), i.e. of the post made by the ISR.
+*                    handler_max      Longest critical section of the ISR handler task, which replays the post
+*                                     when posts are deferred.  0 otherwise.
+*                    sys_max          Longest critical section of the whole system during the rounds: the ISRs,
+*                                     OSIntExit(), the context switches and every task, the ISR handler task
+*                                     included.
+*
+*                The run with the lowest sys_max out of BENCH_RUN_QTY is kept, to filter out the host's
+*                jitter.  Build it once with OS_CFG_ISR_POST_DEFERRED_EN disabled and once with it enabled to
+*                compare the two modes.
+*
+*            (2) The bench task raises the ISR itself, from task level, which is how an ISR preempting it
+*                would behave.  OS_CPU_SysTickInit() is never called, so no host timer disturbs the results.
+*
+*            (3) uC/CPU must be built with CPU_CFG_INT_DIS_MEAS_EN defined and a timestamp timer,
+*                CPU_TS_TmrRd(), to measure the interrupt disable time.  OS_CFG_DBG_EN must be enabled, the
+*                bench goes through the task list to get the disable time of every task.  See bench.c for the
+*                build.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+
+#include  <stdio.h>
+#include  <stdlib.h>
+
+
+#ifndef  CPU_CFG_INT_DIS_MEAS_EN
+#error  "bench_isr_post.c, CPU_CFG_INT_DIS_MEAS_EN must be defined to measure the interrupt disable time"
+#endif
+
+#if (OS_CFG_DBG_EN == 0u)
+#error  "bench_isr_post.c, OS_CFG_DBG_EN must be enabled to measure the interrupt disable time of every task"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_ROUND_QTY                     1000u
+
+#define  BENCH_WAITER_QTY_MAX                 256u
+#define  BENCH_TASK_STK_SIZE                 1024u
+
+#define  BENCH_TASK_WAITER_PRIO                20u
+
+#define  BENCH_FLAG_POSTED           (OS_FLAGS)0x01u            /* Flag set and cleared by the ISR.                     */
+#define  BENCH_FLAG_WAITED           (OS_FLAGS)0x02u            /* Flag the waiters also pend on, never posted.         */
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB        BenchWaiterTCB[BENCH_WAITER_QTY_MAX];
+static  CPU_STK       BenchWaiterStk[BENCH_WAITER_QTY_MAX][BENCH_TASK_STK_SIZE];
+
+static  OS_FLAG_GRP   BenchFlagGrp;
+static  OS_OPT        BenchISROpt = OS_OPT_POST_FLAG_SET;       /* The ISR alternately sets and clears, see Note #1.    */
+
+static  CPU_TS_TMR    BenchIntDisISR;                           /* Longest disable time of the last ISR.                */
+static  CPU_TS_TMR    BenchIntDisTbl[BENCH_ROUND_QTY];          /* Longest disable time of the ISR, for each round.     */
+static  CPU_TS_TMR    BenchIntDisSys;                           /* Longest disable time outside of the tasks.           */
+
+static  const  OS_OBJ_QTY  BenchWaiterQtyTbl[] = { 1u, 8u, 32u, 128u, 256u };
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        BenchWaiterTask (void        *p_arg);
+
+static  void        BenchISR        (void);
+
+static  void        BenchSysReset   (void);
+
+static  CPU_TS_TMR  BenchSysMax     (void);
+
+static  int         BenchTsCmp      (const  void  *p_a,
+                                     const  void  *p_b);
+
+static  CPU_INT64U  BenchToNs       (CPU_TS_TMR   ts);
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH TASKS
+*
+* Description: The control task adds waiters up to each count of BenchWaiterQtyTbl[] and raises the ISR, see
+*              Note #1.  The waiters pend forever.
+*********************************************************************************************************
+*/
+
+void  BenchMain (int    argc,
+                 char  *argv[])
+{
+    OS_OBJ_QTY   waiter_qty;
+    CPU_INT32U   lvl;
+    CPU_INT32U   round;
+    CPU_INT32U   run;
+    CPU_TS_TMR   isr_med;
+    CPU_TS_TMR   isr_max;
+    CPU_TS_TMR   handler_max;
+    CPU_TS_TMR   sys_max;
+    CPU_TS_TMR   sys_best;
+    OS_ERR       err;
+
+
+    (void)argc;
+    (void)argv;
+
+    OSFlagCreate(&BenchFlagGrp, "Bench Flags", 0u, &err);
+    BenchErrChk(err, "OSFlagCreate");
+
+    printf("bench,mode,waiters,rounds,isr_med_ns,isr_max_ns,handler_max_ns,sys_max_ns\r\n");
+
+    waiter_qty = 0u;
+    for (lvl = 0u; lvl < (sizeof(BenchWaiterQtyTbl) / sizeof(BenchWaiterQtyTbl[0])); lvl++) {
+        while (waiter_qty < BenchWaiterQtyTbl[lvl]) {           /* Higher priority, the waiter pends at once.           */
+            BenchTaskCreate(&BenchWaiterTCB[waiter_qty],
+                             BenchWaiterTask,
+                             (void *)0,
+                             BENCH_TASK_WAITER_PRIO,
+                            &BenchWaiterStk[waiter_qty][0u],
+                             BENCH_TASK_STK_SIZE);
+            waiter_qty++;
+        }
+
+        isr_med     = 0u;
+        isr_max     = 0u;
+        handler_max = 0u;
+        sys_best    = 0u;
+        for (run = 0u; run < BENCH_RUN_QTY; run++) {
+            BenchSysReset();
+            for (round = 0u; round < BENCH_ROUND_QTY; round++) {
+                BenchISR();                                     /* Raised from the bench task, see Note #2.             */
+                BenchIntDisTbl[round] = BenchIntDisISR;
+            }
+            sys_max = BenchSysMax();
+            if ((run == 0u) || (sys_max < sys_best)) {          /* Keep the best run, see Note #1.                      */
+                sys_best = sys_max;
+                qsort(&BenchIntDisTbl[0], BENCH_ROUND_QTY, sizeof(BenchIntDisTbl[0]), BenchTsCmp);
+                isr_med  = BenchIntDisTbl[BENCH_ROUND_QTY / 2u];
+                isr_max  = BenchIntDisTbl[BENCH_ROUND_QTY - 1u];
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+                                                                /* Kept up to date by the port's OSTaskSwHook().        */
+                handler_max = (CPU_TS_TMR)OSIntQTaskTCB.IntDisTimeMax;
+#endif
+            }
+        }
+
+        printf("isr_post,%s,%u,%u,%llu,%llu,%llu,%llu\r\n",
+               (OS_CFG_ISR_POST_DEFERRED_EN > 0u) ? "deferred" : "direct",
+               (unsigned)waiter_qty,
+               (unsigned)BENCH_ROUND_QTY,
+               (unsigned long long)BenchToNs(isr_med),
+               (unsigned long long)BenchToNs(isr_max),
+               (unsigned long long)BenchToNs(handler_max),
+               (unsigned long long)BenchToNs(sys_best));
+    }
+}
+
+
+static  void  BenchWaiterTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSFlagPend(&BenchFlagGrp,
+                         (BENCH_FLAG_POSTED | BENCH_FLAG_WAITED),
+                          0u,
+                         (OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_BLOCKING),
+                         (CPU_TS *)0,
+                         &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchISR (void)
+{
+    CPU_TS_TMR  int_dis;
+    OS_ERR      err;
+
+
+    OSIntEnter();
+    int_dis = CPU_IntDisMeasMaxCurReset();                      /* Bench task, since the last switch or ISR.            */
+    if (BenchIntDisSys < int_dis) {
+        BenchIntDisSys = int_dis;
+    }
+    (void)OSFlagPost(&BenchFlagGrp, BENCH_FLAG_POSTED, BenchISROpt, &err);
+    BenchISROpt = (BenchISROpt == OS_OPT_POST_FLAG_SET) ? OS_OPT_POST_FLAG_CLR : OS_OPT_POST_FLAG_SET;
+    BenchIntDisISR = CPU_IntDisMeasMaxCurReset();
+    if (BenchIntDisSys < BenchIntDisISR) {
+        BenchIntDisSys = BenchIntDisISR;
+    }
+    OSIntExit();
+}
+
+
+/*
+*********************************************************************************************************
+*                                   SYSTEM-WIDE INTERRUPT DISABLE TIME
+*
+* Description: The port's OSTaskSwHook() charges the disable time to the task switched out, and BenchISR()
+*              takes the time of the ISR.  The system-wide max is the max of the two, over all the tasks.
+*********************************************************************************************************
+*/
+
+static  void  BenchSysReset (void)
+{
+    OS_TCB  *p_tcb;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTaskDbgListPtr;
+    while (p_tcb != (OS_TCB *)0) {
+        p_tcb->IntDisTimeMax = 0u;
+        p_tcb = p_tcb->DbgNextPtr;
+    }
+    CPU_CRITICAL_EXIT();
+    (void)CPU_IntDisMeasMaxCurReset();
+    BenchIntDisSys = 0u;
+}
+
+
+static  CPU_TS_TMR  BenchSysMax (void)
+{
+    OS_TCB      *p_tcb;
+    CPU_TS_TMR   int_dis;
+    CPU_TS_TMR   int_dis_max;
+
+
+    int_dis_max = CPU_IntDisMeasMaxCurReset();                  /* Bench task, since the last switch or ISR.            */
+    if (int_dis_max < BenchIntDisSys) {
+        int_dis_max = BenchIntDisSys;
+    }
+    p_tcb = OSTaskDbgListPtr;
+    while (p_tcb != (OS_TCB *)0) {
+        int_dis = (CPU_TS_TMR)p_tcb->IntDisTimeMax;
+        if (int_dis_max < int_dis) {
+            int_dis_max = int_dis;
+        }
+        p_tcb = p_tcb->DbgNextPtr;
+    }
+
+    return (int_dis_max);
+}
+
+
+static  int  BenchTsCmp (const  void  *p_a,
+                         const  void  *p_b)
+{
+    CPU_TS_TMR  a;
+    CPU_TS_TMR  b;
+
+
+    a = *(const CPU_TS_TMR *)p_a;
+    b = *(const CPU_TS_TMR *)p_b;
+
+    return ((a > b) - (a < b));
+}
+
+
+static  CPU_INT64U  BenchToNs (CPU_TS_TMR  ts)
+{
+    CPU_TS_TMR_FREQ  freq;
+    CPU_ERR          err;
+
+
+    freq = CPU_TS_TmrFreqGet(&err);
+    if ((err != CPU_ERR_NONE) || (freq == 0u)) {
+        return (0u);
+    }
+
+    return (((CPU_INT64U)ts * 1000000000u) / freq);
+}
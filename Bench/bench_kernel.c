@@ -0,0 +1,703 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                       Kernel Services Suite
+*
+* Filename : bench_kernel.c
+*********************************************************************************************************
+* Note(s)  : (1) Measures the cost of the main kernel paths on a POSIX port:
+*
+*                    sem_ctx_sw       OSSemPost() to a higher priority task pending in OSSemPend(), until the
+*                                     task pends again.  Two context switches.
+*                    isr_to_task      From an ISR posting a task semaphore to the task running.
+*                    q_msg            OSQPost() and OSQPend() of one message, posted in batches of 'param'
+*                                     to a lower priority consumer.
+*                    flag_fan_out     OSFlagPost() readying 'param' tasks, until all of them pend again.
+*                    mutex_inherit    OSMutexPend() on a mutex held by a lower priority task, raising the
+*                                     owner's priority, until the mutex is released to the pending task.
+*                    tick_list        One tick with 'param' tasks delaying 1 to 16 ticks in a loop.
+*                    tmr_start        OSTmrStart() of one timer, 'param' being the number of timers started.
+*                    tmr_stop         OSTmrStop() of one timer, 'param' being the number of timers running.
+*                    tmr_tick         One period of the timer task with 'param' periodic timers running.
+*
+*            (2) The bench task raises the tick and the ISRs itself, from task level, which is how an ISR
+*                preempting it would behave.  OS_CPU_SysTickInit() is never called, so no host timer
+*                disturbs the results.
+*
+*            (3) Build the file together with Bench/bench.c, see bench.c Note #2.  Toggle OS_CFG_TICK_WHEEL_EN
+*                and OS_CFG_TMR_WHEEL_EN to compare the tick and timer lists.
+*
+*            (4) Results are printed in CSV, or in JSON when run with '--json'.  Times are in nanoseconds,
+*                measured on the host's monotonic clock: min, average, 99th percentile and max.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+#include  <os_cfg_app.h>
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_SAMPLE_QTY                    10000u
+#define  BENCH_SAMPLE_WARMUP_QTY               100u
+#define  BENCH_SAMPLE_TICK_QTY                2000u
+#define  BENCH_SAMPLE_TMR_QTY                  200u
+
+#define  BENCH_TASK_QTY_MAX                   1024u             /* Max nbr of tasks of a scaling bench.                 */
+#define  BENCH_TMR_QTY_MAX                  100000u             /* Max nbr of timers of the timer bench.                */
+#define  BENCH_TASK_STK_SIZE                  1024u
+
+#define  BENCH_TASK_HI_PRIO                     10u
+#define  BENCH_TASK_TMR_PRIO                    15u             /* Timer task while timers are measured.                */
+#define  BENCH_TASK_SCALE_PRIO                  20u
+#define  BENCH_TASK_LO_PRIO                     25u
+#define  BENCH_TASK_CONSUMER_PRIO               31u
+
+#define  BENCH_Q_BATCH_SIZE                     16u             /* Must not exceed OS_CFG_MSG_POOL_SIZE.                */
+
+#define  BENCH_DLY_MAX                          16u             /* Delays and timer periods are 1 to 16 ticks.          */
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB        BenchHiTCB;
+static  CPU_STK       BenchHiStk[BENCH_TASK_STK_SIZE];
+static  OS_TCB        BenchLoTCB;
+static  CPU_STK       BenchLoStk[BENCH_TASK_STK_SIZE];
+
+static  OS_TCB        BenchTaskTCB[BENCH_TASK_QTY_MAX];         /* Tasks of the scaling benches.                        */
+static  CPU_STK       BenchTaskStk[BENCH_TASK_QTY_MAX][BENCH_TASK_STK_SIZE];
+
+static  CPU_INT64U    BenchSampleTbl[BENCH_SAMPLE_QTY];         /* Duration of each sample, in ns.                      */
+static  CPU_INT32U    BenchSampleIx;
+static  CPU_INT64U    BenchIntTS;                               /* Time at which the ISR posted.                        */
+
+static  CPU_BOOLEAN   BenchFmtJSON;
+static  CPU_BOOLEAN   BenchFmtFirst;
+
+#if (OS_CFG_SEM_EN > 0u)
+static  OS_SEM        BenchSem;
+#endif
+#if (OS_CFG_Q_EN > 0u)
+static  OS_Q          BenchQ;
+#endif
+#if (OS_CFG_FLAG_EN > 0u)
+static  OS_FLAG_GRP   BenchFlagGrp;
+#endif
+#if (OS_CFG_MUTEX_EN > 0u)
+static  OS_MUTEX      BenchMutex;
+#endif
+#if (OS_CFG_TMR_EN > 0u)
+static  OS_TMR        BenchTmrTbl[BENCH_TMR_QTY_MAX];
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        BenchSemCtxSw       (void);
+static  void        BenchIntToTask      (void);
+static  void        BenchQMsg           (void);
+static  void        BenchFlagFanOut     (CPU_INT32U   task_qty);
+static  void        BenchMutexInherit   (void);
+static  void        BenchTickList       (CPU_INT32U   task_qty);
+static  void        BenchTmr            (CPU_INT32U   tmr_qty);
+
+static  void        BenchTickISR        (void);
+static  void        BenchTaskDel        (OS_TCB      *p_tcb);
+
+static  void        BenchReport         (const char  *p_name,
+                                         CPU_INT32U   param,
+                                         CPU_INT32U   sample_qty);
+
+
+/*
+*********************************************************************************************************
+*                                              BenchMain()
+*
+* Description: Runs every benchmark in turn and prints the results, see Note #1.
+*********************************************************************************************************
+*/
+
+void  BenchMain (int    argc,
+                 char  *argv[])
+{
+    BenchFmtJSON = OS_FALSE;
+    if ((argc > 1) && (strcmp(argv[1], "--json") == 0)) {
+        BenchFmtJSON = OS_TRUE;
+    }
+
+    BenchFmtFirst = OS_TRUE;
+    if (BenchFmtJSON == OS_TRUE) {
+        printf("[\r\n");
+    } else {
+        printf("bench,param,samples,min_ns,avg_ns,p99_ns,max_ns\r\n");
+    }
+
+#if (OS_CFG_SEM_EN > 0u)
+    BenchSemCtxSw();
+#endif
+    BenchIntToTask();
+#if (OS_CFG_Q_EN > 0u)
+    BenchQMsg();
+#endif
+#if (OS_CFG_FLAG_EN > 0u)
+    BenchFlagFanOut(1u);
+    BenchFlagFanOut(8u);
+    BenchFlagFanOut(64u);
+#endif
+#if (OS_CFG_MUTEX_EN > 0u)
+    BenchMutexInherit();
+#endif
+    BenchTickList(16u);
+    BenchTickList(128u);
+    BenchTickList(1024u);
+#if (OS_CFG_TMR_EN > 0u)
+    BenchTmr(10u);
+    BenchTmr(1000u);
+    BenchTmr(100000u);
+#endif
+
+    if (BenchFmtJSON == OS_TRUE) {
+        printf("\r\n]\r\n");
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    SEMAPHORE CONTEXT SWITCH BENCH
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_EN > 0u)
+static  void  BenchSemCtxSwTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSSemPend(&BenchSem, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+}
+
+
+static  void  BenchSemCtxSw (void)
+{
+    CPU_INT32U  ix;
+    CPU_INT64U  ts_start;
+    OS_ERR      err;
+
+
+    OSSemCreate(&BenchSem, "Bench Sem", 0u, &err);
+    BenchErrChk(err, "OSSemCreate");
+    BenchTaskCreate(&BenchHiTCB, BenchSemCtxSwTask, (void *)0, BENCH_TASK_HI_PRIO, &BenchHiStk[0], BENCH_TASK_STK_SIZE);
+
+    for (ix = 0u; ix < BENCH_SAMPLE_WARMUP_QTY; ix++) {
+        (void)OSSemPost(&BenchSem, OS_OPT_POST_1, &err);
+    }
+    for (ix = 0u; ix < BENCH_SAMPLE_QTY; ix++) {
+        ts_start           = BenchTimeGet();
+        (void)OSSemPost(&BenchSem, OS_OPT_POST_1, &err);
+        BenchSampleTbl[ix] = BenchTimeGet() - ts_start;
+    }
+    BenchReport("sem_ctx_sw", 0u, BENCH_SAMPLE_QTY);
+
+    BenchTaskDel(&BenchHiTCB);
+    (void)OSSemDel(&BenchSem, OS_OPT_DEL_ALWAYS, &err);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      ISR TO TASK LATENCY BENCH
+*********************************************************************************************************
+*/
+
+static  void  BenchIntToTaskISR (void)
+{
+    OS_ERR  err;
+
+
+    OSIntEnter();
+    BenchIntTS = BenchTimeGet();
+    (void)OSTaskSemPost(&BenchHiTCB, OS_OPT_POST_NONE, &err);
+    OSIntExit();
+}
+
+
+static  void  BenchIntToTaskTask (void  *p_arg)
+{
+    CPU_INT64U  ts;
+    OS_ERR      err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        ts = BenchTimeGet();
+        if (BenchSampleIx < BENCH_SAMPLE_QTY) {
+            BenchSampleTbl[BenchSampleIx] = ts - BenchIntTS;
+        }
+    }
+}
+
+
+static  void  BenchIntToTask (void)
+{
+    CPU_INT32U  ix;
+
+
+    BenchTaskCreate(&BenchHiTCB, BenchIntToTaskTask, (void *)0, BENCH_TASK_HI_PRIO, &BenchHiStk[0], BENCH_TASK_STK_SIZE);
+
+    BenchSampleIx = BENCH_SAMPLE_QTY;                           /* Do not record the warm-up.                           */
+    for (ix = 0u; ix < BENCH_SAMPLE_WARMUP_QTY; ix++) {
+        BenchIntToTaskISR();
+    }
+    for (ix = 0u; ix < BENCH_SAMPLE_QTY; ix++) {
+        BenchSampleIx = ix;
+        BenchIntToTaskISR();                                    /* Raised from the bench task, see Note #2.             */
+    }
+    BenchReport("isr_to_task", 0u, BENCH_SAMPLE_QTY);
+
+    BenchTaskDel(&BenchHiTCB);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       QUEUE THROUGHPUT BENCH
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_Q_EN > 0u)
+static  void  BenchQMsgTask (void  *p_arg)
+{
+    CPU_INT32U   msg_ctr;
+    OS_MSG_SIZE  msg_size;
+    OS_ERR       err;
+
+
+    (void)p_arg;
+
+    msg_ctr = 0u;
+    for (;;) {
+        (void)OSQPend(&BenchQ, 0u, OS_OPT_PEND_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        msg_ctr++;
+        if (msg_ctr == BENCH_Q_BATCH_SIZE) {                    /* Batch drained, resume the bench task.                */
+            msg_ctr = 0u;
+            (void)OSTaskSemPost(&BenchCtrlTCB, OS_OPT_POST_NONE, &err);
+        }
+    }
+}
+
+
+static  void  BenchQMsg (void)
+{
+    CPU_INT32U  ix;
+    CPU_INT32U  msg_ix;
+    CPU_INT32U  sample_qty;
+    CPU_INT64U  ts_start;
+    OS_ERR      err;
+
+
+    OSQCreate(&BenchQ, "Bench Q", BENCH_Q_BATCH_SIZE, &err);
+    BenchErrChk(err, "OSQCreate");
+    BenchTaskCreate(&BenchLoTCB, BenchQMsgTask, (void *)0, BENCH_TASK_CONSUMER_PRIO, &BenchLoStk[0], BENCH_TASK_STK_SIZE);
+
+    sample_qty = BENCH_SAMPLE_QTY / BENCH_Q_BATCH_SIZE;
+    for (ix = 0u; ix < sample_qty; ix++) {
+        ts_start = BenchTimeGet();
+        for (msg_ix = 0u; msg_ix < BENCH_Q_BATCH_SIZE; msg_ix++) {
+            OSQPost(&BenchQ, (void *)&BenchSampleTbl[msg_ix], sizeof(CPU_INT64U), OS_OPT_POST_FIFO, &err);
+        }
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchSampleTbl[ix] = (BenchTimeGet() - ts_start) / BENCH_Q_BATCH_SIZE;
+    }
+    BenchReport("q_msg", BENCH_Q_BATCH_SIZE, sample_qty);
+
+    BenchTaskDel(&BenchLoTCB);
+    (void)OSQDel(&BenchQ, OS_OPT_DEL_ALWAYS, &err);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        FLAG FAN-OUT BENCH
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_EN > 0u)
+static  void  BenchFlagFanOutTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSFlagPend(&BenchFlagGrp,
+                         (OS_FLAGS)1u,
+                          0u,
+                         (OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_BLOCKING),
+                         (CPU_TS *)0,
+                         &err);
+    }
+}
+
+
+static  void  BenchFlagFanOut (CPU_INT32U  task_qty)
+{
+    CPU_INT32U  ix;
+    CPU_INT64U  ts_start;
+    OS_ERR      err;
+
+
+    OSFlagCreate(&BenchFlagGrp, "Bench Flag", (OS_FLAGS)0, &err);
+    BenchErrChk(err, "OSFlagCreate");
+    for (ix = 0u; ix < task_qty; ix++) {
+        BenchTaskCreate(&BenchTaskTCB[ix],
+                         BenchFlagFanOutTask,
+                         (void *)0,
+                         BENCH_TASK_SCALE_PRIO,
+                        &BenchTaskStk[ix][0],
+                         BENCH_TASK_STK_SIZE);
+    }
+
+    for (ix = 0u; ix < BENCH_SAMPLE_QTY; ix++) {
+        ts_start           = BenchTimeGet();
+        (void)OSFlagPost(&BenchFlagGrp, (OS_FLAGS)1u, OS_OPT_POST_FLAG_SET, &err);
+        BenchSampleTbl[ix] = BenchTimeGet() - ts_start;
+    }
+    BenchReport("flag_fan_out", task_qty, BENCH_SAMPLE_QTY);
+
+    for (ix = 0u; ix < task_qty; ix++) {
+        BenchTaskDel(&BenchTaskTCB[ix]);
+    }
+    (void)OSFlagDel(&BenchFlagGrp, OS_OPT_DEL_ALWAYS, &err);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  MUTEX PRIORITY INHERITANCE BENCH
+*
+* Note(s) : (1) Each round, the bench task wakes the low priority task, which takes the mutex and wakes the
+*               high priority task.  The high priority task then pends on the mutex, which raises the low
+*               priority task's priority until it releases the mutex.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_EN > 0u)
+static  void  BenchMutexHiTask (void  *p_arg)
+{
+    CPU_INT64U  ts_start;
+    CPU_INT64U  ts;
+    OS_ERR      err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        ts_start = BenchTimeGet();
+        OSMutexPend(&BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        ts       = BenchTimeGet();
+        OSMutexPost(&BenchMutex, OS_OPT_POST_NONE, &err);
+        if (BenchSampleIx < BENCH_SAMPLE_QTY) {
+            BenchSampleTbl[BenchSampleIx] = ts - ts_start;
+        }
+    }
+}
+
+
+static  void  BenchMutexLoTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPend(&BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        (void)OSTaskSemPost(&BenchHiTCB, OS_OPT_POST_NONE, &err);
+        OSMutexPost(&BenchMutex, OS_OPT_POST_NONE, &err);
+    }
+}
+
+
+static  void  BenchMutexInherit (void)
+{
+    CPU_INT32U  ix;
+    OS_ERR      err;
+
+
+    OSMutexCreate(&BenchMutex, "Bench Mutex", &err);
+    BenchErrChk(err, "OSMutexCreate");
+    BenchTaskCreate(&BenchHiTCB, BenchMutexHiTask, (void *)0, BENCH_TASK_HI_PRIO, &BenchHiStk[0], BENCH_TASK_STK_SIZE);
+    BenchTaskCreate(&BenchLoTCB, BenchMutexLoTask, (void *)0, BENCH_TASK_LO_PRIO, &BenchLoStk[0], BENCH_TASK_STK_SIZE);
+
+    BenchSampleIx = BENCH_SAMPLE_QTY;
+    for (ix = 0u; ix < BENCH_SAMPLE_WARMUP_QTY; ix++) {
+        (void)OSTaskSemPost(&BenchLoTCB, OS_OPT_POST_NONE, &err);
+    }
+    for (ix = 0u; ix < BENCH_SAMPLE_QTY; ix++) {
+        BenchSampleIx = ix;
+        (void)OSTaskSemPost(&BenchLoTCB, OS_OPT_POST_NONE, &err);
+    }
+    BenchReport("mutex_inherit", 0u, BENCH_SAMPLE_QTY);
+
+    BenchTaskDel(&BenchHiTCB);
+    BenchTaskDel(&BenchLoTCB);
+    (void)OSMutexDel(&BenchMutex, OS_OPT_DEL_ALWAYS, &err);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          TICK LIST BENCH
+*********************************************************************************************************
+*/
+
+static  void  BenchTickListTask (void  *p_arg)
+{
+    OS_TICK  dly;
+    OS_ERR   err;
+
+
+    dly = (OS_TICK)((CPU_ADDR)p_arg % BENCH_DLY_MAX) + 1u;
+
+    for (;;) {
+        OSTimeDly(dly, OS_OPT_TIME_DLY, &err);
+    }
+}
+
+
+static  void  BenchTickList (CPU_INT32U  task_qty)
+{
+    CPU_INT32U  ix;
+    CPU_INT64U  ts_start;
+
+
+    for (ix = 0u; ix < task_qty; ix++) {
+        BenchTaskCreate(&BenchTaskTCB[ix],
+                         BenchTickListTask,
+                         (void *)(CPU_ADDR)ix,
+                         BENCH_TASK_SCALE_PRIO,
+                        &BenchTaskStk[ix][0],
+                         BENCH_TASK_STK_SIZE);
+    }
+
+    for (ix = 0u; ix < BENCH_SAMPLE_WARMUP_QTY; ix++) {
+        BenchTickISR();
+    }
+    for (ix = 0u; ix < BENCH_SAMPLE_TICK_QTY; ix++) {
+        ts_start           = BenchTimeGet();
+        BenchTickISR();                                         /* Returns once woken tasks delay again.                */
+        BenchSampleTbl[ix] = BenchTimeGet() - ts_start;
+    }
+    BenchReport("tick_list", task_qty, BENCH_SAMPLE_TICK_QTY);
+
+    for (ix = 0u; ix < task_qty; ix++) {
+        BenchTaskDel(&BenchTaskTCB[ix]);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            TIMER BENCH
+*
+* Note(s) : (1) The timer task normally runs below the bench task.  It is raised above it while timers
+*               are measured so that each sample includes the processing of the expired timers.
+*
+*           (2) With more timers than samples, only the last timers started and the first timers stopped
+*               are measured, i.e. those started or stopped with about 'tmr_qty' timers running.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_EN > 0u)
+static  void  BenchTmrCallback (void  *p_tmr,
+                                void  *p_arg)
+{
+    (void)p_tmr;
+    (void)p_arg;
+}
+
+
+static  void  BenchTmr (CPU_INT32U  tmr_qty)
+{
+    CPU_INT32U  ix;
+    CPU_INT32U  tick_ix;
+    CPU_INT32U  sample_qty;
+    CPU_INT64U  ts_start;
+    OS_ERR      err;
+
+
+    sample_qty = tmr_qty;                                       /* See Note #2.                                         */
+    if (sample_qty > BENCH_SAMPLE_QTY) {
+        sample_qty = BENCH_SAMPLE_QTY;
+    }
+
+    OSTaskChangePrio(&OSTmrTaskTCB, BENCH_TASK_TMR_PRIO, &err);/* See Note #1.                                         */
+    BenchErrChk(err, "OSTaskChangePrio");
+
+    for (ix = 0u; ix < tmr_qty; ix++) {
+        OSTmrCreate(&BenchTmrTbl[ix],
+                    "Bench Tmr",
+                     0u,
+                    (OS_TICK)(ix % BENCH_DLY_MAX) + 1u,
+                     OS_OPT_TMR_PERIODIC,
+                     BenchTmrCallback,
+                     (void *)0,
+                    &err);
+        BenchErrChk(err, "OSTmrCreate");
+    }
+
+    for (ix = 0u; ix < (tmr_qty - sample_qty); ix++) {
+        (void)OSTmrStart(&BenchTmrTbl[ix], &err);
+    }
+    for (ix = 0u; ix < sample_qty; ix++) {
+        ts_start           = BenchTimeGet();
+        (void)OSTmrStart(&BenchTmrTbl[(tmr_qty - sample_qty) + ix], &err);
+        BenchSampleTbl[ix] = BenchTimeGet() - ts_start;
+    }
+    BenchReport("tmr_start", tmr_qty, sample_qty);
+
+    for (ix = 0u; ix < BENCH_SAMPLE_TMR_QTY; ix++) {
+        ts_start           = BenchTimeGet();
+        for (tick_ix = 0u; tick_ix < (OSCfg_TickRate_Hz / OSCfg_TmrTaskRate_Hz); tick_ix++) {
+            BenchTickISR();
+        }
+        BenchSampleTbl[ix] = BenchTimeGet() - ts_start;
+    }
+    BenchReport("tmr_tick", tmr_qty, BENCH_SAMPLE_TMR_QTY);
+
+    for (ix = 0u; ix < sample_qty; ix++) {
+        ts_start           = BenchTimeGet();
+        (void)OSTmrStop(&BenchTmrTbl[ix], OS_OPT_TMR_NONE, (void *)0, &err);
+        BenchSampleTbl[ix] = BenchTimeGet() - ts_start;
+    }
+    BenchReport("tmr_stop", tmr_qty, sample_qty);
+    for (ix = sample_qty; ix < tmr_qty; ix++) {
+        (void)OSTmrStop(&BenchTmrTbl[ix], OS_OPT_TMR_NONE, (void *)0, &err);
+    }
+
+    for (ix = 0u; ix < tmr_qty; ix++) {
+        (void)OSTmrDel(&BenchTmrTbl[ix], &err);
+    }
+
+    OSTaskChangePrio(&OSTmrTaskTCB, OSCfg_TmrTaskPrio, &err);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchTickISR (void)                               /* Raised from the bench task, see Note #2.             */
+{
+    OSIntEnter();
+    OSTimeTick();
+    OSIntExit();
+}
+
+
+static  void  BenchTaskDel (OS_TCB  *p_tcb)
+{
+    OS_ERR  err;
+
+
+    OSTaskDel(p_tcb, &err);
+    BenchErrChk(err, "OSTaskDel");
+}
+
+
+static  void  BenchReport (const char  *p_name,
+                           CPU_INT32U   param,
+                           CPU_INT32U   sample_qty)
+{
+    CPU_INT32U  ix;
+    CPU_INT64U  sum;
+
+
+    qsort(BenchSampleTbl, sample_qty, sizeof(BenchSampleTbl[0u]), BenchCmp);
+
+    sum = 0u;
+    for (ix = 0u; ix < sample_qty; ix++) {
+        sum += BenchSampleTbl[ix];
+    }
+
+    if (BenchFmtJSON == OS_TRUE) {
+        printf("%s  {\"bench\": \"%s\", \"param\": %u, \"samples\": %u, "
+               "\"min_ns\": %llu, \"avg_ns\": %llu, \"p99_ns\": %llu, \"max_ns\": %llu}",
+               (BenchFmtFirst == OS_TRUE) ? "" : ",\r\n",
+               p_name,
+               (unsigned)param,
+               (unsigned)sample_qty,
+               (unsigned long long)BenchSampleTbl[0u],
+               (unsigned long long)(sum / sample_qty),
+               (unsigned long long)BenchSampleTbl[(sample_qty * 99u) / 100u],
+               (unsigned long long)BenchSampleTbl[sample_qty - 1u]);
+    } else {
+        printf("%s,%u,%u,%llu,%llu,%llu,%llu\r\n",
+               p_name,
+               (unsigned)param,
+               (unsigned)sample_qty,
+               (unsigned long long)BenchSampleTbl[0u],
+               (unsigned long long)(sum / sample_qty),
+               (unsigned long long)BenchSampleTbl[(sample_qty * 99u) / 100u],
+               (unsigned long long)BenchSampleTbl[sample_qty - 1u]);
+    }
+    BenchFmtFirst = OS_FALSE;
+    fflush(stdout);
+}
@@ -0,0 +1,208 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                           Memory Buffers
+*
+* Filename : bench_mem_buf.c
+*********************************************************************************************************
+* Note(s)  : (1) Each round, the bench task sends one BENCH_DATA_SIZE byte block to 'consumers' message
+*                queues, then receives it from each queue without blocking, either:
+*
+*                    copy     One OSMemGet() and copy of the data per queue, then OSQPost(); each receive is
+*                             an OSQPend() followed by OSMemPut().
+*                    ref      One OSMemBufGet() and copy of the data, OSMemBufRefAdd() of a reference per
+*                             additional queue, then OSQPost() to each queue; each receive is an OSQPend()
+*                             followed by OSMemBufRelease().
+*
+*                No task is ever readied, so each round only costs the sends and the receives.
+*
+*            (2) Needs OS_CFG_MEM_BUF_EN and an OS_CFG_MSG_POOL_SIZE of at least BENCH_CONS_MAX.  See bench.c
+*                for the build.
+*
+*            (3) Results are in nanoseconds per round, of the fastest run, see bench.c Note #3.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+
+#include  <stdio.h>
+#include  <string.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_ROUND_QTY                   100000u
+
+#define  BENCH_CONS_MAX                         8u
+#define  BENCH_DATA_SIZE                      256u
+#define  BENCH_BLK_SIZE                       (BENCH_DATA_SIZE + sizeof(OS_MEM_BUF))
+
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_MEM        BenchMem;                                 /* Partition of BenchMemStorage[] blocks                */
+static  void         *BenchMemStorage[BENCH_CONS_MAX][BENCH_BLK_SIZE / sizeof(void *)];
+static  OS_Q          BenchQ[BENCH_CONS_MAX];                   /* One queue per consumer                               */
+
+static  CPU_INT08U    BenchData[BENCH_DATA_SIZE];
+
+static  const  OS_OBJ_QTY  BenchConsTbl[] = { 1u, 4u, 8u };
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        BenchRun        (OS_OBJ_QTY   cons,
+                                     CPU_BOOLEAN  use_ref);
+static  void        BenchRunCopy    (void        *p_arg);
+static  void        BenchRunRef     (void        *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH TASK
+*
+* Description: The control task measures both ways of sharing a block with each number of consumers of
+*              BenchConsTbl[], see Note #1.
+*********************************************************************************************************
+*/
+
+void  BenchMain (int    argc,
+                 char  *argv[])
+{
+    CPU_INT32U  lvl;
+    OS_OBJ_QTY  ix;
+    OS_ERR      err;
+
+
+    (void)argc;
+    (void)argv;
+
+    OSMemCreate(&BenchMem, "Bench Mem", &BenchMemStorage[0][0], BENCH_CONS_MAX, BENCH_BLK_SIZE, &err);
+    BenchErrChk(err, "OSMemCreate");
+
+    for (ix = 0u; ix < BENCH_CONS_MAX; ix++) {
+        OSQCreate(&BenchQ[ix], "Bench Q", 1u, &err);
+        BenchErrChk(err, "OSQCreate");
+    }
+
+    printf("bench,mode,consumers,rounds,ns_per_round\r\n");
+
+    for (lvl = 0u; lvl < (sizeof(BenchConsTbl) / sizeof(BenchConsTbl[0])); lvl++) {
+        BenchRun(BenchConsTbl[lvl], OS_FALSE);
+        BenchRun(BenchConsTbl[lvl], OS_TRUE);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchRun (OS_OBJ_QTY   cons,
+                        CPU_BOOLEAN  use_ref)
+{
+    CPU_INT64U  ts_best;
+
+
+    ts_best = BenchRunBest((use_ref == OS_TRUE) ? BenchRunRef : BenchRunCopy, (void *)&cons);
+
+    printf("mem_buf,%s,%u,%u,%llu\r\n",
+           (use_ref == OS_TRUE) ? "ref" : "copy",
+           (unsigned)cons,
+           (unsigned)BENCH_ROUND_QTY,
+           (unsigned long long)(ts_best / BENCH_ROUND_QTY));
+}
+
+
+static  void  BenchRunCopy (void  *p_arg)
+{
+    OS_OBJ_QTY    cons;
+    CPU_INT32U    round;
+    OS_OBJ_QTY    ix;
+    void         *p_blk;
+    OS_MSG_SIZE   msg_size;
+    OS_ERR        err;
+
+
+    cons = *(OS_OBJ_QTY *)p_arg;
+    for (round = 0u; round < BENCH_ROUND_QTY; round++) {
+        for (ix = 0u; ix < cons; ix++) {
+            p_blk = OSMemGet(&BenchMem, &err);
+            memcpy(p_blk, &BenchData[0], BENCH_DATA_SIZE);
+            OSQPost(&BenchQ[ix], p_blk, BENCH_DATA_SIZE, OS_OPT_POST_FIFO, &err);
+        }
+        for (ix = 0u; ix < cons; ix++) {
+            p_blk = OSQPend(&BenchQ[ix], 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+            OSMemPut(&BenchMem, p_blk, &err);
+        }
+    }
+    BenchErrChk(err, "OSMemPut");
+}
+
+
+static  void  BenchRunRef (void  *p_arg)
+{
+    OS_OBJ_QTY    cons;
+    CPU_INT32U    round;
+    OS_OBJ_QTY    ix;
+    OS_MEM_BUF   *p_buf;
+    OS_MSG_SIZE   msg_size;
+    OS_ERR        err;
+
+
+    cons = *(OS_OBJ_QTY *)p_arg;
+    for (round = 0u; round < BENCH_ROUND_QTY; round++) {
+        p_buf = OSMemBufGet(&BenchMem, &err);
+        memcpy(p_buf->DataPtr, &BenchData[0], BENCH_DATA_SIZE);
+        p_buf->DataLen = BENCH_DATA_SIZE;
+        if (cons > 1u) {
+            OSMemBufRefAdd(p_buf, cons - 1u, &err);
+        }
+        for (ix = 0u; ix < cons; ix++) {
+            OSQPost(&BenchQ[ix], p_buf, BENCH_DATA_SIZE, OS_OPT_POST_FIFO, &err);
+        }
+        for (ix = 0u; ix < cons; ix++) {
+            p_buf = (OS_MEM_BUF *)OSQPend(&BenchQ[ix], 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+            OSMemBufRelease(p_buf, &err);
+        }
+    }
+    BenchErrChk(err, "OSMemBufRelease");
+}
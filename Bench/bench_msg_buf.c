@@ -0,0 +1,215 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                          Message Buffers
+*
+* Filename : bench_msg_buf.c
+*********************************************************************************************************
+* Note(s)  : (1) Each round, the bench task sends 'depth' records of 'size' bytes, then receives all of them
+*                without blocking, either:
+*
+*                    mem_q    OSMemGet() and a copy into the block, then OSQPost() of the block; OSQPend(), a
+*                             copy out of the block, then OSMemPut().
+*                    msg_buf  OSMsgBufPost() of the record, then OSMsgBufPend() into the receive buffer.
+*
+*                No task is ever readied, so each round only costs the sends and the receives.
+*
+*            (2) Needs OS_CFG_MSG_BUF_EN, OS_CFG_MEM_EN and an OS_CFG_MSG_POOL_SIZE of at least BENCH_DEPTH_MAX.
+*                See bench.c for the build.
+*
+*            (3) Results are in nanoseconds per record (one send and one receive), of the fastest run, see
+*                bench.c Note #3.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+
+#include  <stdio.h>
+#include  <string.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_MSG_QTY                     200000u              /* Records per run, at every depth and size.            */
+
+#define  BENCH_DEPTH_MAX                       16u
+#define  BENCH_SIZE_MAX                        64u
+#define  BENCH_BUF_SIZE        (BENCH_DEPTH_MAX * (BENCH_SIZE_MAX + OS_MSG_BUF_HDR_SIZE))
+
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_MEM        BenchMem;                                 /* Partition of BenchMemStorage[] blocks                */
+static  CPU_INT08U    BenchMemStorage[BENCH_DEPTH_MAX][BENCH_SIZE_MAX];
+static  OS_Q          BenchQ;                                   /* Queue of blocks from BenchMem                        */
+
+static  OS_MSG_BUF    BenchMsgBuf;                              /* Message buffer using BenchBufStorage[]               */
+static  CPU_INT08U    BenchBufStorage[BENCH_BUF_SIZE];
+
+static  CPU_INT08U    BenchTxData[BENCH_SIZE_MAX];
+static  CPU_INT08U    BenchRxData[BENCH_SIZE_MAX];
+
+static  OS_MSG_QTY    BenchDepth;                               /* Depth of the current run                             */
+static  OS_MSG_SIZE   BenchSize;                                /* Size of the records of the current run               */
+
+static  const  OS_MSG_QTY   BenchDepthTbl[] = { 1u, 16u };
+static  const  OS_MSG_SIZE  BenchSizeTbl[]  = { 8u, 64u };
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        BenchRun        (OS_MSG_QTY    depth,
+                                     OS_MSG_SIZE   size,
+                                     CPU_BOOLEAN   use_buf);
+static  void        BenchRunMemQ    (void         *p_arg);
+static  void        BenchRunMsgBuf  (void         *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH TASK
+*
+* Description: The control task measures both ways of sending records at each depth of BenchDepthTbl[] and
+*              each size of BenchSizeTbl[], see Note #1.
+*********************************************************************************************************
+*/
+
+void  BenchMain (int    argc,
+                 char  *argv[])
+{
+    CPU_INT32U  lvl_depth;
+    CPU_INT32U  lvl_size;
+    OS_ERR      err;
+
+
+    (void)argc;
+    (void)argv;
+
+    OSMemCreate(&BenchMem, "Bench Mem", &BenchMemStorage[0][0], BENCH_DEPTH_MAX, BENCH_SIZE_MAX, &err);
+    BenchErrChk(err, "OSMemCreate");
+
+    OSQCreate(&BenchQ, "Bench Q", BENCH_DEPTH_MAX, &err);
+    BenchErrChk(err, "OSQCreate");
+
+    OSMsgBufCreate(&BenchMsgBuf, "Bench Msg Buf", &BenchBufStorage[0], BENCH_BUF_SIZE, &err);
+    BenchErrChk(err, "OSMsgBufCreate");
+
+    printf("bench,mode,depth,size,msgs,ns_per_msg\r\n");
+
+    for (lvl_depth = 0u; lvl_depth < (sizeof(BenchDepthTbl) / sizeof(BenchDepthTbl[0])); lvl_depth++) {
+        for (lvl_size = 0u; lvl_size < (sizeof(BenchSizeTbl) / sizeof(BenchSizeTbl[0])); lvl_size++) {
+            BenchRun(BenchDepthTbl[lvl_depth], BenchSizeTbl[lvl_size], OS_FALSE);
+            BenchRun(BenchDepthTbl[lvl_depth], BenchSizeTbl[lvl_size], OS_TRUE);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchRun (OS_MSG_QTY    depth,
+                        OS_MSG_SIZE   size,
+                        CPU_BOOLEAN   use_buf)
+{
+    CPU_INT64U  ts_best;
+
+
+    BenchDepth = depth;
+    BenchSize  = size;
+    ts_best    = BenchRunBest((use_buf == OS_TRUE) ? BenchRunMsgBuf : BenchRunMemQ, (void *)0);
+
+    printf("msg_buf,%s,%u,%u,%u,%llu\r\n",
+           (use_buf == OS_TRUE) ? "msg_buf" : "mem_q",
+           (unsigned)depth,
+           (unsigned)size,
+           (unsigned)BENCH_MSG_QTY,
+           (unsigned long long)(ts_best / BENCH_MSG_QTY));
+}
+
+
+static  void  BenchRunMemQ (void  *p_arg)
+{
+    CPU_INT32U    round;
+    OS_MSG_QTY    ix;
+    OS_MSG_SIZE   msg_size;
+    void         *p_blk;
+    OS_ERR        err;
+
+
+    (void)p_arg;
+
+    for (round = 0u; round < (BENCH_MSG_QTY / BenchDepth); round++) {
+        for (ix = 0u; ix < BenchDepth; ix++) {
+            p_blk = OSMemGet(&BenchMem, &err);
+            memcpy(p_blk, &BenchTxData[0], BenchSize);
+            OSQPost(&BenchQ, p_blk, BenchSize, OS_OPT_POST_FIFO, &err);
+        }
+        for (ix = 0u; ix < BenchDepth; ix++) {
+            p_blk = OSQPend(&BenchQ, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+            memcpy(&BenchRxData[0], p_blk, msg_size);
+            OSMemPut(&BenchMem, p_blk, &err);
+        }
+    }
+    BenchErrChk(err, "OSMemPut");
+}
+
+
+static  void  BenchRunMsgBuf (void  *p_arg)
+{
+    CPU_INT32U    round;
+    OS_MSG_QTY    ix;
+    OS_ERR        err;
+
+
+    (void)p_arg;
+
+    for (round = 0u; round < (BENCH_MSG_QTY / BenchDepth); round++) {
+        for (ix = 0u; ix < BenchDepth; ix++) {
+            OSMsgBufPost(&BenchMsgBuf, &BenchTxData[0], BenchSize, 0u, OS_OPT_PEND_NON_BLOCKING, &err);
+        }
+        for (ix = 0u; ix < BenchDepth; ix++) {
+            (void)OSMsgBufPend(&BenchMsgBuf, &BenchRxData[0], BENCH_SIZE_MAX, 0u, OS_OPT_PEND_NON_BLOCKING, &err);
+        }
+    }
+    BenchErrChk(err, "OSMsgBufPend");
+}
@@ -0,0 +1,192 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                        Preemption Threshold
+*
+* Filename : bench_preempt_thres.c
+*********************************************************************************************************
+* Note(s)  : (1) A producer posts batches of BENCH_BATCH_QTY messages to a higher priority consumer through
+*                the consumer's task queue, then waits for the consumer to acknowledge the batch.  Without a
+*                threshold, each post switches to the consumer and back.  With the producer's threshold at
+*                the consumer's priority, the consumer only runs once the producer waits, which costs two
+*                context switches per batch.
+*
+*            (2) Needs OS_CFG_SCHED_PREEMPT_THRES_EN, and either OS_CFG_TASK_PROFILE_EN or OS_CFG_DBG_EN for
+*                OSTaskCtxSwCtr.  OS_CFG_MSG_POOL_SIZE must hold a batch.  See bench.c for the build.
+*
+*            (3) The result lines report, without then with the threshold, the context switches and the
+*                nanoseconds per batch, the latter of the fastest run, see bench.c Note #3.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+
+#include  <stdio.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_ROUND_QTY                    10000u
+#define  BENCH_BATCH_QTY                       16u
+
+#define  BENCH_TASK_STK_SIZE                 4096u
+#define  BENCH_TASK_CONS_PRIO                  10u
+#define  BENCH_TASK_PROD_PRIO                  12u              /* The control task, while it produces.                 */
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB       BenchConsTCB;
+static  CPU_STK      BenchConsStk[BENCH_TASK_STK_SIZE];
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  BenchConsTask  (void        *p_arg);
+
+static  void  BenchRun       (const  char  *p_mode);
+static  void  BenchRunRounds (void        *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH TASKS
+*
+* Description: The control task is the producer and runs the batches without then with a preemption
+*              threshold, see Note #1.  The consumer acknowledges the last message of each batch.
+*********************************************************************************************************
+*/
+
+void  BenchMain (int    argc,
+                 char  *argv[])
+{
+    OS_ERR  err;
+
+
+    (void)argc;
+    (void)argv;
+
+    OSTaskCreate(&BenchConsTCB,                                 /* The consumer needs a task queue.                     */
+                 "Bench Cons",
+                  BenchConsTask,
+                  0u,
+                  BENCH_TASK_CONS_PRIO,
+                 &BenchConsStk[0u],
+                  BENCH_TASK_STK_SIZE / 10u,
+                  BENCH_TASK_STK_SIZE,
+                  BENCH_BATCH_QTY,
+                  0u,
+                  0u,
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 &err);
+    BenchErrChk(err, "OSTaskCreate");
+
+    OSTaskChangePrio((OS_TCB *)0, BENCH_TASK_PROD_PRIO, &err);
+    BenchErrChk(err, "OSTaskChangePrio");
+
+    printf("bench,mode,batch,rounds,ctx_sw_per_batch,ns_per_batch\r\n");
+
+    BenchRun("none");
+
+    OSTaskPreemptThresSet((OS_TCB *)0, BENCH_TASK_CONS_PRIO, &err);
+    BenchErrChk(err, "OSTaskPreemptThresSet");
+
+    BenchRun("thres");
+}
+
+
+static  void  BenchConsTask (void  *p_arg)
+{
+    void         *p_msg;
+    OS_MSG_SIZE   msg_size;
+    OS_ERR        err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        p_msg = OSTaskQPend(0u, OS_OPT_PEND_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        if (msg_size == (BENCH_BATCH_QTY - 1u)) {               /* Acknowledge the last message of the batch.           */
+            (void)OSTaskSemPost(&BenchCtrlTCB, OS_OPT_POST_NONE, &err);
+        }
+        (void)p_msg;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchRun (const  char  *p_mode)
+{
+    OS_CTX_SW_CTR  ctx_sw_ctr;
+    CPU_INT64U     ts_best;
+
+
+    ctx_sw_ctr = OSTaskCtxSwCtr;
+    ts_best    = BenchRunBest(BenchRunRounds, (void *)0);
+    ctx_sw_ctr = OSTaskCtxSwCtr - ctx_sw_ctr;
+
+    printf("preempt_thres,%s,%u,%u,%.1f,%llu\r\n",
+           p_mode,
+           (unsigned)BENCH_BATCH_QTY,
+           (unsigned)BENCH_ROUND_QTY,
+           (double)ctx_sw_ctr / (double)(BENCH_RUN_QTY * BENCH_ROUND_QTY),
+           (unsigned long long)(ts_best / BENCH_ROUND_QTY));
+}
+
+
+static  void  BenchRunRounds (void  *p_arg)
+{
+    CPU_INT32U   round;
+    OS_MSG_SIZE  ix;
+    OS_ERR       err;
+
+
+    (void)p_arg;
+
+    for (round = 0u; round < BENCH_ROUND_QTY; round++) {
+        for (ix = 0u; ix < BENCH_BATCH_QTY; ix++) {             /* The message size carries its index in the batch.     */
+            OSTaskQPost(&BenchConsTCB, (void *)0, ix, OS_OPT_POST_FIFO, &err);
+        }
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+}
@@ -0,0 +1,293 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                      Batch Queue Post and Pend
+*
+* Filename : bench_q_multi.c
+*********************************************************************************************************
+* Note(s)  : (1) Each round, the bench task sends 'batch' messages to a message queue, either:
+*
+*                    single   One OSQPost() per message.
+*                    multi    One OSQPostMulti() for all the messages.
+*
+*                The messages are received, in the same way (OSQPend() or OSQPendMulti()), by either:
+*
+*                    self     The bench task itself, without blocking, after the posts.  No task is ever
+*                             readied.
+*                    task     A higher priority consumer task, which waits on the queue.  With single posts,
+*                             each post switches to the consumer; with a batch, only the first message
+*                             readies it, and it receives the rest of the batch when it gets to run.
+*
+*            (2) Needs OS_CFG_Q_MULTI_EN and an OS_CFG_MSG_POOL_SIZE of at least BENCH_BATCH_MAX, i.e. 64,
+*                above the 32 of Cfg/Template/os_cfg_app.h.  See bench.c for the build.
+*
+*            (3) Results are in nanoseconds per message, of the fastest run, see bench.c Note #3.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+
+#include  <stdio.h>
+#include  <stdlib.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_MSG_QTY                     128000u              /* Messages per run, at every batch size.               */
+
+#define  BENCH_BATCH_MAX                       64u
+#define  BENCH_CONS_STK_SIZE                 4096u
+
+#define  BENCH_TASK_CONS_PRIO                  20u
+
+#if (OS_CFG_MSG_POOL_SIZE < BENCH_BATCH_MAX)
+#error  "bench_q_multi.c, OS_CFG_MSG_POOL_SIZE must hold BENCH_BATCH_MAX messages for a batch, see Note #2"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB        BenchConsSingleTCB;
+static  CPU_STK       BenchConsSingleStk[BENCH_CONS_STK_SIZE];
+static  OS_TCB        BenchConsMultiTCB;
+static  CPU_STK       BenchConsMultiStk[BENCH_CONS_STK_SIZE];
+
+static  OS_Q          BenchQSelf;                               /* Queue received from by the bench task                */
+static  OS_Q          BenchQSingle;                             /* Queue received from by BenchConsSingleTask()         */
+static  OS_Q          BenchQMulti;                              /* Queue received from by BenchConsMultiTask()          */
+
+static  void         *BenchMsgTbl[BENCH_BATCH_MAX];
+static  OS_MSG_SIZE   BenchMsgSizeTbl[BENCH_BATCH_MAX];
+
+static  CPU_INT32U    BenchConsCtr;                             /* Messages received by the consumer tasks              */
+static  OS_MSG_QTY    BenchBatch;                               /* Batch size of the current run                        */
+
+static  const  OS_MSG_QTY  BenchBatchTbl[] = { 1u, 8u, 64u };
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        BenchConsSingleTask   (void         *p_arg);
+
+static  void        BenchConsMultiTask    (void         *p_arg);
+
+static  void        BenchRun              (OS_MSG_QTY    batch,
+                                           CPU_BOOLEAN   use_multi,
+                                           CPU_BOOLEAN   use_task);
+static  void        BenchRunSingle        (void         *p_arg);
+static  void        BenchRunMulti         (void         *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH TASKS
+*
+* Description: The control task measures both ways of sending and receiving messages at each batch size of
+*              BenchBatchTbl[], see Note #1.  The consumer tasks receive the messages sent to their queue.
+*********************************************************************************************************
+*/
+
+void  BenchMain (int    argc,
+                 char  *argv[])
+{
+    CPU_INT32U  lvl;
+    OS_ERR      err;
+
+
+    (void)argc;
+    (void)argv;
+
+    OSQCreate(&BenchQSelf, "Bench Q Self", BENCH_BATCH_MAX, &err);
+    BenchErrChk(err, "OSQCreate");
+
+    OSQCreate(&BenchQSingle, "Bench Q Single", BENCH_BATCH_MAX, &err);
+    BenchErrChk(err, "OSQCreate");
+
+    OSQCreate(&BenchQMulti, "Bench Q Multi", BENCH_BATCH_MAX, &err);
+    BenchErrChk(err, "OSQCreate");
+
+    BenchTaskCreate(&BenchConsSingleTCB,
+                     BenchConsSingleTask,
+                     (void *)0,
+                     BENCH_TASK_CONS_PRIO,
+                    &BenchConsSingleStk[0u],
+                     BENCH_CONS_STK_SIZE);
+
+    BenchTaskCreate(&BenchConsMultiTCB,
+                     BenchConsMultiTask,
+                     (void *)0,
+                     BENCH_TASK_CONS_PRIO,
+                    &BenchConsMultiStk[0u],
+                     BENCH_CONS_STK_SIZE);
+
+    printf("bench,mode,receiver,batch,msgs,ns_per_msg\r\n");
+
+    for (lvl = 0u; lvl < (sizeof(BenchBatchTbl) / sizeof(BenchBatchTbl[0])); lvl++) {
+        BenchRun(BenchBatchTbl[lvl], OS_FALSE, OS_FALSE);
+        BenchRun(BenchBatchTbl[lvl], OS_TRUE,  OS_FALSE);
+        BenchRun(BenchBatchTbl[lvl], OS_FALSE, OS_TRUE);
+        BenchRun(BenchBatchTbl[lvl], OS_TRUE,  OS_TRUE);
+    }
+}
+
+
+static  void  BenchConsSingleTask (void  *p_arg)
+{
+    OS_MSG_SIZE  msg_size;
+    OS_ERR       err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSQPend(&BenchQSingle, 0u, OS_OPT_PEND_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        if (err == OS_ERR_NONE) {
+            BenchConsCtr++;
+        }
+    }
+}
+
+
+static  void  BenchConsMultiTask (void  *p_arg)
+{
+    void         *msg_tbl[BENCH_BATCH_MAX];
+    OS_MSG_SIZE   msg_size_tbl[BENCH_BATCH_MAX];
+    OS_MSG_QTY    nbr_msgs;
+    OS_ERR        err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        nbr_msgs      = OSQPendMulti(&BenchQMulti,
+                                     &msg_tbl[0],
+                                     &msg_size_tbl[0],
+                                      BENCH_BATCH_MAX,
+                                      0u,
+                                      OS_OPT_PEND_BLOCKING,
+                                     (CPU_TS *)0,
+                                     &err);
+        BenchConsCtr += nbr_msgs;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchRun (OS_MSG_QTY    batch,
+                        CPU_BOOLEAN   use_multi,
+                        CPU_BOOLEAN   use_task)
+{
+    OS_Q        *p_q;
+    CPU_INT64U   ts_best;
+
+
+    if (use_task == OS_FALSE) {
+        p_q = &BenchQSelf;
+    } else if (use_multi == OS_FALSE) {
+        p_q = &BenchQSingle;
+    } else {
+        p_q = &BenchQMulti;
+    }
+
+    BenchBatch = batch;
+    ts_best    = BenchRunBest((use_multi == OS_TRUE) ? BenchRunMulti : BenchRunSingle, (void *)p_q);
+
+    printf("q_multi,%s,%s,%u,%u,%llu\r\n",
+           (use_multi == OS_TRUE) ? "multi" : "single",
+           (use_task  == OS_TRUE) ? "task"  : "self",
+           (unsigned)batch,
+           (unsigned)BENCH_MSG_QTY,
+           (unsigned long long)(ts_best / BENCH_MSG_QTY));
+}
+
+
+static  void  BenchRunSingle (void  *p_arg)
+{
+    OS_Q        *p_q;
+    CPU_INT32U   round;
+    OS_MSG_QTY   ix;
+    OS_ERR       err;
+
+
+    p_q          = (OS_Q *)p_arg;
+    BenchConsCtr = 0u;
+    for (round = 0u; round < (BENCH_MSG_QTY / BenchBatch); round++) {
+        for (ix = 0u; ix < BenchBatch; ix++) {
+            OSQPost(p_q, BenchMsgTbl[ix], BenchMsgSizeTbl[ix], OS_OPT_POST_FIFO, &err);
+            BenchErrChk(err, "OSQPost");
+        }
+        if (p_q == &BenchQSelf) {
+            for (ix = 0u; ix < BenchBatch; ix++) {
+                BenchMsgTbl[ix] = OSQPend(p_q, 0u, OS_OPT_PEND_NON_BLOCKING, &BenchMsgSizeTbl[ix], (CPU_TS *)0, &err);
+            }
+            BenchErrChk(err, "OSQPend");
+        }
+    }
+    if ((p_q != &BenchQSelf) && (BenchConsCtr != BENCH_MSG_QTY)) {
+        exit(1);
+    }
+}
+
+
+static  void  BenchRunMulti (void  *p_arg)
+{
+    OS_Q        *p_q;
+    CPU_INT32U   round;
+    OS_ERR       err;
+
+
+    p_q          = (OS_Q *)p_arg;
+    BenchConsCtr = 0u;
+    for (round = 0u; round < (BENCH_MSG_QTY / BenchBatch); round++) {
+        (void)OSQPostMulti(p_q, &BenchMsgTbl[0], &BenchMsgSizeTbl[0], BenchBatch, OS_OPT_POST_FIFO, &err);
+        BenchErrChk(err, "OSQPostMulti");
+        if (p_q == &BenchQSelf) {
+            (void)OSQPendMulti(p_q, &BenchMsgTbl[0], &BenchMsgSizeTbl[0], BenchBatch,
+                               0u, OS_OPT_PEND_NON_BLOCKING, (CPU_TS *)0, &err);
+            BenchErrChk(err, "OSQPendMulti");
+        }
+    }
+    if ((p_q != &BenchQSelf) && (BenchConsCtr != BENCH_MSG_QTY)) {
+        exit(1);
+    }
+}
@@ -0,0 +1,228 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                  Queue Back-Pressure (OSQPostWait)
+*
+* Filename : bench_q_post_wait.c
+*********************************************************************************************************
+* Note(s)  : (1) The bench task produces BENCH_MSG_QTY messages into a queue of 'depth' entries, drained by a
+*                lower priority consumer task.  When the queue is full, the producer either:
+*
+*                    poll         Gets OS_ERR_Q_MAX from OSQPost(), sleeps one tick with OSTimeDly() and retries.
+*                    wait         Blocks in OSQPostWait() until the consumer, in OSQPend(), takes a message.
+*                    wait_multi   Same, with the consumer in OSPendMulti() instead.
+*
+*                Each mode reports the time per message accepted by the queue and the number of failed posts
+*                per message, i.e. the calls the producer wasted on a full queue.  A producer left waiting on a
+*                full queue fails with OS_ERR_TIMEOUT after BENCH_POST_TIMEOUT ticks instead of hanging.
+*
+*            (2) Needs OS_CFG_Q_POST_WAIT_EN, OS_CFG_PEND_MULTI_EN and an OS_CFG_MSG_POOL_SIZE of at least
+*                BENCH_DEPTH_MAX.  The polling results scale with OS_CFG_TICK_RATE_HZ.  See bench.c for the
+*                build.
+*
+*            (3) Results are in nanoseconds per message, of the fastest of BENCH_RUN_QTY runs, see bench.c
+*                Note #3.  The runs are timed here rather than by BenchRunBest(), since the consumer gets a
+*                tick to drain the queue before each of them.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+
+#include  <stdio.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_MSG_QTY                        500u              /* Messages per run, at every depth.                    */
+
+#define  BENCH_DEPTH_MAX                       16u
+#define  BENCH_POST_TIMEOUT                   100u              /* Ticks, see Note #1.                                  */
+
+#define  BENCH_MODE_POLL                        0u
+#define  BENCH_MODE_WAIT                        1u
+#define  BENCH_MODE_WAIT_MULTI                  2u
+#define  BENCH_MODE_QTY                         3u
+
+#define  BENCH_TASK_STK_SIZE                 4096u
+
+#define  BENCH_TASK_PROD_PRIO                  20u              /* The producer, i.e. the control task, ...             */
+#define  BENCH_TASK_CONS_PRIO                  25u              /* ... runs ahead of the consumer.                      */
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB        BenchConsTCB;
+static  CPU_STK       BenchConsStk[BENCH_TASK_STK_SIZE];
+
+static  OS_Q          BenchQ;
+static  CPU_INT32U    BenchConsCtr;                             /* Messages received by the consumer.                   */
+static  CPU_INT08U    BenchMode;                                /* BENCH_MODE_xxx of the run, see Note #1.              */
+
+static  const  OS_MSG_QTY  BenchDepthTbl[] = { 1u, 4u, BENCH_DEPTH_MAX };
+
+static  const  char       *BenchModeNameTbl[BENCH_MODE_QTY] = { "poll", "wait", "wait_multi" };
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        BenchConsTask   (void        *p_arg);
+
+static  void        BenchRun        (OS_MSG_QTY   depth,
+                                     CPU_INT08U   mode);
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH TASKS
+*
+* Description: The control task creates a queue of each depth of BenchDepthTbl[] and measures each mode of
+*              producing into it, with a new consumer task draining it in each mode, see Note #1.
+*********************************************************************************************************
+*/
+
+void  BenchMain (int    argc,
+                 char  *argv[])
+{
+    CPU_INT32U  lvl;
+    OS_ERR      err;
+
+
+    (void)argc;
+    (void)argv;
+
+    OSTaskChangePrio((OS_TCB *)0, BENCH_TASK_PROD_PRIO, &err);
+    BenchErrChk(err, "OSTaskChangePrio");
+
+    OS_CPU_SysTickInit();                                       /* The polling producer sleeps on ticks.                */
+
+    printf("bench,mode,depth,msgs,ns_per_msg,failed_posts_per_msg\r\n");
+
+    for (lvl = 0u; lvl < (sizeof(BenchDepthTbl) / sizeof(BenchDepthTbl[0])); lvl++) {
+        OSQCreate(&BenchQ, "Bench Q", BenchDepthTbl[lvl], &err);
+        BenchErrChk(err, "OSQCreate");
+        for (BenchMode = 0u; BenchMode < BENCH_MODE_QTY; BenchMode++) {
+            BenchTaskCreate(&BenchConsTCB,
+                             BenchConsTask,
+                             (void *)0,
+                             BENCH_TASK_CONS_PRIO,
+                            &BenchConsStk[0u],
+                             BENCH_TASK_STK_SIZE);
+            BenchRun(BenchDepthTbl[lvl], BenchMode);
+            OSTaskDel(&BenchConsTCB, &err);
+        }
+        (void)OSQDel(&BenchQ, OS_OPT_DEL_ALWAYS, &err);
+    }
+}
+
+
+static  void  BenchConsTask (void  *p_arg)
+{
+    OS_PEND_DATA  pend_data;
+    OS_MSG_SIZE   msg_size;
+    OS_ERR        err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        if (BenchMode == BENCH_MODE_WAIT_MULTI) {
+            pend_data.PendObjPtr = (OS_PEND_OBJ *)((void *)&BenchQ);
+            (void)OSPendMulti(&pend_data, 1u, 0u, OS_OPT_PEND_BLOCKING, &err);
+        } else {
+            (void)OSQPend(&BenchQ, 0u, OS_OPT_PEND_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        }
+        BenchConsCtr++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchRun (OS_MSG_QTY   depth,
+                        CPU_INT08U   mode)
+{
+    CPU_INT32U  run;
+    CPU_INT32U  msg;
+    CPU_INT32U  fail_ctr;
+    CPU_INT32U  fail_best;
+    CPU_INT64U  ts_start;
+    CPU_INT64U  ts_delta;
+    CPU_INT64U  ts_best;
+    OS_ERR      err;
+
+
+    ts_best   = 0u;
+    fail_best = 0u;
+    for (run = 0u; run < BENCH_RUN_QTY; run++) {
+        OSTimeDly(1u, OS_OPT_TIME_DLY, &err);                   /* Let the consumer drain the previous run.             */
+        fail_ctr = 0u;
+        ts_start = BenchTimeGet();
+        for (msg = 0u; msg < BENCH_MSG_QTY; msg++) {
+            if (mode != BENCH_MODE_POLL) {
+                OSQPostWait(&BenchQ, (void *)0, 0u, BENCH_POST_TIMEOUT, OS_OPT_POST_FIFO, &err);
+            } else {
+                for (;;) {
+                    OSQPost(&BenchQ, (void *)0, 0u, OS_OPT_POST_FIFO, &err);
+                    if (err != OS_ERR_Q_MAX) {
+                        break;
+                    }
+                    fail_ctr++;
+                    OSTimeDly(1u, OS_OPT_TIME_DLY, &err);       /* Give the consumer a tick to make room                */
+                }
+            }
+            BenchErrChk(err, (mode != BENCH_MODE_POLL) ? "OSQPostWait" : "OSQPost");
+        }
+        ts_delta = BenchTimeGet() - ts_start;
+        if ((run == 0u) || (ts_delta < ts_best)) {
+            ts_best   = ts_delta;
+            fail_best = fail_ctr;
+        }
+    }
+
+    printf("q_post_wait,%s,%u,%u,%llu,%.3f\r\n",
+           BenchModeNameTbl[mode],
+           (unsigned)depth,
+           (unsigned)BENCH_MSG_QTY,
+           (unsigned long long)(ts_best / BENCH_MSG_QTY),
+           (double)fail_best / (double)BENCH_MSG_QTY);
+}
+
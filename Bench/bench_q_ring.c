@@ -0,0 +1,168 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                        Ring Message Queues
+*
+* Filename : bench_q_ring.c
+*********************************************************************************************************
+* Note(s)  : (1) Each round, the bench task posts 'depth' messages to a message queue, then pends on all of
+*                them without blocking.  The queue is either:
+*
+*                    pool     Created with OSQCreate(), each message takes an OS_MSG from OSMsgPool.
+*                    ring     Created with OSQCreateRing(), each message uses the next slot of the ring.
+*
+*                No task is ever readied, so each round only costs the posts and the pends.
+*
+*            (2) Needs OS_CFG_Q_RING_EN and an OS_CFG_MSG_POOL_SIZE of at least BENCH_DEPTH_MAX, i.e. 64,
+*                above the 32 of Cfg/Template/os_cfg_app.h.  See bench.c for the build.
+*
+*            (3) Results are in nanoseconds per message (one post and one pend), of the fastest run, see
+*                bench.c Note #3.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+
+#include  <stdio.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_MSG_QTY                     200000u              /* Messages per run, at every depth.                    */
+
+#define  BENCH_DEPTH_MAX                       64u
+
+#if (OS_CFG_MSG_POOL_SIZE < BENCH_DEPTH_MAX)
+#error  "bench_q_ring.c, OS_CFG_MSG_POOL_SIZE must hold BENCH_DEPTH_MAX messages for the pool queue, see Note #2"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_Q          BenchQPool;                               /* Queue using OSMsgPool                                */
+static  OS_Q          BenchQRing;                               /* Queue using BenchRing[]                              */
+static  OS_MSG        BenchRing[BENCH_DEPTH_MAX];
+static  OS_MSG_QTY    BenchDepth;                               /* Depth of the current run                             */
+
+static  const  OS_MSG_QTY  BenchDepthTbl[] = { 1u, 8u, 64u };
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        BenchRun        (OS_Q        *p_q,
+                                     OS_MSG_QTY   depth);
+static  void        BenchRunRounds  (void        *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH TASK
+*
+* Description: The control task measures both kinds of queues at each depth of BenchDepthTbl[], see Note #1.
+*********************************************************************************************************
+*/
+
+void  BenchMain (int    argc,
+                 char  *argv[])
+{
+    CPU_INT32U  lvl;
+    OS_ERR      err;
+
+
+    (void)argc;
+    (void)argv;
+
+    OSQCreate(&BenchQPool, "Bench Q Pool", BENCH_DEPTH_MAX, &err);
+    BenchErrChk(err, "OSQCreate");
+
+    OSQCreateRing(&BenchQRing, "Bench Q Ring", &BenchRing[0], BENCH_DEPTH_MAX, &err);
+    BenchErrChk(err, "OSQCreateRing");
+
+    printf("bench,mode,depth,msgs,ns_per_msg\r\n");
+
+    for (lvl = 0u; lvl < (sizeof(BenchDepthTbl) / sizeof(BenchDepthTbl[0])); lvl++) {
+        BenchRun(&BenchQPool, BenchDepthTbl[lvl]);
+        BenchRun(&BenchQRing, BenchDepthTbl[lvl]);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchRun (OS_Q        *p_q,
+                        OS_MSG_QTY   depth)
+{
+    CPU_INT64U  ts_best;
+
+
+    BenchDepth = depth;
+    ts_best    = BenchRunBest(BenchRunRounds, (void *)p_q);
+
+    printf("q_ring,%s,%u,%u,%llu\r\n",
+           (p_q == &BenchQRing) ? "ring" : "pool",
+           (unsigned)depth,
+           (unsigned)BENCH_MSG_QTY,
+           (unsigned long long)(ts_best / BENCH_MSG_QTY));
+}
+
+
+static  void  BenchRunRounds (void  *p_arg)
+{
+    OS_Q         *p_q;
+    CPU_INT32U    round;
+    OS_MSG_QTY    ix;
+    OS_MSG_SIZE   msg_size;
+    OS_ERR        err;
+
+
+    p_q = (OS_Q *)p_arg;
+    for (round = 0u; round < (BENCH_MSG_QTY / BenchDepth); round++) {
+        for (ix = 0u; ix < BenchDepth; ix++) {
+            OSQPost(p_q, (void *)0, 0u, OS_OPT_POST_FIFO, &err);
+            BenchErrChk(err, "OSQPost");
+        }
+        for (ix = 0u; ix < BenchDepth; ix++) {
+            (void)OSQPend(p_q, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        }
+    }
+    BenchErrChk(err, "OSQPend");
+}
@@ -0,0 +1,200 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      uC/OS-III HOST BENCHMARKS
+*                                             Queue Sets
+*
+* Filename : bench_q_set.c
+*********************************************************************************************************
+* Note(s)  : (1) The bench task serves 'queues' message queues.  Each round, it posts one message to one of
+*                the queues, spread with BENCH_Q_STRIDE, then receives it, either:
+*
+*                    poll     Rotating OSQPend(..., OS_OPT_PEND_NON_BLOCKING) over the queues, from the one
+*                             after the last queue served, until a message is found.
+*                    set      OSQSetPend() on the queue set of all the queues, then OSQPend() on the queue
+*                             returned.
+*
+*                No task is ever readied, so each round only costs the post and the look up of the message.
+*
+*            (2) Needs OS_CFG_Q_SET_EN.  See bench.c for the build.
+*
+*            (3) Results are in nanoseconds per message, of the fastest run, see bench.c Note #3.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "bench.h"
+
+#include  <stdio.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_ROUND_QTY                    20000u
+
+#define  BENCH_Q_QTY_MAX                      256u
+#define  BENCH_Q_STRIDE                        37u              /* Prime, so that all the queues get posted to.         */
+
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_Q          BenchQPoll[BENCH_Q_QTY_MAX];              /* Queues served by polling                             */
+static  OS_Q          BenchQSetQ[BENCH_Q_QTY_MAX];              /* Queues served through BenchQSet                      */
+static  OS_Q_SET      BenchQSet;
+
+static  const  OS_OBJ_QTY  BenchQQtyTbl[] = { 1u, 16u, 64u, 256u };
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        BenchRun        (OS_OBJ_QTY   q_qty,
+                                     CPU_BOOLEAN  use_set);
+static  void        BenchRunPoll    (void        *p_arg);
+static  void        BenchRunSet     (void        *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                             BENCH TASK
+*
+* Description: The control task adds queues to the queue set up to each count of BenchQQtyTbl[] and
+*              measures both ways of serving them, see Note #1.
+*********************************************************************************************************
+*/
+
+void  BenchMain (int    argc,
+                 char  *argv[])
+{
+    OS_OBJ_QTY   q_qty;
+    CPU_INT32U   lvl;
+    OS_ERR       err;
+
+
+    (void)argc;
+    (void)argv;
+
+    OSQSetCreate(&BenchQSet, "Bench Q Set", BENCH_Q_QTY_MAX, &err);
+    BenchErrChk(err, "OSQSetCreate");
+
+    printf("bench,mode,queues,rounds,ns_per_msg\r\n");
+
+    q_qty = 0u;
+    for (lvl = 0u; lvl < (sizeof(BenchQQtyTbl) / sizeof(BenchQQtyTbl[0])); lvl++) {
+        while (q_qty < BenchQQtyTbl[lvl]) {
+            OSQCreate(&BenchQPoll[q_qty], "Bench Q Poll", 1u, &err);
+            BenchErrChk(err, "OSQCreate");
+            OSQCreate(&BenchQSetQ[q_qty], "Bench Q Set", 1u, &err);
+            BenchErrChk(err, "OSQCreate");
+            OSQSetAdd(&BenchQSet, (OS_PEND_OBJ *)&BenchQSetQ[q_qty], &err);
+            BenchErrChk(err, "OSQSetAdd");
+            q_qty++;
+        }
+
+        BenchRun(q_qty, OS_FALSE);
+        BenchRun(q_qty, OS_TRUE);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchRun (OS_OBJ_QTY   q_qty,
+                        CPU_BOOLEAN  use_set)
+{
+    CPU_INT64U  ts_best;
+
+
+    ts_best = BenchRunBest((use_set == OS_TRUE) ? BenchRunSet : BenchRunPoll, (void *)&q_qty);
+
+    printf("q_set,%s,%u,%u,%llu\r\n",
+           (use_set == OS_TRUE) ? "set" : "poll",
+           (unsigned)q_qty,
+           (unsigned)BENCH_ROUND_QTY,
+           (unsigned long long)(ts_best / BENCH_ROUND_QTY));
+}
+
+
+static  void  BenchRunPoll (void  *p_arg)
+{
+    OS_OBJ_QTY    q_qty;
+    CPU_INT32U    round;
+    OS_OBJ_QTY    ix_post;
+    OS_OBJ_QTY    ix_poll;
+    OS_MSG_SIZE   msg_size;
+    OS_ERR        err;
+
+
+    q_qty   = *(OS_OBJ_QTY *)p_arg;
+    ix_post = 0u;
+    ix_poll = 0u;
+    for (round = 0u; round < BENCH_ROUND_QTY; round++) {
+        ix_post = (OS_OBJ_QTY)((ix_post + BENCH_Q_STRIDE) % q_qty);
+        OSQPost(&BenchQPoll[ix_post], (void *)0, 0u, OS_OPT_POST_FIFO, &err);
+        for (;;) {
+            ix_poll = (OS_OBJ_QTY)((ix_poll + 1u) % q_qty);
+            (void)OSQPend(&BenchQPoll[ix_poll], 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+            if (err == OS_ERR_NONE) {
+                break;
+            }
+        }
+    }
+}
+
+
+static  void  BenchRunSet (void  *p_arg)
+{
+    OS_OBJ_QTY    q_qty;
+    CPU_INT32U    round;
+    OS_OBJ_QTY    ix_post;
+    OS_PEND_OBJ  *p_obj;
+    OS_MSG_SIZE   msg_size;
+    OS_ERR        err;
+
+
+    q_qty   = *(OS_OBJ_QTY *)p_arg;
+    ix_post = 0u;
+    for (round = 0u; round < BENCH_ROUND_QTY; round++) {
+        ix_post = (OS_OBJ_QTY)((ix_post + BENCH_Q_STRIDE) % q_qty);
+        OSQPost(&BenchQSetQ[ix_post], (void *)0, 0u, OS_OPT_POST_FIFO, &err);
+        p_obj = OSQSetPend(&BenchQSet, 0u, OS_OPT_PEND_NON_BLOCKING, (CPU_TS *)0, &err);
+        (void)OSQPend((OS_Q *)((void *)p_obj), 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+    }
+}
@@ -34,15 +34,24 @@
 #define OS_CFG_DBG_EN                              0u           /* Enable (1) or Disable (0) debug code/variables                        */
 #define OS_CFG_TICK_EN                             1u           /* Enable (1) or Disable (0) the kernel tick                             */
 #define OS_CFG_DYN_TICK_EN                         0u           /* Enable (1) or Disable (0) the Dynamic Tick                            */
+#define OS_CFG_TICK_WHEEL_EN                       0u           /* Enable (1) or Disable (0) the hierarchical tick wheel                 */
 #define OS_CFG_INVALID_OS_CALLS_CHK_EN             1u           /* Enable (1) or Disable (0) checks for invalid kernel calls             */
+#define OS_CFG_ISR_POST_DEFERRED_EN                0u           /* Enable (1) or Disable (0) deferring ISR posts to the ISR handler task */
 #define OS_CFG_OBJ_TYPE_CHK_EN                     1u           /* Enable (1) or Disable (0) object type checking                        */
 #define OS_CFG_OBJ_CREATED_CHK_EN                  1u           /* Enable (1) or Disable (0) object created checks                       */
+#define OS_CFG_PEND_LIST_BUCKET_EN                 0u           /* Enable (1) or Disable (0) per priority buckets in pend lists          */
+#define OS_CFG_PEND_MULTI_EN                       0u           /* Enable (1) or Disable (0) OSPendMulti(), pend on sems and queues      */
 #define OS_CFG_TS_EN                               0u           /* Enable (1) or Disable (0) time stamping                               */
 
 #define OS_CFG_PRIO_MAX                           64u           /* Defines the maximum number of task priorities (see OS_PRIO data type) */
 
 #define OS_CFG_SCHED_LOCK_TIME_MEAS_EN             0u           /* Include code to measure scheduler lock time                           */
 #define OS_CFG_SCHED_ROUND_ROBIN_EN                1u           /* Include code for Round-Robin scheduling                               */
+#define OS_CFG_SCHED_EDF_EN                        0u           /* Include code for Earliest Deadline First scheduling                   */
+#define OS_CFG_SCHED_EDF_PRIO                     10u           /*     Priority level whose tasks are scheduled by deadline              */
+#define OS_CFG_SCHED_PREEMPT_THRES_EN              0u           /* Include code for preemption threshold scheduling                      */
+
+#define OS_CFG_SMP_CORE_QTY                        1u           /* Number of cores scheduled by the kernel (1 = single core)             */
 
 #define OS_CFG_STK_SIZE_MIN                       64u           /* Minimum allowable task stack size                                     */
 
@@ -52,14 +61,23 @@
 #define OS_CFG_FLAG_DEL_EN                         1u           /*     Include code for OSFlagDel()                                      */
 #define OS_CFG_FLAG_MODE_CLR_EN                    1u           /*     Include code for Wait on Clear EVENT FLAGS                        */
 #define OS_CFG_FLAG_PEND_ABORT_EN                  1u           /*     Include code for OSFlagPendAbort()                                */
+#define OS_CFG_FLAG_WAIT_LIST_EN                   0u           /*     Include code for per flag lists of waiting tasks                  */
+#define OS_CFG_FLAG_WIDE_EN                        0u           /*     Include code for wide event flag groups, OSFlagWide...()          */
+#define OS_CFG_FLAG_WIDE_WIDTH                   128u           /*     Number of flags in a wide event flag group                        */
 
 
                                                                 /* ------------------------ MEMORY MANAGEMENT -------------------------  */
 #define OS_CFG_MEM_EN                              1u           /* Enable (1) or Disable (0) code generation for the MEMORY MANAGER      */
+#define OS_CFG_MEM_BUF_EN                          0u           /*     Include code for reference counted memory buffers, OSMemBuf...()  */
+
+
+                                                                /* ------------------------- MESSAGE BUFFERS --------------------------  */
+#define OS_CFG_MSG_BUF_EN                          0u           /* Enable (1) or Disable (0) code generation for MESSAGE BUFFERS         */
 
 
                                                                 /* ------------------- MUTUAL EXCLUSION SEMAPHORES --------------------  */
 #define OS_CFG_MUTEX_EN                            1u           /* Enable (1) or Disable (0) code generation for MUTEX                   */
+#define OS_CFG_MUTEX_CEIL_EN                       0u           /*     Include code for OSMutexCreateCeiling(), priority ceiling mutexes */
 #define OS_CFG_MUTEX_DEL_EN                        1u           /*     Include code for OSMutexDel()                                     */
 #define OS_CFG_MUTEX_PEND_ABORT_EN                 1u           /*     Include code for OSMutexPendAbort()                               */
 
@@ -69,6 +87,10 @@
 #define OS_CFG_Q_DEL_EN                            1u           /*     Include code for OSQDel()                                         */
 #define OS_CFG_Q_FLUSH_EN                          1u           /*     Include code for OSQFlush()                                       */
 #define OS_CFG_Q_PEND_ABORT_EN                     1u           /*     Include code for OSQPendAbort()                                   */
+#define OS_CFG_Q_MULTI_EN                          0u           /*     Include code for batch calls, OSQPendMulti() and OSQPostMulti()   */
+#define OS_CFG_Q_POST_WAIT_EN                      0u           /*     Include code for OSQPostWait() and OSTaskQPostWait()              */
+#define OS_CFG_Q_SET_EN                            0u           /*     Include code for queue sets, OSQSet...()                          */
+#define OS_CFG_Q_RING_EN                           0u           /*     Include code for ring message queues, OSQCreateRing()             */
 
 
                                                                 /* ---------------------------- SEMAPHORES ----------------------------- */
@@ -82,6 +104,7 @@
 #define OS_CFG_STAT_TASK_EN                        1u           /* Enable (1) or Disable (0) the statistics task                         */
 #define OS_CFG_STAT_TASK_STK_CHK_EN                1u           /*     Check task stacks from the statistic task                         */
 
+#define OS_CFG_TASK_BUDGET_EN                      0u           /* Include code for OSTaskBudgetSet(), per task CPU budget enforcement   */
 #define OS_CFG_TASK_CHANGE_PRIO_EN                 1u           /* Include code for OSTaskChangePrio()                                   */
 #define OS_CFG_TASK_DEL_EN                         1u           /* Include code for OSTaskDel()                                          */
 #define OS_CFG_TASK_IDLE_EN                        1u           /* Include the idle task                                                 */
@@ -109,6 +132,7 @@
                                                                 /* ------------------------- TIMER MANAGEMENT -------------------------- */
 #define OS_CFG_TMR_EN                              1u           /* Enable (1) or Disable (0) code generation for TIMERS                  */
 #define OS_CFG_TMR_DEL_EN                          1u           /* Enable (1) or Disable (0) code generation for OSTmrDel()              */
+#define OS_CFG_TMR_WHEEL_EN                        0u           /* Enable (1) or Disable (0) the hierarchical timer wheel                */
 
 
                                                                 /* ------------------------- TRACE RECORDER ---------------------------- */
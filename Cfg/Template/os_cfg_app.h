@@ -41,6 +41,13 @@
 #define  OS_CFG_TASK_STK_LIMIT_PCT_EMPTY                  10u
 
 
+                                                                /* ----------------- ISR HANDLER TASK ----------------- */
+                                                                /* Number of posts ISRs can defer                       */
+#define  OS_CFG_INT_Q_SIZE                                16u
+                                                                /* Stack size (number of CPU_STK elements)              */
+#define  OS_CFG_INT_Q_TASK_STK_SIZE                      128u
+
+
                                                                 /* -------------------- IDLE TASK --------------------- */
                                                                 /* Stack size (number of CPU_STK elements)              */
 #define  OS_CFG_IDLE_TASK_STK_SIZE                        64u
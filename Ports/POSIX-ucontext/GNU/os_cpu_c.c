@@ -0,0 +1,738 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       POSIX ucontext GNU Port
+*
+* File      : os_cpu_c.c
+* Version   : V3.08.02
+*********************************************************************************************************
+* For       : POSIX
+* Toolchain : GNU
+*********************************************************************************************************
+* Note(s)   : (1) Unlike the POSIX GNU port, which maps every task to a real-time host thread, this port runs
+*                 all tasks on the host thread that called OSStart(), switching between them with
+*                 swapcontext().  It needs no real-time privileges and the number of tasks is only bound
+*                 by memory.
+*
+*             (2) A task's context is stored at the top of the stack passed to OSTaskCreate() and the rest
+*                 of that stack is used by the task, including by the tick signal handler which runs on
+*                 the stack of the interrupted task.  Stacks must thus be sized for a host signal frame, in
+*                 addition to the task's own needs.
+*
+*             (3) Tasks are preempted asynchronously by the tick.  As with any other port, tasks must not
+*                 share non-reentrant library state (e.g. the C library heap or stdio) without
+*                 protecting it, here with a critical section or by locking the scheduler.
+*********************************************************************************************************
+*/
+
+
+#define   OS_CPU_GLOBALS
+#define  _GNU_SOURCE
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_cpu_c__c = "$Id: $";
+#endif
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "../../../Source/os.h"
+#include  <os_cfg_app.h>
+
+
+#include  <stdio.h>
+#include  <stdint.h>
+#include  <signal.h>
+#include  <string.h>
+#include  <unistd.h>
+#include  <stdlib.h>
+#include  <errno.h>
+#include  <ucontext.h>
+#include  <sys/time.h>
+
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_TICK_SIG          SIGALRM                       /* Signal used as the tick interrupt.                   */
+
+#define  OS_CPU_CTX_ALIGN         16u                           /* Alignment of the context on the task stack.          */
+
+                                                                /* Err handling convenience macro.                      */
+#define  ERR_CHK(func)            do {int res = func; \
+                                      if (res != 0u) { \
+                                          printf("Error in call '%s' from %s(): %s\r\n", #func, __FUNCTION__, strerror(errno)); \
+                                          raise(SIGABRT); \
+                                      } \
+                                  } while(0)
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  os_cpu_ctx {                                   /* Saved at the top of the task stack, see Note #2.     */
+    ucontext_t    Ctx;
+    OS_TASK_PTR   TaskPtr;
+    void         *TaskArgPtr;
+} OS_CPU_CTX;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_TaskEntry      (void);
+
+static  void  OS_CPU_TickISR        (void);
+
+static  void  OS_CPU_TickSigHandler (int  signo);
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  volatile  CPU_INT32U  OS_CPU_IntDisNestingCtr;          /* Interrupts are disabled when non-zero.               */
+static  volatile  CPU_INT32U  OS_CPU_TickPendCtr;               /* Ticks held back while interrupts are disabled.       */
+
+
+/*
+*********************************************************************************************************
+*                                     LOCAL CONFIGURATION ERRORS
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+#error  "OS_CFG_SMP_CORE_QTY must be 1u with the POSIX ucontext port, use the POSIX GNU port instead."
+#endif
+
+#if (CPU_CFG_STK_GROWTH != CPU_STK_GROWTH_HI_TO_LO)
+#error  "CPU_CFG_STK_GROWTH must be CPU_STK_GROWTH_HI_TO_LO with the POSIX ucontext port."
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           IDLE TASK HOOK
+*
+* Description: This function is called by the idle task.  This hook has been added to allow you to do
+*              such things as STOP the CPU to conserve power.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Only a signal can make a task ready while the idle task runs, so the host thread sleeps
+*                 until the next one.
+*********************************************************************************************************
+*/
+
+void  OSIdleTaskHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppIdleTaskHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppIdleTaskHookPtr)();
+    }
+#endif
+
+    (void)pause();                                              /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*
+* Description: This function is called by OSInit() at the beginning of OSInit().
+*
+* Arguments  : None.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSInitHook (void)
+{
+    struct  sigaction  sig_action;
+
+
+    OS_CPU_IntDisNestingCtr = 0u;
+    OS_CPU_TickPendCtr      = 0u;
+
+    memset(&sig_action, 0, sizeof(sig_action));                 /* Install the tick interrupt handler.                  */
+    sig_action.sa_handler = OS_CPU_TickSigHandler;
+    sig_action.sa_flags   = SA_RESTART;
+    ERR_CHK(sigemptyset(&sig_action.sa_mask));
+    ERR_CHK(sigaction(OS_CPU_TICK_SIG, &sig_action, (struct sigaction *)0));
+}
+
+
+/*
+*********************************************************************************************************
+*                                           REDZONE HIT HOOK
+*
+* Description: This function is called when a task's stack overflowed.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the offending task. NULL if ISR.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+void  OSRedzoneHitHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppRedzoneHitHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppRedzoneHitHookPtr)(p_tcb);
+    } else {
+        raise(SIGABRT);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+    raise(SIGABRT);
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         STATISTIC TASK HOOK
+*
+* Description: This function is called every second by uC/OS-III's statistics task.  This allows your
+*              application to add functionality to the statistics task.
+*
+* Arguments  : None.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSStatTaskHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppStatTaskHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppStatTaskHookPtr)();
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                         TASK CREATION HOOK
+*
+* Description: This function is called when a task is created.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being created.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskCreateHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskCreateHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskCreateHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TASK DELETION HOOK
+*
+* Description: This function is called when a task is deleted.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being deleted.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskDelHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskDelHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskDelHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TASK RETURN HOOK
+*
+* Description: This function is called if a task accidentally returns.  In other words, a task should
+*              either be an infinite loop or delete itself when done.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task that is returning.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskReturnHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskReturnHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskReturnHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                      INITIALIZE A TASK'S STACK
+*
+* Description: This function is called by OS_Task_Create() or OSTaskCreateExt() to initialize the stack
+*              frame of the task being created. This function is highly processor specific.
+*
+* Arguments  : p_task       Pointer to the task entry point address.
+*
+*              p_arg        Pointer to a user supplied data area that will be passed to the task
+*                               when the task first executes.
+*
+*              p_stk_base   Pointer to the base address of the stack.
+*
+*              stk_size     Size of the stack, in number of CPU_STK elements.
+*
+*              opt          Options used to alter the behavior of OS_Task_StkInit().
+*                            (see OS.H for OS_TASK_OPT_xxx).
+*
+* Returns    : Always returns the location of the new top-of-stack' once the processor registers have
+*              been placed on the stack in the proper order.
+*
+* Note(s)    : 1) The returned stack pointer is the address of the task's OS_CPU_CTX, see Note #2 at the
+*                 top of this file.
+*********************************************************************************************************
+*/
+
+CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
+                         void          *p_arg,
+                         CPU_STK       *p_stk_base,
+                         CPU_STK       *p_stk_limit,
+                         CPU_STK_SIZE   stk_size,
+                         OS_OPT         opt)
+{
+    OS_CPU_CTX  *p_ctx;
+    CPU_ADDR     stk_top;
+
+
+    (void)p_stk_limit;
+    (void)opt;
+
+    stk_top = (CPU_ADDR)&p_stk_base[stk_size];
+    if ((stk_top - (CPU_ADDR)p_stk_base) <= (sizeof(OS_CPU_CTX) + OS_CPU_CTX_ALIGN)) {
+        raise(SIGABRT);                                         /* Stack cannot even hold the context.                  */
+    }
+    p_ctx = (OS_CPU_CTX *)((stk_top - sizeof(OS_CPU_CTX)) & ~((CPU_ADDR)OS_CPU_CTX_ALIGN - 1u));
+
+    p_ctx->TaskPtr    = p_task;
+    p_ctx->TaskArgPtr = p_arg;
+
+    ERR_CHK(getcontext(&p_ctx->Ctx));
+    p_ctx->Ctx.uc_stack.ss_sp   = (void *)p_stk_base;
+    p_ctx->Ctx.uc_stack.ss_size = (size_t)((CPU_ADDR)p_ctx - (CPU_ADDR)p_stk_base);
+    p_ctx->Ctx.uc_link          = (ucontext_t *)0;
+    ERR_CHK(sigdelset(&p_ctx->Ctx.uc_sigmask, OS_CPU_TICK_SIG));/* Tasks always start with the tick unmasked.           */
+    makecontext(&p_ctx->Ctx, OS_CPU_TaskEntry, 0);
+
+    return ((CPU_STK *)p_ctx);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TASK SWITCH HOOK
+*
+* Description: This function is called when a task switch is performed.  This allows you to perform other
+*              operations during a context switch.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*              2) It is assumed that the global pointer 'OSTCBHighRdyPtr' points to the TCB of the task
+*                 that will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCurPtr' points
+*                 to the task being switched out (i.e. the preempted task).
+*********************************************************************************************************
+*/
+
+void  OSTaskSwHook (void)
+{
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    CPU_TS       ts;
+#endif
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    CPU_TS       int_dis_time;
+#endif
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    CPU_BOOLEAN  stk_status;
+#endif
+
+
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskSwHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppTaskSwHookPtr)();
+    }
+#endif
+
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    ts = OS_TS_GET();
+    if (OSTCBCurPtr != OSTCBHighRdyPtr) {
+        OSTCBCurPtr->CyclesDelta  = ts - OSTCBCurPtr->CyclesStart;
+        OSTCBCurPtr->CyclesTotal += (OS_CYCLES)OSTCBCurPtr->CyclesDelta;
+    }
+
+    OSTCBHighRdyPtr->CyclesStart = ts;
+#endif
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    int_dis_time = CPU_IntDisMeasMaxCurReset();                 /* Keep track of per-task interrupt disable time        */
+    if (OSTCBCurPtr->IntDisTimeMax < int_dis_time) {
+        OSTCBCurPtr->IntDisTimeMax = int_dis_time;
+    }
+#endif
+
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+                                                                /* Keep track of per-task scheduler lock time           */
+    if (OSTCBCurPtr->SchedLockTimeMax < (CPU_TS)OSSchedLockTimeMaxCur) {
+        OSTCBCurPtr->SchedLockTimeMax = (CPU_TS)OSSchedLockTimeMaxCur;
+    }
+    OSSchedLockTimeMaxCur = (CPU_TS)0;                          /* Reset the per-task value                             */
+#endif
+
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+                                                                /* Check if stack overflowed.                           */
+    stk_status = OSTaskStkRedzoneChk((OS_TCB *)0u);
+    if (stk_status != OS_TRUE) {
+        OSRedzoneHitHook(OSTCBCurPtr);
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                              TICK HOOK
+*
+* Description: This function is called every tick.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is assumed to be called from the Tick ISR.
+*********************************************************************************************************
+*/
+
+void  OSTimeTickHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTimeTickHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppTimeTickHookPtr)();
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                              START HIGHEST PRIORITY TASK READY-TO-RUN
+*
+* Description: This function is called by OSStart() to start the highest priority task that was created
+*              by your application before calling OSStart().
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) OSStartHighRdy() MUST:
+*                      a) Call OSTaskSwHook() then,
+*                      b) Switch to the highest priority task.
+*
+*              2) The context of the caller is discarded, OSStart() never returns.
+*********************************************************************************************************
+*/
+
+void  OSStartHighRdy (void)
+{
+    OS_CPU_CTX  *p_ctx;
+
+
+    OSTaskSwHook();
+
+    p_ctx = (OS_CPU_CTX *)OSTCBHighRdyPtr->StkPtr;
+    OS_CPU_IntDisNestingCtr = 1u;                               /* Enabled by the task, see OS_CPU_TaskEntry().         */
+    (void)setcontext(&p_ctx->Ctx);
+
+    raise(SIGABRT);                                             /* setcontext() only returns on error.                  */
+}
+
+
+/*
+*********************************************************************************************************
+*                                      TASK LEVEL CONTEXT SWITCH
+*
+* Description: This function is called when a task makes a higher priority task ready-to-run.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Upon entry,
+*                 OSTCBCur     points to the OS_TCB of the task to suspend
+*                 OSTCBHighRdy points to the OS_TCB of the task to resume
+*
+*              2) OSCtxSw() MUST:
+*                      a) Save processor registers then,
+*                      b) Save current task's stack pointer into the current task's OS_TCB,
+*                      c) Call OSTaskSwHook(),
+*                      d) Set OSTCBCur = OSTCBHighRdy,
+*                      e) Set OSPrioCur = OSPrioHighRdy,
+*                      f) Switch to the highest priority task.
+*
+*              3) The interrupt disable nesting is saved with the task, as the interrupt mask would be
+*                 saved with the status register of a real CPU.
+*
+*              4) The context of a deleted task is not saved, its TCB and stack may be reused right away.
+*********************************************************************************************************
+*/
+
+void  OSCtxSw (void)
+{
+    OS_CPU_CTX   *p_ctx_old;
+    OS_CPU_CTX   *p_ctx_new;
+    CPU_INT32U    int_dis_nesting;
+    CPU_BOOLEAN   detach = 0u;
+
+
+    OSTaskSwHook();
+
+    p_ctx_new = (OS_CPU_CTX *)OSTCBHighRdyPtr->StkPtr;
+    p_ctx_old = (OS_CPU_CTX *)OSTCBCurPtr->StkPtr;
+
+    if (OSTCBCurPtr->TaskState == OS_TASK_STATE_DEL) {
+        detach = 1u;
+    }
+
+    OSTCBCurPtr = OSTCBHighRdyPtr;
+    OSPrioCur   = OSPrioHighRdy;
+
+    if (detach != 0u) {
+        (void)setcontext(&p_ctx_new->Ctx);                      /* See Note #4.                                         */
+        raise(SIGABRT);
+    }
+
+    int_dis_nesting = OS_CPU_IntDisNestingCtr;                  /* See Note #3.                                         */
+    ERR_CHK(swapcontext(&p_ctx_old->Ctx, &p_ctx_new->Ctx));
+    OS_CPU_IntDisNestingCtr = int_dis_nesting;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   INTERRUPT LEVEL CONTEXT SWITCH
+*
+* Description: This function is called by OSIntExit() to perform a context switch from an ISR.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) When called from the tick signal handler, the interrupted task is resumed inside the
+*                 handler, which then returns to the point where the task was interrupted.
+*********************************************************************************************************
+*/
+
+void  OSIntCtxSw (void)
+{
+    if (OSTCBCurPtr != OSTCBHighRdyPtr) {
+        OSCtxSw();
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         INITIALIZE SYS TICK
+*
+* Description: Initialize the SysTick.
+*
+* Arguments  : none.
+*
+* Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickInit (void)
+{
+    struct  itimerval  tmr;
+
+
+    tmr.it_interval.tv_sec  = 0;
+    tmr.it_interval.tv_usec = 1000000u / OS_CFG_TICK_RATE_HZ;
+    tmr.it_value            = tmr.it_interval;
+    ERR_CHK(setitimer(ITIMER_REAL, &tmr, (struct itimerval *)0));
+}
+
+
+/*
+*********************************************************************************************************
+*                                    DISABLE AND ENABLE INTERRUPTS
+*
+* Description: Disable and enable the tick interrupt, see os_cpu.h.
+*
+* Arguments  : none.
+*
+* Note(s)    : 1) Only the outermost OS_CPU_IntEn() replays the ticks that were held back.  A tick that
+*                 arrives once the nesting reached zero is handled by the signal handler directly, so the
+*                 counter is checked again after enabling.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_IntDis (void)
+{
+    OS_CPU_IntDisNestingCtr++;
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+
+void  OS_CPU_IntEn (void)
+{
+    if (OS_CPU_IntDisNestingCtr > 1u) {
+        OS_CPU_IntDisNestingCtr--;
+        return;
+    }
+
+    for (;;) {
+        OS_CPU_IntDisNestingCtr = 0u;
+        __atomic_signal_fence(__ATOMIC_SEQ_CST);
+        if (OS_CPU_TickPendCtr == 0u) {                         /* See Note #1.                                         */
+            return;
+        }
+        (void)__atomic_fetch_sub(&OS_CPU_TickPendCtr, 1u, __ATOMIC_RELAXED);
+        OS_CPU_TickISR();                                       /* Replay a tick held back while disabled.              */
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_TaskEntry()
+*
+* Description: Entry point of every task's context.  Runs the task and deletes it if it returns.
+*
+* Arguments  : none.
+*
+* Note(s)    : 1) Tasks start with interrupts enabled.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_TaskEntry (void)
+{
+    OS_CPU_CTX  *p_ctx;
+
+
+    p_ctx = (OS_CPU_CTX *)OSTCBCurPtr->StkPtr;
+
+    OS_CPU_IntDisNestingCtr = 1u;                               /* See Note #1.                                         */
+    OS_CPU_IntEn();
+
+    p_ctx->TaskPtr(p_ctx->TaskArgPtr);
+
+    OS_TaskReturn();
+}
+
+
+/*
+*********************************************************************************************************
+*                                           OS_CPU_TickISR()
+*                                       OS_CPU_TickSigHandler()
+*
+* Description: Tick interrupt service routine, and the host signal handler invoking it.
+*
+* Arguments  : signo        Signal number.
+*
+* Note(s)    : 1) The handler runs on the stack of the interrupted task.  If the tick readies a higher
+*                 priority task, OSIntExit() switches to it from within the handler.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_TickISR (void)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();
+    CPU_CRITICAL_EXIT();
+
+    OSTimeTick();
+
+    OSIntExit();
+}
+
+
+static  void  OS_CPU_TickSigHandler (int  signo)
+{
+    int  err_no;
+
+
+    (void)signo;
+
+    err_no = errno;
+    if (OS_CPU_IntDisNestingCtr > 0u) {                         /* Hold the tick back until CPU_INT_EN().               */
+        (void)__atomic_fetch_add(&OS_CPU_TickPendCtr, 1u, __ATOMIC_RELAXED);
+    } else {
+        OS_CPU_TickISR();
+    }
+    errno = err_no;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
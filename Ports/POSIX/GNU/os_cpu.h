@@ -39,6 +39,47 @@
 extern  "C" {
 #endif
 
+/*
+*********************************************************************************************************
+*                                          PORT CONFIGURATION
+*
+* Note(s) : (1) OS_CPU_CFG_CTX_SW_FUTEX_EN selects how OSCtxSw() hands the CPU from one task thread to the
+*               next.  When enabled, each task waits on a futex word which the switching task opens and,
+*               only if the task is actually asleep, wakes with a single FUTEX_WAKE.  When disabled, a pair
+*               of POSIX semaphores is used as in previous versions of this port.
+*
+*           (2) OS_CPU_CFG_CTX_SW_SPIN_CNT is the number of times a task polls its futex word before going
+*               to sleep.  Spinning shortens the switch back to a task when the host has more than one
+*               CPU, at the cost of burning host CPU time.  Only used with the futex handoff.
+*
+*           (3) OS_CPU_CFG_SIM_EN enables the virtual time mode.  No host timer is started: the tick and
+*               simulated interrupts are only raised by OS_CPU_SimTickAdvance(), which the idle task also
+*               calls to skip to the next tick as soon as every task is blocked.  Tasks then hand the CPU
+*               to each other in a fixed order and the schedule is identical from run to run, running as
+*               fast as the host allows.  Requires a single core.
+*
+*           (4) OS_CPU_CFG_SIM_INT_QTY is the number of simulated interrupts that may be pending at once,
+*               see OS_CPU_SimIntInject().
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_CFG_CTX_SW_FUTEX_EN
+#define  OS_CPU_CFG_CTX_SW_FUTEX_EN          1u                 /* See Note #1.                                           */
+#endif
+
+#ifndef  OS_CPU_CFG_CTX_SW_SPIN_CNT
+#define  OS_CPU_CFG_CTX_SW_SPIN_CNT          0u                 /* See Note #2.                                           */
+#endif
+
+#ifndef  OS_CPU_CFG_SIM_EN
+#define  OS_CPU_CFG_SIM_EN                   0u                 /* See Note #3.                                           */
+#endif
+
+#ifndef  OS_CPU_CFG_SIM_INT_QTY
+#define  OS_CPU_CFG_SIM_INT_QTY             16u                 /* See Note #4.                                           */
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                               MACROS
@@ -47,6 +88,26 @@ extern  "C" {
 
 #define  OS_TASK_SW()               OSCtxSw()
 
+
+/*
+*********************************************************************************************************
+*                                             KERNEL LOCK
+*
+* Note(s) : (1) When more than one core is scheduled (OS_CFG_SMP_CORE_QTY > 1), every core is a POSIX
+*               thread running in parallel with the others.  Disabling interrupts then acquires the
+*               kernel lock, which also masks the signal used as the core interrupt for the calling
+*               thread.  The lock is owned by a core rather than by a thread, so that it is handed over
+*               to the task that is switched in by OSCtxSw().
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+#undef   CPU_INT_DIS
+#undef   CPU_INT_EN
+#define  CPU_INT_DIS()              do { (void)cpu_sr; OS_CPU_SMP_Lock();   } while (0)
+#define  CPU_INT_EN()               do { (void)cpu_sr; OS_CPU_SMP_Unlock(); } while (0)
+#endif
+
 /*
 *********************************************************************************************************
 *                                       TIMESTAMP CONFIGURATION
@@ -85,6 +146,18 @@ void         OSStartHighRdy     (void);
 
 void         OS_CPU_SysTickInit (void);
 
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+void         OS_CPU_SMP_Lock    (void);
+void         OS_CPU_SMP_Unlock  (void);
+#endif
+
+#if (OS_CPU_CFG_SIM_EN > 0u)
+void         OS_CPU_SimTickAdvance (OS_TICK        ticks);
+
+CPU_BOOLEAN  OS_CPU_SimIntInject   (OS_TICK        dly,
+                                    CPU_FNCT_VOID  p_isr);
+#endif
+
 
 
 #ifdef __cplusplus
@@ -57,6 +57,13 @@ const  CPU_CHAR  *os_cpu_c__c = "$Id: $";
 #include  <sys/syscall.h>
 #include  <sys/resource.h>
 #include  <errno.h>
+#include  <sched.h>
+#if (OS_CPU_CFG_CTX_SW_FUTEX_EN > 0u)
+#include  <linux/futex.h>
+#endif
+#if (OS_CFG_DYN_TICK_EN > 0u)
+#include  <sys/timerfd.h>
+#endif
 
 
 #ifdef __cplusplus
@@ -72,6 +79,22 @@ extern  "C" {
 
 #define  THREAD_CREATE_PRIO       50u                           /* Tasks underlying posix threads prio.                 */
 
+#if (OS_CFG_DYN_TICK_EN > 0u)
+#define  OS_CPU_DYN_TICK_THREAD_PRIO  (THREAD_CREATE_PRIO + 10u)    /* Dynamic tick timer thread prio.                  */
+#define  OS_CPU_DYN_TICK_MAX      ((OS_TICK)DEF_INT_32U_MAX_VAL)  /* Step programmed for an indefinite delay.           */
+#define  OS_CPU_NS_PER_SEC        1000000000u
+#endif
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+#define  OS_CPU_SMP_SIG           SIGUSR2                       /* Signal used as the interrupt of each core.           */
+#endif
+
+#if (OS_CPU_CFG_CTX_SW_FUTEX_EN > 0u)                           /* States of a task's futex word.                       */
+#define  OS_CPU_GATE_CLOSED       0u                            /* Task must wait to be switched in.                    */
+#define  OS_CPU_GATE_OPEN         1u                            /* Task was switched in.                                */
+#define  OS_CPU_GATE_SLEEP        2u                            /* Task is closed and asleep in the kernel.             */
+#endif
+
                                                                 /* Err handling convenience macro.                      */
 #define  ERR_CHK(func)            do {int res = func; \
                                       if (res != 0u) { \
@@ -91,9 +114,20 @@ typedef  struct  os_tcb_ext_posix {
     pthread_t  Thread;
     pid_t      ProcessId;
     sem_t      InitSem;
+#if (OS_CPU_CFG_CTX_SW_FUTEX_EN > 0u)
+    CPU_INT32U Gate;                                            /* Futex word, see OS_CPU_TaskGateWait().               */
+#else
     sem_t      Sem;
+#endif
 } OS_TCB_EXT_POSIX;
 
+#if (OS_CPU_CFG_SIM_EN > 0u)
+typedef  struct  os_cpu_sim_int {                               /* Simulated interrupt, see OS_CPU_SimIntInject().      */
+    OS_TICK        Dly;                                         /* Ticks left before it is raised.                      */
+    CPU_FNCT_VOID  ISR_Fnct;
+} OS_CPU_SIM_INT;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -110,7 +144,27 @@ static  void        OSThreadCreate        (pthread_t  *p_thread,
                                            void       *p_arg,
                                            int         prio);
 
+#if (OS_CFG_DYN_TICK_EN == 0u)
 static  void        OSTimeTickHandler     (void);
+#else
+static  void        OS_CPU_DynTickHandler (void);
+
+static  void       *OS_CPU_DynTickThread  (void       *p_arg);
+
+static  CPU_INT64U  OS_CPU_DynTickNowGet  (void);
+#endif
+
+static  void        OS_CPU_TaskGateInit   (OS_TCB_EXT_POSIX  *p_tcb_ext);
+
+static  void        OS_CPU_TaskGateOpen   (OS_TCB_EXT_POSIX  *p_tcb_ext);
+
+static  void        OS_CPU_TaskGateWait   (OS_TCB_EXT_POSIX  *p_tcb_ext);
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+static  void        OS_CPU_CoreEnter      (OS_TCB     *p_tcb);
+
+static  void        OS_CPU_CoreSigHandler (int         signo);
+#endif
 
 
 /*
@@ -119,7 +173,21 @@ static  void        OSTimeTickHandler     (void);
 *********************************************************************************************************
 */
 
-                                                                                            /* Tick timer cfg.          */
+#if (OS_CFG_DYN_TICK_EN > 0u)                                                               /* Dyn tick interrupt cfg.  */
+static  CPU_INTERRUPT      OSDynTickInterrupt = { .NamePtr            = "Dyn tick interrupt",
+                                                  .Prio               =  10u,
+                                                  .TraceEn            =  0u,
+                                                  .ISR_Fnct           =  OS_CPU_DynTickHandler,
+                                                  .En                 =  1u
+                                                };
+
+static  int                OS_CPU_DynTickFd      = -1;                          /* One-shot timerfd.            */
+static  CPU_BOOLEAN        OS_CPU_DynTickRunning = OS_FALSE;
+static  CPU_INT64U         OS_CPU_DynTickOrigin;                                /* Host time of tick 0, in ns.  */
+static  CPU_INT64U         OS_CPU_DynTickBase;                                  /* Host tick of OSTickCtr ...   */
+static  OS_TICK            OS_CPU_DynTickCtrBase;                               /* ... as of the last set.      */
+static  OS_TICK            OS_CPU_DynTickDelta;                                 /* Ticks programmed.            */
+#elif (OS_CPU_CFG_SIM_EN == 0u)                                                             /* Tick timer cfg.          */
 static  CPU_TMR_INTERRUPT  OSTickTmrInterrupt = { .Interrupt.NamePtr  = "Tick tmr interrupt",
                                                   .Interrupt.Prio     =  10u,
                                                   .Interrupt.TraceEn  =  0u,
@@ -129,6 +197,24 @@ static  CPU_TMR_INTERRUPT  OSTickTmrInterrupt = { .Interrupt.NamePtr  = "Tick tm
                                                   .PeriodSec          =  0u,
                                                   .PeriodMuSec        = (1000000u / OS_CFG_TICK_RATE_HZ)
                                                 };
+#else
+static  OS_CPU_SIM_INT     OS_CPU_SimIntTbl[OS_CPU_CFG_SIM_INT_QTY];            /* Pending, in injection order. */
+static  CPU_INT32U         OS_CPU_SimIntCtr;
+#endif
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+static           OS_CORE_ID    OS_CPU_LockOwner = OS_CORE_ID_NONE;          /* Core holding the kernel lock.    */
+static           CPU_INT32U    OS_CPU_LockNestingCtr;
+static           CPU_INT32U    OS_CPU_LockTicketNext;                       /* Ticket lock, grants cores FIFO.  */
+static           CPU_INT32U    OS_CPU_LockTicketCur;
+static  __thread OS_CORE_ID    OS_CPU_CoreCur;                              /* Core the calling thread runs on. */
+static  __thread sigset_t      OS_CPU_CoreSigMask;                          /* Signal mask before the lock.     */
+static  __thread OS_TCB       *OS_CPU_TCBSelf;                              /* Task of the calling thread.      */
+
+static           pthread_t     OS_CPU_CoreThread[OS_CFG_SMP_CORE_QTY];      /* Thread running on each core.     */
+static           CPU_BOOLEAN   OS_CPU_CoreSchedReqTbl[OS_CFG_SMP_CORE_QTY]; /* Pending reschedule requests.     */
+static           OS_TICK       OS_CPU_TickPendCtr;                          /* Ticks not yet handled by core 0. */
+#endif
 
 
 /*
@@ -137,7 +223,15 @@ static  CPU_TMR_INTERRUPT  OSTickTmrInterrupt = { .Interrupt.NamePtr  = "Tick tm
 *********************************************************************************************************
 */
 
-#if (OS_CFG_TICK_RATE_HZ > 100u)
+#if ((OS_CPU_CFG_SIM_EN > 0u) && (OS_CFG_SMP_CORE_QTY > 1u))
+#error  "OS_CPU_CFG_SIM_EN requires OS_CFG_SMP_CORE_QTY to be 1u, cores run in parallel host threads."
+#endif
+
+#if ((OS_CFG_DYN_TICK_EN > 0u) && ((OS_CFG_SMP_CORE_QTY > 1u) || (OS_CPU_CFG_SIM_EN > 0u)))
+#error  "OS_CFG_DYN_TICK_EN requires OS_CFG_SMP_CORE_QTY to be 1u and OS_CPU_CFG_SIM_EN to be 0u."
+#endif
+
+#if ((OS_CFG_TICK_RATE_HZ > 100u) && (OS_CPU_CFG_SIM_EN == 0u))
 #warning "Time accuracy cannot be maintained with OS_CFG_TICK_RATE_HZ > 100u.\n\n",
 #endif
 
@@ -151,7 +245,8 @@ static  CPU_TMR_INTERRUPT  OSTickTmrInterrupt = { .Interrupt.NamePtr  = "Tick tm
 *
 * Arguments  : None.
 *
-* Note(s)    : None.
+* Note(s)    : 1) In virtual time mode, nothing but the tick can make a task ready while the idle task runs.
+*                 Time thus skips to the next tick right away.
 *********************************************************************************************************
 */
 
@@ -163,7 +258,11 @@ void  OSIdleTaskHook (void)
     }
 #endif
 
+#if (OS_CPU_CFG_SIM_EN > 0u)
+    OS_CPU_SimTickAdvance(1u);                                  /* See Note #1.                                         */
+#else
     sleep(1u);                                                  /* Reduce CPU utilization.                              */
+#endif
 }
 
 
@@ -182,7 +281,11 @@ void  OSIdleTaskHook (void)
 
 void  OSInitHook (void)
 {
-    struct  rlimit  rtprio_limits;
+    struct  rlimit     rtprio_limits;
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    struct  sigaction  sig_action;
+    OS_CORE_ID         core_id;
+#endif
 
 
     ERR_CHK(getrlimit(RLIMIT_RTPRIO, &rtprio_limits));
@@ -192,6 +295,20 @@ void  OSInitHook (void)
     }
 
     CPU_IntInit();                                              /* Initialize critical section objects.                 */
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    memset(&sig_action, 0, sizeof(sig_action));                 /* Install the core interrupt handler.                  */
+    sig_action.sa_handler = OS_CPU_CoreSigHandler;
+    sig_action.sa_flags   = SA_RESTART;
+    ERR_CHK(sigemptyset(&sig_action.sa_mask));
+    ERR_CHK(sigaction(OS_CPU_SMP_SIG, &sig_action, (struct sigaction *)0));
+
+    for (core_id = 0u; core_id < OS_CFG_SMP_CORE_QTY; core_id++) {
+        OS_CPU_CoreThread[core_id]      = pthread_self();       /* Until started, requests are left pending here.       */
+        OS_CPU_CoreSchedReqTbl[core_id] = DEF_FALSE;
+    }
+    OS_CPU_TickPendCtr = 0u;
+#endif
 }
 
 
@@ -246,7 +363,7 @@ void  OSTaskCreateHook (OS_TCB  *p_tcb)
     p_tcb->ExtPtr = p_tcb_ext;
 
     ERR_CHK(sem_init(&p_tcb_ext->InitSem, 0u, 0u));
-    ERR_CHK(sem_init(&p_tcb_ext->Sem, 0u, 0u));
+    OS_CPU_TaskGateInit(p_tcb_ext);
 
     OSThreadCreate(&p_tcb_ext->Thread, OSTaskPosix, p_tcb, THREAD_CREATE_PRIO);
 
@@ -268,6 +385,11 @@ void  OSTaskCreateHook (OS_TCB  *p_tcb)
 * Arguments  : p_tcb        Pointer to the task control block of the task being deleted.
 *
 * Note(s)    : 1) Interrupts are disabled during this call.
+*
+*              2) With OS_CFG_SMP_CORE_QTY > 1, a task deleted while it ran on another core was switched
+*                 out first, and its thread exits by itself in OSCtxSw().  Any other thread is cancelled.
+*                 Either way, the thread is joined before its extension is freed since it may still be on
+*                 its way to the gate.  The thread no longer needs the kernel lock at that point.
 *********************************************************************************************************
 */
 
@@ -287,7 +409,14 @@ void  OSTaskDelHook (OS_TCB  *p_tcb)
      self = pthread_self();
      same = (pthread_equal(self, p_tcb_ext->Thread) != 0u);
      if (same != 1u) {
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+         if (p_tcb->DelReq == OS_FALSE) {                       /* See Note #2.                                         */
+             ERR_CHK(pthread_cancel(p_tcb_ext->Thread));
+         }
+         ERR_CHK(pthread_join(p_tcb_ext->Thread, (void **)0));
+#else
          ERR_CHK(pthread_cancel(p_tcb_ext->Thread));
+#endif
      }
 
      OSTaskTerminate(p_tcb);
@@ -455,6 +584,21 @@ void  OSStartHighRdy (void)
     OS_TCB_EXT_POSIX  *p_tcb_ext;
     sigset_t           sig_set;
     int                signo;
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    OS_CORE_ID         core_id;
+    CPU_SR_ALLOC();
+
+
+    for (core_id = 0u; core_id < OS_CFG_SMP_CORE_QTY; core_id++) {
+        OS_CPU_CoreCur = core_id;                               /* Take the kernel lock on behalf of each core ...      */
+        CPU_INT_DIS();
+
+        OSTaskSwHook();
+
+        p_tcb_ext = (OS_TCB_EXT_POSIX *)OSTCBCurPtr->ExtPtr;
+        OS_CPU_TaskGateOpen(p_tcb_ext);                         /* ... and hand it over to the task of the core.        */
+    }
+#else
 
 
     OSTaskSwHook();
@@ -463,7 +607,8 @@ void  OSStartHighRdy (void)
 
     CPU_INT_DIS();
 
-    ERR_CHK(sem_post(&p_tcb_ext->Sem));
+    OS_CPU_TaskGateOpen(p_tcb_ext);
+#endif
 
     ERR_CHK(sigemptyset(&sig_set));
     ERR_CHK(sigaddset(&sig_set, SIGTERM));
@@ -512,31 +657,42 @@ void  OSCtxSw (void)
 {
     OS_TCB_EXT_POSIX  *p_tcb_ext_old;
     OS_TCB_EXT_POSIX  *p_tcb_ext_new;
-    int                ret;
     CPU_BOOLEAN        detach = 0u;
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    OS_TCB            *p_tcb_old;
+#endif
 
 
     OSTaskSwHook();
 
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    p_tcb_old     = OSTCBCurPtr;
+#endif
+
     p_tcb_ext_new = (OS_TCB_EXT_POSIX *)OSTCBHighRdyPtr->ExtPtr;
     p_tcb_ext_old = (OS_TCB_EXT_POSIX *)OSTCBCurPtr->ExtPtr;
 
     if (OSTCBCurPtr->TaskState == OS_TASK_STATE_DEL) {
         detach = 1u;
     }
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    if (p_tcb_old->DelReq == OS_TRUE) {                         /* Being deleted from another core, see OSTaskDel().    */
+        detach = 1u;
+    }
+#endif
 
     OSTCBCurPtr = OSTCBHighRdyPtr;
     OSPrioCur   = OSPrioHighRdy;
 
-    ERR_CHK(sem_post(&p_tcb_ext_new->Sem));
+    OS_CPU_TaskGateOpen(p_tcb_ext_new);
 
     if (detach == 0u) {
-        do {
-            ret = sem_wait(&p_tcb_ext_old->Sem);
-            if (ret != 0 && errno != EINTR) {
-                raise(SIGABRT);
-            }
-        } while (ret != 0);
+        OS_CPU_TaskGateWait(p_tcb_ext_old);
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+        OS_CPU_CoreEnter(p_tcb_old);                            /* The task may resume on another core.                 */
+    } else {
+        pthread_exit((void *)0);                                /* The kernel lock now belongs to the new task.         */
+#endif
     }
 }
 
@@ -578,15 +734,353 @@ void  OSIntCtxSw (void)
 * Arguments  : none.
 *
 * Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
+*
+*              2) In virtual time mode, the tick is raised by OS_CPU_SimTickAdvance() instead.
+*
+*              3) With OS_CFG_DYN_TICK_EN, the tick is a one-shot timerfd which a dedicated thread waits on.
+*                 Tick 0 is the time of this call, OSTickCtr then counts host time in whole ticks.
 *********************************************************************************************************
 */
 
 void  OS_CPU_SysTickInit (void)
 {
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    pthread_t         thread;
+    struct  timespec  ts;
+    CPU_SR_ALLOC();
+
+
+    OS_CPU_DynTickFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    if (OS_CPU_DynTickFd < 0) {
+        perror("timerfd_create()");
+        raise(SIGABRT);
+    }
+    OSThreadCreate(&thread, OS_CPU_DynTickThread, (void *)0, OS_CPU_DYN_TICK_THREAD_PRIO);
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #3.                                         */
+    ERR_CHK(clock_gettime(CLOCK_MONOTONIC, &ts));
+    OS_CPU_DynTickOrigin  = ((CPU_INT64U)ts.tv_sec * OS_CPU_NS_PER_SEC) + (CPU_INT64U)ts.tv_nsec;
+    OS_CPU_DynTickBase    = 0u;
+    OS_CPU_DynTickCtrBase = OSTickCtr;
+    OS_CPU_DynTickRunning = OS_TRUE;
+    (void)OS_DynTickSet(OSTickCtrStep);                         /* Arm the step the kernel asked for so far.            */
+    CPU_CRITICAL_EXIT();
+#elif (OS_CPU_CFG_SIM_EN == 0u)
     CPU_TmrInterruptCreate(&OSTickTmrInterrupt);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                           OS_DynTickGet()
+*
+* Description: Get the number of ticks which have elapsed since the last delta was set.
+*
+* Arguments  : none.
+*
+* Returns    : An unsigned integer between 0 and the last delta set, inclusive.
+*
+* Note(s)    : 1) This function is an INTERNAL uC/OS-III function & MUST NOT be called by the application.
+*
+*              2) This function is called with kernel-aware interrupts disabled.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_TICK  OS_DynTickGet (void)
+{
+    CPU_INT64U  elapsed;
+
+
+    if (OS_CPU_DynTickRunning == OS_FALSE) {                    /* Time does not pass until the tick is started.        */
+        return (0u);
+    }
+
+    elapsed = OS_CPU_DynTickNowGet() - OS_CPU_DynTickBase;
+    if (elapsed > OS_CPU_DynTickDelta) {                        /* The tick interrupt is due, but not processed yet.    */
+        elapsed = OS_CPU_DynTickDelta;
+    }
+
+    return ((OS_TICK)elapsed);
 }
 
 
+/*
+*********************************************************************************************************
+*                                           OS_DynTickSet()
+*
+* Description: Sets the number of ticks that the kernel wants to expire before the next interrupt.
+*
+* Arguments  : ticks        number of ticks the kernel wants to delay.
+*                           0 indicates an indefinite delay.
+*
+* Returns    : The actual number of ticks which will elapse before the next interrupt.
+*
+* Note(s)    : 1) This function is an INTERNAL uC/OS-III function & MUST NOT be called by the application.
+*
+*              2) This function is called with kernel-aware interrupts disabled.
+*
+*              3) The kernel has added the elapsed ticks to OSTickCtr before setting a new delta.  The base
+*                 moves by as many ticks, but never past the current time, in case OSTimeSet() changed
+*                 OSTickCtr in between.
+*
+*              4) The timer is armed at an absolute time, computed from tick 0, so that the latency of each
+*                 interrupt does not accumulate into drift.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    struct  itimerspec  tmr;
+    CPU_INT64U          now;
+    CPU_INT64U          consumed;
+    CPU_INT64U          deadline;
+    CPU_INT64U          deadline_ns;
+
+
+    if (ticks == 0u) {                                          /* Indefinite delay, count as long as we can.           */
+        ticks = OS_CPU_DYN_TICK_MAX;
+    }
+
+    if (OS_CPU_DynTickRunning == OS_FALSE) {                    /* Armed by OS_CPU_SysTickInit().                       */
+        OS_CPU_DynTickDelta = ticks;
+        return (ticks);
+    }
+
+    now      = OS_CPU_DynTickNowGet();                          /* See Note #3.                                         */
+    consumed = (OS_TICK)(OSTickCtr - OS_CPU_DynTickCtrBase);
+    if (consumed > (now - OS_CPU_DynTickBase)) {
+        consumed = now - OS_CPU_DynTickBase;
+    }
+    OS_CPU_DynTickBase    += consumed;
+    OS_CPU_DynTickCtrBase  = OSTickCtr;
+    OS_CPU_DynTickDelta    = ticks;
+
+    deadline    = OS_CPU_DynTickBase + ticks;                   /* See Note #4.                                         */
+    deadline_ns = OS_CPU_DynTickOrigin
+                + ((deadline / OS_CFG_TICK_RATE_HZ) * OS_CPU_NS_PER_SEC)
+                + (((deadline % OS_CFG_TICK_RATE_HZ) * OS_CPU_NS_PER_SEC) / OS_CFG_TICK_RATE_HZ);
+
+    memset(&tmr, 0, sizeof(tmr));
+    tmr.it_value.tv_sec  = (time_t)(deadline_ns / OS_CPU_NS_PER_SEC);
+    tmr.it_value.tv_nsec = (long  )(deadline_ns % OS_CPU_NS_PER_SEC);
+    ERR_CHK(timerfd_settime(OS_CPU_DynTickFd, TFD_TIMER_ABSTIME, &tmr, (struct itimerspec *)0));
+
+    return (ticks);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        ADVANCE VIRTUAL TIME
+*
+* Description: Raise the tick interrupt 'ticks' times, each followed by the simulated interrupts that are
+*              due on that tick.  Only available in virtual time mode, see os_cpu.h.
+*
+* Arguments  : ticks        Number of ticks to advance.
+*
+* Note(s)    : 1) This function MUST be called from a task, after OSStart().  Each interrupt preempts the
+*                 calling task if it readies a higher priority task, in which case the remaining ticks are
+*                 only raised once the calling task runs again.
+*
+*              2) Simulated interrupts due on the same tick are raised in the order they were injected.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_SIM_EN > 0u)
+void  OS_CPU_SimTickAdvance (OS_TICK  ticks)
+{
+    CPU_FNCT_VOID  p_isr;
+    CPU_INT32U     ix;
+    CPU_INT32U     ix_due;
+    CPU_SR_ALLOC();
+
+
+    while (ticks > 0u) {
+        ticks--;
+
+        CPU_CRITICAL_ENTER();
+        for (ix = 0u; ix < OS_CPU_SimIntCtr; ix++) {
+            if (OS_CPU_SimIntTbl[ix].Dly > 0u) {
+                OS_CPU_SimIntTbl[ix].Dly--;
+            }
+        }
+        CPU_CRITICAL_EXIT();
+
+        OSTimeTickHandler();
+
+        for (;;) {                                              /* See Note #2.                                         */
+            p_isr = (CPU_FNCT_VOID)0;
+            CPU_CRITICAL_ENTER();
+            for (ix_due = 0u; ix_due < OS_CPU_SimIntCtr; ix_due++) {
+                if (OS_CPU_SimIntTbl[ix_due].Dly == 0u) {
+                    p_isr = OS_CPU_SimIntTbl[ix_due].ISR_Fnct;
+                    break;
+                }
+            }
+            if (p_isr != (CPU_FNCT_VOID)0) {                    /* Remove it, keeping the others in order.              */
+                OS_CPU_SimIntCtr--;
+                for (ix = ix_due; ix < OS_CPU_SimIntCtr; ix++) {
+                    OS_CPU_SimIntTbl[ix] = OS_CPU_SimIntTbl[ix + 1u];
+                }
+            }
+            CPU_CRITICAL_EXIT();
+
+            if (p_isr == (CPU_FNCT_VOID)0) {
+                break;
+            }
+            p_isr();
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                     INJECT SIMULATED INTERRUPT
+*
+* Description: Schedule an interrupt service routine to be raised by OS_CPU_SimTickAdvance().  Only
+*              available in virtual time mode, see os_cpu.h.
+*
+* Arguments  : dly          Number of ticks from now at which the interrupt is raised, right after the tick
+*                           interrupt.  0 raises it after the next tick, as 1 does.
+*
+*              p_isr        Interrupt service routine.  As any uC/OS-III ISR, it must call OSIntEnter() and
+*                           OSIntExit() if it calls kernel services.
+*
+* Returns    : OS_TRUE,  if the interrupt was scheduled.
+*              OS_FALSE, if OS_CPU_CFG_SIM_INT_QTY interrupts are already pending.
+*
+* Note(s)    : 1) May be called from a task or from a simulated ISR.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_CPU_SimIntInject (OS_TICK        dly,
+                                  CPU_FNCT_VOID  p_isr)
+{
+    CPU_BOOLEAN  ok;
+    CPU_SR_ALLOC();
+
+
+    ok = OS_FALSE;
+    CPU_CRITICAL_ENTER();
+    if (OS_CPU_SimIntCtr < OS_CPU_CFG_SIM_INT_QTY) {
+        OS_CPU_SimIntTbl[OS_CPU_SimIntCtr].Dly      = dly;
+        OS_CPU_SimIntTbl[OS_CPU_SimIntCtr].ISR_Fnct = p_isr;
+        OS_CPU_SimIntCtr++;
+        ok = OS_TRUE;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (ok);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            KERNEL LOCK
+*
+* Description: Take and release the kernel lock shared by all cores.
+*
+* Arguments  : none.
+*
+* Note(s)    : 1) Replace CPU_INT_DIS() and CPU_INT_EN() when OS_CFG_SMP_CORE_QTY > 1, see os_cpu.h.  The
+*                 lock is a ticket lock so that cores are granted it in FIFO order.  It is recursive per core
+*                 and masks the core's interrupt signal while held.
+*
+*              2) OSCtxSw() is called with the lock held, and the lock is handed over to the task being
+*                 switched in, which releases it once it returns from OSCtxSw().
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+void  OS_CPU_SMP_Lock (void)
+{
+    sigset_t    sig_set;
+    sigset_t    sig_set_prev;
+    OS_CORE_ID  core_id;
+    CPU_INT32U  ticket;
+
+
+    ERR_CHK(sigemptyset(&sig_set));
+    ERR_CHK(sigaddset(&sig_set, OS_CPU_SMP_SIG));
+    ERR_CHK(pthread_sigmask(SIG_BLOCK, &sig_set, &sig_set_prev));
+
+    core_id = OS_CPU_CoreCur;
+    if (__atomic_load_n(&OS_CPU_LockOwner, __ATOMIC_ACQUIRE) == core_id) {
+        OS_CPU_LockNestingCtr++;                                /* Nested call from the same core.                      */
+        return;
+    }
+
+    ticket = __atomic_fetch_add(&OS_CPU_LockTicketNext, 1u, __ATOMIC_RELAXED);
+    while (__atomic_load_n(&OS_CPU_LockTicketCur, __ATOMIC_ACQUIRE) != ticket) {
+        sched_yield();                                          /* Let the owner run if cores exceed host CPUs.         */
+    }
+    __atomic_store_n(&OS_CPU_LockOwner, core_id, __ATOMIC_RELAXED);
+    OS_CPU_LockNestingCtr = 1u;
+    OS_CPU_CoreSigMask    = sig_set_prev;
+}
+
+
+void  OS_CPU_SMP_Unlock (void)
+{
+    OS_CPU_LockNestingCtr--;
+    if (OS_CPU_LockNestingCtr == 0u) {
+        __atomic_store_n(&OS_CPU_LockOwner, OS_CORE_ID_NONE, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&OS_CPU_LockTicketCur, 1u, __ATOMIC_RELEASE);
+        ERR_CHK(pthread_sigmask(SIG_SETMASK, &OS_CPU_CoreSigMask, (sigset_t *)0));
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          CORE IDENTIFICATION
+*
+* Description: Return the index of the core the caller runs on.
+*
+* Arguments  : none.
+*
+* Returns    : The core index, or OS_CFG_SMP_CORE_QTY from the tick thread.
+*
+* Note(s)    : 1) Called by the kernel to index OSCoreTbl[].
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+OS_CORE_ID  OS_CPU_CoreIdGet (void)
+{
+    return (OS_CPU_CoreCur);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      CORE RESCHEDULE REQUEST
+*
+* Description: Interrupt another core so that it runs the scheduler.
+*
+* Arguments  : core_id      Index of the core to interrupt.
+*
+* Note(s)    : 1) MUST be called with the kernel lock held.  The request is handled once the thread running
+*                 on that core unmasks its interrupt signal, see OS_CPU_CoreSigHandler().
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+void  OS_CPU_CoreSchedReq (OS_CORE_ID  core_id)
+{
+    OS_CPU_CoreSchedReqTbl[core_id] = DEF_TRUE;
+    ERR_CHK(pthread_kill(OS_CPU_CoreThread[core_id], OS_CPU_SMP_SIG));
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -595,15 +1089,114 @@ void  OS_CPU_SysTickInit (void)
 *********************************************************************************************************
 */
 
+#if (OS_CFG_DYN_TICK_EN == 0u)
 static  void  OSTimeTickHandler (void)
 {
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    CPU_SR_ALLOC();
+
+
+    OS_CPU_CoreCur = OS_CFG_SMP_CORE_QTY;                       /* Not a core, but needs its own kernel lock identity.  */
+    CPU_INT_DIS();
+    OS_CPU_TickPendCtr++;                                       /* Handled by the thread running on core 0.             */
+    ERR_CHK(pthread_kill(OS_CPU_CoreThread[0], OS_CPU_SMP_SIG));
+    CPU_INT_EN();
+    CPU_ISR_End();
+#else
     OSIntEnter();
     OSTimeTick();
+#if (OS_CPU_CFG_SIM_EN == 0u)
+    CPU_ISR_End();                                              /* Raised from a task in virtual time mode.             */
+#endif
+    OSIntExit();
+#endif
+}
+
+#else
+/*
+*********************************************************************************************************
+*                                       OS_CPU_DynTickHandler()
+*                                       OS_CPU_DynTickThread()
+*
+* Description: Dynamic tick interrupt service routine, and the thread raising it when the timer expires.
+*
+* Arguments  : p_arg        Not used.
+*
+* Note(s)    : 1) The number of ticks to announce is read from the host clock rather than taken from the
+*                 last delta set.  An expiry that raced with a new delta being set then announces only the
+*                 ticks that actually elapsed, possibly none.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_DynTickHandler (void)
+{
+    OS_TICK  elapsed;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();
+    elapsed = OS_DynTickGet();                                  /* See Note #1.                                         */
+    CPU_CRITICAL_EXIT();
+
+    if (elapsed > 0u) {
+        OSTimeDynTick(elapsed);                                 /* Next delta will be set by the kernel.                */
+    }
+
     CPU_ISR_End();
     OSIntExit();
 }
 
 
+static  void  *OS_CPU_DynTickThread (void  *p_arg)
+{
+    uint64_t  expiry_cnt;
+    ssize_t   res;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        res = read(OS_CPU_DynTickFd, &expiry_cnt, sizeof(expiry_cnt));
+        if (res == (ssize_t)sizeof(expiry_cnt)) {
+            CPU_InterruptTrigger(&OSDynTickInterrupt);
+        } else if ((res < 0) && (errno != EINTR) && (errno != EAGAIN)) {
+            perror("read(timerfd)");
+            raise(SIGABRT);
+        }
+    }
+
+    return ((void *)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       OS_CPU_DynTickNowGet()
+*
+* Description: Get the current host time, in whole ticks since tick 0.
+*
+* Arguments  : none.
+*
+* Returns    : Number of ticks.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  OS_CPU_DynTickNowGet (void)
+{
+    struct  timespec  ts;
+    CPU_INT64U        now_ns;
+
+
+    ERR_CHK(clock_gettime(CLOCK_MONOTONIC, &ts));
+    now_ns = ((CPU_INT64U)ts.tv_sec * OS_CPU_NS_PER_SEC) + (CPU_INT64U)ts.tv_nsec - OS_CPU_DynTickOrigin;
+
+    return (((now_ns / OS_CPU_NS_PER_SEC) * OS_CFG_TICK_RATE_HZ) +
+           (((now_ns % OS_CPU_NS_PER_SEC) * OS_CFG_TICK_RATE_HZ) / OS_CPU_NS_PER_SEC));
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                      OSTaskPosix()
@@ -635,17 +1228,24 @@ static void  *OSTaskPosix (void  *p_arg)
     }
 #endif
 
-    CPU_INT_DIS();
+#if (OS_CFG_SMP_CORE_QTY > 1u)
     {
-        int ret = -1u;
-        while (ret != 0u) {
-            ret = sem_wait(&p_tcb_ext->Sem);                    /* Wait until first CTX SW.                             */
-            if ((ret != 0) && (ret != -EINTR)) {
-                ERR_CHK(ret);
-            }
-        }
+        sigset_t  sig_set;
+
+                                                                /* Masked until the kernel lock is released.            */
+        ERR_CHK(sigemptyset(&sig_set));
+        ERR_CHK(sigaddset(&sig_set, OS_CPU_SMP_SIG));
+        ERR_CHK(pthread_sigmask(SIG_BLOCK, &sig_set, &OS_CPU_CoreSigMask));
+        ERR_CHK(sigdelset(&OS_CPU_CoreSigMask, OS_CPU_SMP_SIG));
+        OS_CPU_TaskGateWait(p_tcb_ext);                         /* Wait until first CTX SW.                             */
+        OS_CPU_CoreEnter(p_tcb);
+        OS_CPU_SMP_Unlock();                                    /* Release the lock handed over by the dispatcher.      */
     }
+#else
+    CPU_INT_DIS();
+    OS_CPU_TaskGateWait(p_tcb_ext);                             /* Wait until first CTX SW.                             */
     CPU_INT_EN();
+#endif
 
     ((void (*)(void *))p_tcb->TaskEntryAddr)(p_tcb->TaskEntryArg);
 
@@ -678,6 +1278,195 @@ static  void  OSTaskTerminate (OS_TCB  *p_tcb)
 }
 
 
+/*
+*********************************************************************************************************
+*                                          OS_CPU_TaskGateInit()
+*                                          OS_CPU_TaskGateOpen()
+*                                          OS_CPU_TaskGateWait()
+*
+* Description: Block the thread of a task until it is switched in, and release it.
+*
+* Arguments  : p_tcb_ext    Pointer to the POSIX extension of the task.
+*
+* Note(s)    : 1) With the futex handoff, OS_CPU_TaskGateOpen() only enters the host kernel when the task
+*                 announced that it sleeps (OS_CPU_GATE_SLEEP), and then wakes that single thread.  The
+*                 waiting task polls its gate OS_CPU_CFG_CTX_SW_SPIN_CNT times before sleeping.
+*
+*              2) Only the thread of the task ever waits on its gate.
+*
+*              3) OSTaskDelHook() cancels the thread of a deleted task while it waits on its gate.  Unlike
+*                 sem_wait(), the futex system call is not a cancellation point, so asynchronous
+*                 cancellation is enabled for the duration of the wait.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_TaskGateInit (OS_TCB_EXT_POSIX  *p_tcb_ext)
+{
+#if (OS_CPU_CFG_CTX_SW_FUTEX_EN > 0u)
+    p_tcb_ext->Gate = OS_CPU_GATE_CLOSED;
+#else
+    ERR_CHK(sem_init(&p_tcb_ext->Sem, 0u, 0u));
+#endif
+}
+
+
+static  void  OS_CPU_TaskGateOpen (OS_TCB_EXT_POSIX  *p_tcb_ext)
+{
+#if (OS_CPU_CFG_CTX_SW_FUTEX_EN > 0u)
+    CPU_INT32U  gate;
+
+
+    gate = __atomic_exchange_n(&p_tcb_ext->Gate, OS_CPU_GATE_OPEN, __ATOMIC_RELEASE);
+    if (gate == OS_CPU_GATE_SLEEP) {                            /* Wake the task only if it sleeps, see Note #1.        */
+        if (syscall(SYS_futex, &p_tcb_ext->Gate, FUTEX_WAKE_PRIVATE, 1, (void *)0, (void *)0, 0) < 0) {
+            raise(SIGABRT);
+        }
+    }
+#else
+    ERR_CHK(sem_post(&p_tcb_ext->Sem));
+#endif
+}
+
+
+static  void  OS_CPU_TaskGateWait (OS_TCB_EXT_POSIX  *p_tcb_ext)
+{
+#if (OS_CPU_CFG_CTX_SW_FUTEX_EN > 0u)
+    CPU_INT32U  gate;
+    long        ret;
+    int         cancel_type;
+#if (OS_CPU_CFG_CTX_SW_SPIN_CNT > 0u)
+    CPU_INT32U  spin_cnt;
+
+
+    spin_cnt = 0u;
+#endif
+    for (;;) {
+        gate = OS_CPU_GATE_OPEN;                                /* Take the gate if it is open.                         */
+        if (__atomic_compare_exchange_n(&p_tcb_ext->Gate, &gate, OS_CPU_GATE_CLOSED, 0,
+                                         __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) != 0) {
+            return;
+        }
+#if (OS_CPU_CFG_CTX_SW_SPIN_CNT > 0u)
+        if (spin_cnt < OS_CPU_CFG_CTX_SW_SPIN_CNT) {
+            spin_cnt++;
+            continue;
+        }
+#endif
+        if (gate == OS_CPU_GATE_CLOSED) {                       /* Announce the sleep, unless the gate just opened.     */
+            if (__atomic_compare_exchange_n(&p_tcb_ext->Gate, &gate, OS_CPU_GATE_SLEEP, 0,
+                                             __ATOMIC_RELAXED, __ATOMIC_RELAXED) == 0) {
+                continue;
+            }
+        }
+                                                                /* Let OSTaskDelHook() cancel the wait, see Note #3.    */
+        ERR_CHK(pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, &cancel_type));
+        ret = syscall(SYS_futex, &p_tcb_ext->Gate, FUTEX_WAIT_PRIVATE, OS_CPU_GATE_SLEEP, (void *)0, (void *)0, 0);
+        ERR_CHK(pthread_setcanceltype(cancel_type, (int *)0));
+        if ((ret   <  0) &&
+            (errno != EAGAIN) &&
+            (errno != EINTR)) {
+            raise(SIGABRT);
+        }
+    }
+#else
+    int  ret;
+
+
+    do {
+        ret = sem_wait(&p_tcb_ext->Sem);
+        if ((ret != 0) && (errno != EINTR)) {
+            raise(SIGABRT);
+        }
+    } while (ret != 0);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_CoreEnter()
+*
+* Description: Bind the calling thread to the core its task was dispatched on.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the calling thread's task.
+*
+* Note(s)    : 1) Called with the kernel lock held, when the task resumes from OSCtxSw().
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+static  void  OS_CPU_CoreEnter (OS_TCB  *p_tcb)
+{
+    OS_CORE_ID  core_id;
+
+
+    core_id                    = p_tcb->CoreId;
+    OS_CPU_CoreCur             = core_id;
+    OS_CPU_TCBSelf             = p_tcb;
+    OS_CPU_CoreThread[core_id] = pthread_self();
+                                                                /* Requests sent while switching were left pending.     */
+    if ((OS_CPU_CoreSchedReqTbl[core_id] == DEF_TRUE) ||
+        ((core_id == 0u) && (OS_CPU_TickPendCtr > 0u))) {
+        ERR_CHK(pthread_kill(OS_CPU_CoreThread[core_id], OS_CPU_SMP_SIG));
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        OS_CPU_CoreSigHandler()
+*
+* Description: Interrupt handler of a core.  Runs pending ticks and reschedule requests.
+*
+* Arguments  : signo        Signal number.
+*
+* Note(s)    : 1) Runs in the thread of the task currently on the core, as an ISR would on real hardware.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+static  void  OS_CPU_CoreSigHandler (int  signo)
+{
+    OS_TICK      ticks;
+    CPU_BOOLEAN  sched_req;
+    int          err_no;
+    CPU_SR_ALLOC();
+
+
+    (void)signo;
+
+    if (OS_CPU_TCBSelf == (OS_TCB *)0) {                        /* Only task threads act as cores.                      */
+        return;
+    }
+
+    err_no = errno;
+    CPU_INT_DIS();
+    ticks                                  = OS_CPU_TickPendCtr;
+    OS_CPU_TickPendCtr                     = 0u;
+    sched_req                              = OS_CPU_CoreSchedReqTbl[OS_CPU_CoreCur];
+    OS_CPU_CoreSchedReqTbl[OS_CPU_CoreCur] = DEF_FALSE;
+    if (ticks > 0u) {
+        OSIntEnter();
+    }
+    CPU_INT_EN();
+
+    if (ticks > 0u) {
+        while (ticks > 0u) {
+            OSTimeTick();
+            ticks--;
+        }
+        OSIntExit();
+    }
+
+    if (sched_req == DEF_TRUE) {
+        OSSched();
+    }
+    errno = err_no;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          OSThreadCreate()
@@ -73,6 +73,78 @@ extern "C" {
 #define  OS_CFG_INVALID_OS_CALLS_CHK_EN  0u
 #endif
 
+#ifndef OS_CFG_TICK_WHEEL_EN
+#define  OS_CFG_TICK_WHEEL_EN            0u
+#endif
+
+#ifndef OS_CFG_TMR_WHEEL_EN
+#define  OS_CFG_TMR_WHEEL_EN             0u
+#endif
+
+#ifndef OS_CFG_PEND_LIST_BUCKET_EN
+#define  OS_CFG_PEND_LIST_BUCKET_EN      0u
+#endif
+
+#ifndef OS_CFG_PEND_MULTI_EN
+#define  OS_CFG_PEND_MULTI_EN            0u
+#endif
+
+#ifndef OS_CFG_SMP_CORE_QTY
+#define  OS_CFG_SMP_CORE_QTY             1u
+#endif
+
+#ifndef OS_CFG_SCHED_EDF_EN
+#define  OS_CFG_SCHED_EDF_EN             0u
+#endif
+
+#ifndef OS_CFG_MUTEX_CEIL_EN
+#define  OS_CFG_MUTEX_CEIL_EN            0u
+#endif
+
+#ifndef OS_CFG_SCHED_PREEMPT_THRES_EN
+#define  OS_CFG_SCHED_PREEMPT_THRES_EN   0u
+#endif
+
+#ifndef OS_CFG_TASK_BUDGET_EN
+#define  OS_CFG_TASK_BUDGET_EN           0u
+#endif
+
+#ifndef OS_CFG_ISR_POST_DEFERRED_EN
+#define  OS_CFG_ISR_POST_DEFERRED_EN     0u
+#endif
+
+#ifndef OS_CFG_FLAG_WIDE_EN
+#define  OS_CFG_FLAG_WIDE_EN             0u
+#endif
+
+#ifndef OS_CFG_FLAG_WAIT_LIST_EN
+#define  OS_CFG_FLAG_WAIT_LIST_EN        0u
+#endif
+
+#ifndef OS_CFG_Q_SET_EN
+#define  OS_CFG_Q_SET_EN                 0u
+#endif
+
+#ifndef OS_CFG_Q_RING_EN
+#define  OS_CFG_Q_RING_EN                0u
+#endif
+
+#ifndef OS_CFG_MSG_BUF_EN
+#define  OS_CFG_MSG_BUF_EN               0u
+#endif
+
+#ifndef OS_CFG_MEM_BUF_EN
+#define  OS_CFG_MEM_BUF_EN               0u
+#endif
+
+#ifndef OS_CFG_Q_MULTI_EN
+#define  OS_CFG_Q_MULTI_EN               0u
+#endif
+
+#ifndef OS_CFG_Q_POST_WAIT_EN
+#define  OS_CFG_Q_POST_WAIT_EN           0u
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -95,6 +167,34 @@ extern "C" {
 #endif
 
 
+#if      (OS_CFG_ISR_POST_DEFERRED_EN > 0u)                 /* Deferred posts: lock the scheduler, ints stay enabled  */
+#define  OS_CRITICAL_ENTER()                                       \
+         do {                                                      \
+             CPU_CRITICAL_ENTER();                                 \
+             OSSchedLockNestingCtr++;                              \
+             OS_SCHED_LOCK_TIME_MEAS_START();                      \
+             CPU_CRITICAL_EXIT();                                  \
+         } while (0)
+
+#define  OS_CRITICAL_EXIT()                                        \
+         do {                                                      \
+             CPU_CRITICAL_ENTER();                                 \
+             OSSchedLockNestingCtr--;                              \
+             OS_SCHED_LOCK_TIME_MEAS_STOP();                       \
+             if ((OSSchedLockNestingCtr == 0u) &&                  \
+                 (OSIntQNbrEntries      >  0u)) {                  \
+                 CPU_CRITICAL_EXIT();                              \
+                 OSSched();                                        \
+             } else {                                              \
+                 CPU_CRITICAL_EXIT();                              \
+             }                                                     \
+         } while (0)
+#else                                                       /* Direct posts: disable interrupts                       */
+#define  OS_CRITICAL_ENTER()                CPU_CRITICAL_ENTER()
+#define  OS_CRITICAL_EXIT()                 CPU_CRITICAL_EXIT()
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                     MISCELLANEOUS
@@ -117,9 +217,40 @@ extern "C" {
 
 #define  OS_PRIO_TBL_SIZE          (((OS_CFG_PRIO_MAX - 1u) / ((CPU_CFG_DATA_SIZE * 8u))) + 1u)
 
+#define  OS_PRIO_GRP_TBL_SIZE      (((OS_PRIO_TBL_SIZE - 1u) / ((CPU_CFG_DATA_SIZE * 8u))) + 1u)
+
 #define  OS_MSG_EN                 (((OS_CFG_TASK_Q_EN > 0u) || (OS_CFG_Q_EN > 0u)) ? 1u : 0u)
 
-#define  OS_OBJ_TYPE_REQ           (((OS_CFG_DBG_EN > 0u) || (OS_CFG_OBJ_TYPE_CHK_EN > 0u)) ? 1u : 0u)
+#define  OS_OBJ_TYPE_REQ           (((OS_CFG_DBG_EN          > 0u) || \
+                                     (OS_CFG_OBJ_TYPE_CHK_EN > 0u) || \
+                                     (OS_CFG_PEND_MULTI_EN   > 0u) || \
+                                     (OS_CFG_Q_SET_EN        > 0u) || \
+                                     (OS_CFG_MSG_BUF_EN      > 0u)) ? 1u : 0u)
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+#define  OS_TICK_WHEEL_SPOKE_BITS    4u                     /* Number of tick bits resolved by each wheel level       */
+#define  OS_TICK_WHEEL_SPOKE_QTY    (1u << OS_TICK_WHEEL_SPOKE_BITS)
+#define  OS_TICK_WHEEL_SPOKE_MASK   (OS_TICK_WHEEL_SPOKE_QTY - 1u)
+#define  OS_TICK_WHEEL_LVL_QTY     ((sizeof(OS_TICK) * 8u) / OS_TICK_WHEEL_SPOKE_BITS)
+#endif
+
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+#define  OS_TMR_WHEEL_SPOKE_BITS     4u                     /* Number of tick bits resolved by each wheel level       */
+#define  OS_TMR_WHEEL_SPOKE_QTY     (1u << OS_TMR_WHEEL_SPOKE_BITS)
+#define  OS_TMR_WHEEL_SPOKE_MASK    (OS_TMR_WHEEL_SPOKE_QTY - 1u)
+#define  OS_TMR_WHEEL_LVL_QTY      ((sizeof(OS_TICK) * 8u) / OS_TMR_WHEEL_SPOKE_BITS)
+#endif
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)                              /* See 'PER CORE STATE' Note #1                           */
+#define  OS_CORE_ID_NONE           ((OS_CORE_ID)0xFFu)      /* Task is not running on any core                        */
+
+#define  OSTCBCurPtr                (OSCoreTbl[OS_CPU_CoreIdGet()].TCBCurPtr)
+#define  OSTCBHighRdyPtr            (OSCoreTbl[OS_CPU_CoreIdGet()].TCBHighRdyPtr)
+#define  OSPrioCur                  (OSCoreTbl[OS_CPU_CoreIdGet()].PrioCur)
+#define  OSPrioHighRdy              (OSCoreTbl[OS_CPU_CoreIdGet()].PrioHighRdy)
+#define  OSIntNestingCtr            (OSCoreTbl[OS_CPU_CoreIdGet()].IntNestingCtr)
+#define  OSSchedLockNestingCtr      (OSCoreTbl[OS_CPU_CoreIdGet()].SchedLockNestingCtr)
+#endif
 
 
 /*
@@ -171,6 +302,9 @@ extern "C" {
 #define  OS_TASK_PEND_ON_Q                    (OS_STATE)(  5u)  /* Pending on queue                                   */
 #define  OS_TASK_PEND_ON_SEM                  (OS_STATE)(  6u)  /* Pending on semaphore                               */
 #define  OS_TASK_PEND_ON_TASK_SEM             (OS_STATE)(  7u)  /* Pending on signal  to be sent to task              */
+#define  OS_TASK_PEND_ON_MULTI                (OS_STATE)(  8u)  /* Pending on multiple semaphores and/or queues       */
+#define  OS_TASK_PEND_ON_MSG_BUF              (OS_STATE)(  9u)  /* Pending on message buffer, for a record or room    */
+#define  OS_TASK_PEND_ON_Q_POST               (OS_STATE)( 10u)  /* Pending on room in a queue or task queue to post   */
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -196,12 +330,18 @@ extern "C" {
 
 #define  OS_OBJ_TYPE_NONE                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('N', 'O', 'N', 'E')
 #define  OS_OBJ_TYPE_FLAG                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('F', 'L', 'A', 'G')
+#define  OS_OBJ_TYPE_FLAG_WIDE               (OS_OBJ_TYPE)CPU_TYPE_CREATE('F', 'L', 'G', 'W')
 #define  OS_OBJ_TYPE_MEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'E', 'M', ' ')
+#define  OS_OBJ_TYPE_MSG_BUF                 (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'B', 'U', 'F')
 #define  OS_OBJ_TYPE_MUTEX                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'U', 'T', 'X')
 #define  OS_OBJ_TYPE_COND                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('C', 'O', 'N', 'D')
 #define  OS_OBJ_TYPE_Q                       (OS_OBJ_TYPE)CPU_TYPE_CREATE('Q', 'U', 'E', 'U')
+#define  OS_OBJ_TYPE_Q_SET                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('Q', 'S', 'E', 'T')
 #define  OS_OBJ_TYPE_SEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'E', 'M', 'A')
 #define  OS_OBJ_TYPE_TMR                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'R', ' ')
+#define  OS_OBJ_TYPE_TASK_MSG                (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'S', 'G')
+#define  OS_OBJ_TYPE_TASK_SIGNAL             (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'S', 'G', 'L')
+#define  OS_OBJ_TYPE_TICK                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'I', 'C', 'K')
 
 /*
 ========================================================================================================================
@@ -285,6 +425,9 @@ extern "C" {
 #define  OS_OPT_TASK_SAVE_FP                 (OS_OPT)(0x0004u)  /* Save the contents of any floating-point registers  */
 #define  OS_OPT_TASK_NO_TLS                  (OS_OPT)(0x0008u)  /* Specifies the task DOES NOT require TLS support    */
 
+#define  OS_OPT_TASK_BUDGET_DEMOTE           (OS_OPT)(0x0000u)  /* Lower the priority of a task out of CPU budget     */
+#define  OS_OPT_TASK_BUDGET_SUSPEND          (OS_OPT)(0x0010u)  /* Suspend a task out of CPU budget                   */
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     TIME OPTIONS
@@ -398,6 +541,10 @@ typedef  enum  os_err {
 
     OS_ERR_I                         = 18000u,
     OS_ERR_ILLEGAL_CREATE_RUN_TIME   = 18001u,
+    OS_ERR_INT_Q_FULL                = 18003u,
+    OS_ERR_INT_Q_SIZE                = 18004u,
+    OS_ERR_INT_Q_STK_INVALID         = 18005u,
+    OS_ERR_INT_Q_STK_SIZE_INVALID    = 18006u,
 
     OS_ERR_ILLEGAL_DEL_RUN_TIME      = 18007u,
 
@@ -420,14 +567,17 @@ typedef  enum  os_err {
     OS_ERR_MEM_INVALID_P_DATA        = 22208u,
     OS_ERR_MEM_INVALID_SIZE          = 22209u,
     OS_ERR_MEM_NO_FREE_BLKS          = 22210u,
+    OS_ERR_MEM_BUF_REF_OVF           = 22211u,
 
     OS_ERR_MSG_POOL_EMPTY            = 22301u,
     OS_ERR_MSG_POOL_NULL_PTR         = 22302u,
+    OS_ERR_MSG_BUF_SIZE              = 22303u,
 
     OS_ERR_MUTEX_NOT_OWNER           = 22401u,
     OS_ERR_MUTEX_OWNER               = 22402u,
     OS_ERR_MUTEX_NESTING             = 22403u,
     OS_ERR_MUTEX_OVF                 = 22404u,
+    OS_ERR_MUTEX_CEILING             = 22405u,
 
     OS_ERR_N                         = 23000u,
     OS_ERR_NAME                      = 23001u,
@@ -470,6 +620,8 @@ typedef  enum  os_err {
     OS_ERR_Q_EMPTY                   = 26002u,
     OS_ERR_Q_MAX                     = 26003u,
     OS_ERR_Q_SIZE                    = 26004u,
+    OS_ERR_Q_SET_MEMBER              = 26005u,
+    OS_ERR_Q_SET_NOT_EMPTY           = 26006u,
 
     OS_ERR_R                         = 27000u,
     OS_ERR_REG_ID_INVALID            = 27001u,
@@ -522,6 +674,7 @@ typedef  enum  os_err {
     OS_ERR_TASK_SUSPEND_PRIO         = 29022u,
     OS_ERR_TASK_WAITING              = 29023u,
     OS_ERR_TASK_SUSPEND_CTR_OVF      = 29024u,
+    OS_ERR_TASK_BUDGET_INVALID       = 29025u,
 
     OS_ERR_TCB_INVALID               = 29101u,
 
@@ -590,18 +743,39 @@ typedef  enum  os_err {
 
 typedef  struct  os_flag_grp         OS_FLAG_GRP;
 
+#if (OS_CFG_FLAG_WIDE_EN > 0u)
+typedef  struct  os_flags_wide       OS_FLAGS_WIDE;
+typedef  struct  os_flag_wide_grp    OS_FLAG_WIDE_GRP;
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+typedef  struct  os_int_q            OS_INT_Q;
+#endif
+
 typedef  struct  os_mem              OS_MEM;
 
+#if (OS_CFG_MEM_BUF_EN > 0u)
+typedef  struct  os_mem_buf          OS_MEM_BUF;
+#endif
+
 typedef  struct  os_msg              OS_MSG;
 typedef  struct  os_msg_pool         OS_MSG_POOL;
 typedef  struct  os_msg_q            OS_MSG_Q;
 
+#if (OS_CFG_MSG_BUF_EN > 0u)
+typedef  struct  os_msg_buf          OS_MSG_BUF;
+#endif
+
 typedef  struct  os_mutex            OS_MUTEX;
 
 typedef  struct  os_cond             OS_COND;
 
 typedef  struct  os_q                OS_Q;
 
+#if (OS_CFG_Q_SET_EN > 0u)
+typedef  struct  os_q_set            OS_Q_SET;
+#endif
+
 typedef  struct  os_sem              OS_SEM;
 
 typedef  void                      (*OS_TASK_PTR)(void *p_arg);
@@ -621,12 +795,26 @@ typedef  void                      (*OS_TLS_DESTRUCT_PTR)(OS_TCB    *p_tcb,
 typedef  struct  os_rdy_list         OS_RDY_LIST;
 
 typedef  struct  os_tick_list        OS_TICK_LIST;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+typedef  struct  os_tick_spoke       OS_TICK_SPOKE;
+#endif
 
 typedef  void                      (*OS_TMR_CALLBACK_PTR)(void *p_tmr, void *p_arg);
 typedef  struct  os_tmr              OS_TMR;
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+typedef  struct  os_tmr_spoke        OS_TMR_SPOKE;
+typedef  struct  os_tmr_wheel        OS_TMR_WHEEL;
+#endif
 
 typedef  struct  os_pend_list        OS_PEND_LIST;
 typedef  struct  os_pend_obj         OS_PEND_OBJ;
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+typedef  struct  os_pend_data        OS_PEND_DATA;
+#endif
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+typedef  struct  os_core             OS_CORE;
+#endif
 
 #if (OS_CFG_APP_HOOKS_EN > 0u)
 typedef  void                      (*OS_APP_HOOK_VOID)(void);
@@ -657,6 +845,28 @@ struct  os_rdy_list {
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    PER CORE STATE
+*
+* Note(s) : (1) With OS_CFG_SMP_CORE_QTY > 1, the scheduling state that is inherently per core is kept in OSCoreTbl[] and
+*               the usual global names (OSTCBCurPtr, OSPrioCur, OSIntNestingCtr, ...) refer to the entry of the core
+*               returned by OS_CPU_CoreIdGet().
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+struct  os_core {
+    OS_TCB              *TCBCurPtr;                         /* Pointer to task running on this core                   */
+    OS_TCB              *TCBHighRdyPtr;                     /* Pointer to task this core is switching to              */
+    OS_PRIO              PrioCur;                           /* Priority of task running on this core                  */
+    OS_PRIO              PrioHighRdy;                       /* Priority of task this core is switching to             */
+    OS_NESTING_CTR       IntNestingCtr;                     /* Interrupt nesting level on this core                   */
+    OS_NESTING_CTR       SchedLockNestingCtr;               /* Scheduler lock nesting level on this core              */
+};
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                      PEND LIST
@@ -669,7 +879,41 @@ struct  os_pend_list {
 #if (OS_CFG_DBG_EN > 0u)
     OS_OBJ_QTY           NbrEntries;
 #endif
+#if (OS_CFG_PEND_LIST_BUCKET_EN > 0u)
+    CPU_DATA             PrioTbl[OS_PRIO_TBL_SIZE];         /* Bitmap of the priorities having at least one waiter    */
+    OS_TCB              *PrioHeadPtr[OS_CFG_PRIO_MAX];      /* First waiter at each priority (valid if bit is set)    */
+#endif
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    OS_PEND_DATA        *MultiHeadPtr;                      /* Tasks waiting in OSPendMulti(), see OS_PEND_DATA       */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                   MULTI-PEND DATA
+*
+* Note(s) : (1) A task waiting in OSPendMulti() on several objects cannot be linked in the pend list of each object
+*               through its OS_TCB.  Each entry of the table passed to OSPendMulti() is instead linked, in priority
+*               order, in the '.MultiHeadPtr' list of the object pended on.
+*
+*           (2) The application fills '.PendObjPtr' of each entry.  The kernel fills the '.RdyXxx' fields of the entry
+*               of the object that readied the task.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+struct  os_pend_data {
+    OS_PEND_DATA        *PrevPtr;                           /* Links in the multi-pend list of the object             */
+    OS_PEND_DATA        *NextPtr;
+    OS_TCB              *TCBPtr;                            /* Task waiting                                           */
+    OS_PEND_OBJ         *PendObjPtr;                        /* Object to pend on, OS_SEM or OS_Q, see Note #2         */
+    OS_PEND_OBJ         *RdyObjPtr;                         /* Object that readied the task, NULL if not this one     */
+    void                *RdyMsgPtr;                         /* Message received, if the object is a queue             */
+    OS_MSG_SIZE          RdyMsgSize;
+    CPU_TS               RdyTS;                             /* Timestamp of the post, abort or delete                 */
 };
+#endif
 
 
 /*
@@ -707,10 +951,22 @@ struct  os_pend_obj {
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     EVENT FLAGS
 *
-* Note(s) : See  PEND OBJ  Note #1'.
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) With OS_CFG_FLAG_WAIT_LIST_EN, each task waiting on the group is also linked, through '.FlagWaitNextPtr'
+*               of its OS_TCB, in '.WaitListTbl[n]', where 'n' is one of the flags it waits on that does not satisfy its
+*               wait yet, see OSFlagPost() Note #4.  A task waiting for ANY of several flags is linked in
+*               '.WaitAnyHeadPtr' instead.  '.FlagWaitBit' of the OS_TCB holds 'n', OS_FLAG_WAIT_ANY or
+*               OS_FLAG_WAIT_NONE.
 ------------------------------------------------------------------------------------------------------------------------
 */
 
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+#define  OS_FLAG_BIT_QTY                    (sizeof(OS_FLAGS) * 8u)
+#define  OS_FLAG_WAIT_ANY                   (CPU_INT08U)0xFEu   /* In '.WaitAnyHeadPtr'                               */
+#define  OS_FLAG_WAIT_NONE                  (CPU_INT08U)0xFFu   /* In no wait list                                    */
+#endif
+
 
 struct  os_flag_grp {                                       /* Event Flag Group                                       */
                                                             /* ------------------ GENERIC  MEMBERS ------------------ */
@@ -728,6 +984,17 @@ struct  os_flag_grp {                                       /* Event Flag Group
 #endif
                                                             /* ------------------ SPECIFIC MEMBERS ------------------ */
     OS_FLAGS             Flags;                             /* 8, 16 or 32 bit flags                                  */
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+    OS_FLAGS             WaitListFlags;                     /* Flags whose entry of .WaitListTbl[] is not empty       */
+    OS_FLAGS             WaitAnyFlags;                      /* Flags the tasks in .WaitAnyHeadPtr wait on (or stale)  */
+    OS_TCB              *WaitAnyHeadPtr;                    /* Tasks waiting for ANY of several flags, see Note #2    */
+    OS_TCB              *WaitListTbl[OS_FLAG_BIT_QTY];      /* Tasks filed under each flag, see Note #2               */
+#else
+    OS_FLAGS             FlagsWatched;                      /* Flags the waiting tasks wait on (may hold stale bits)  */
+#endif
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+    OS_FLAGS             FlagsConsumed;                     /* Flags changed by consuming tasks since the last post   */
+#endif
 #if (OS_CFG_TS_EN > 0u)
     CPU_TS               TS;                                /* Timestamp of when last post occurred                   */
 #endif
@@ -737,6 +1004,74 @@ struct  os_flag_grp {                                       /* Event Flag Group
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 WIDE EVENT FLAGS
+*
+* Note(s) : (1) Bit 'n' of a wide set of flags is bit 'n % OS_FLAG_WIDE_WORD_BITS' of 'Word[n / OS_FLAG_WIDE_WORD_BITS]'.
+*               Flags are held in CPU_DATA words so that a group is matched one word at a time.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_FLAG_WIDE_EN > 0u)
+#define  OS_FLAG_WIDE_WORD_BITS             (CPU_CFG_DATA_SIZE * 8u)
+#define  OS_FLAG_WIDE_WORD_QTY            ((OS_CFG_FLAG_WIDE_WIDTH + (OS_FLAG_WIDE_WORD_BITS - 1u)) / OS_FLAG_WIDE_WORD_BITS)
+
+#define  OS_FLAG_WIDE_BIT_SET(p_flags, bit)     ((p_flags)->Word[(bit) / OS_FLAG_WIDE_WORD_BITS] |=  \
+                                                 ((CPU_DATA)1u << ((bit) % OS_FLAG_WIDE_WORD_BITS)))
+#define  OS_FLAG_WIDE_BIT_CLR(p_flags, bit)     ((p_flags)->Word[(bit) / OS_FLAG_WIDE_WORD_BITS] &= \
+                                                ~((CPU_DATA)1u << ((bit) % OS_FLAG_WIDE_WORD_BITS)))
+#define  OS_FLAG_WIDE_BIT_IS_SET(p_flags, bit) (((p_flags)->Word[(bit) / OS_FLAG_WIDE_WORD_BITS] &  \
+                                                 ((CPU_DATA)1u << ((bit) % OS_FLAG_WIDE_WORD_BITS))) != 0u)
+
+struct  os_flags_wide {                                     /* Wide Event Flags, see Note #1                          */
+    CPU_DATA             Word[OS_FLAG_WIDE_WORD_QTY];
+};
+
+
+struct  os_flag_wide_grp {                                  /* Wide Event Flag Group                                  */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_FLAG_WIDE                 */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Event Flag Name (NUL terminated ASCII)      */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on event flag group              */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_FLAG_WIDE_GRP    *DbgPrevPtr;
+    OS_FLAG_WIDE_GRP    *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_FLAGS_WIDE        Flags;                             /* OS_CFG_FLAG_WIDE_WIDTH flags                           */
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               TS;                                /* Timestamp of when last post occurred                   */
+#endif
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 DEFERRED ISR POSTS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+struct  os_int_q {                                          /* POST DEFERRED FROM AN ISR                              */
+    OS_OBJ_TYPE          Type;                              /* Type of object posted to                               */
+    void                *ObjPtr;                            /* Pointer to the object or to the task posted to         */
+    void                *MsgPtr;                            /* Message posted, for queues                             */
+    OS_MSG_SIZE          MsgSize;                           /* Size of the message posted, for queues                 */
+    OS_FLAGS             Flags;                             /* Flags posted, for event flag groups                    */
+    OS_OPT               Opt;                               /* Post options                                           */
+    CPU_TS               TS;                                /* Time stamp of the post in the ISR                      */
+    OS_TICK              Ticks;                             /* Ticks elapsed, for the tick                            */
+};
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                   MEMORY PARTITIONS
@@ -766,9 +1101,39 @@ struct os_mem {                                             /* MEMORY CONTROL BL
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    MEMORY BUFFERS
+*
+* Note(s) : (1) A memory buffer is a block of a memory partition which starts with this descriptor.  The data follows
+*               the descriptor, so a buffer is passed around (e.g. posted to message queues) by its address only.
+*
+*           (2) .RefCtr counts the holders of the buffer.  The block returns to .MemPtr when the last one releases it.
+*
+*           (3) .NextPtr chains buffers, possibly from different partitions, to scatter data over several blocks.  A
+*               buffer holds one reference on the next buffer of its chain.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_MEM_BUF_EN > 0u)
+struct  os_mem_buf {                                        /* MEMORY BUFFER DESCRIPTOR                               */
+    OS_MEM              *MemPtr;                            /* Partition the block belongs to                         */
+    OS_MEM_BUF          *NextPtr;                           /* Next buffer of the chain, see Note #3                  */
+    CPU_INT08U          *DataPtr;                           /* Pointer to the data, following the descriptor          */
+    OS_MEM_SIZE          DataSize;                          /* Size (in bytes) of the data area                       */
+    OS_MEM_SIZE          DataLen;                           /* Number of bytes of data, set by the application        */
+    OS_OBJ_QTY           RefCtr;                            /* Number of references, see Note #2                      */
+};
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                       MESSAGES
+*
+* Note(s) : (1) A message queue takes its OS_MSGs from OSMsgPool and links them, unless it was created with a ring
+*               (see OSQCreateRing()).  The OS_MSGs of a ring are used in place, in array order, between .InPtr and
+*               .OutPtr, and .NextPtr is unused.
 ------------------------------------------------------------------------------------------------------------------------
 */
 
@@ -803,12 +1168,61 @@ struct  os_msg_q {                                          /* OS_MSG_Q
 #if (OS_CFG_DBG_EN > 0u)
     OS_MSG_QTY           NbrEntriesMax;                     /* Peak number of entries in the queue                    */
 #endif
+#if (OS_CFG_Q_RING_EN > 0u)
+    OS_MSG              *RingPtr;                           /* Ring of NbrEntriesSize OS_MSGs, see MESSAGES Note #1   */
+#endif
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
     CPU_ADDR             MsgQID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    MESSAGE BUFFERS
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.  .PendList holds the tasks waiting for a record.
+*
+*           (2) .PostPendObj holds the tasks waiting for room to post a record.  It is only used as the object those
+*               tasks pend on, and shares the name of the message buffer.
+*
+*           (3) The storage is a ring of .BufSize bytes.  Each record is stored as its length (an OS_MSG_SIZE) followed
+*               by its bytes, and both may wrap around the end of the storage.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_MSG_BUF_EN > 0u)
+struct  os_msg_buf {                                        /* Message Buffer                                         */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_MSG_BUF                   */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Message Buffer Name (NUL terminated ASCII)  */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting for a record                     */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_MSG_BUF          *DbgPrevPtr;
+    OS_MSG_BUF          *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_PEND_OBJ          PostPendObj;                       /* Tasks waiting for room, see Note #2                    */
+    CPU_INT08U          *BufPtr;                            /* Storage of the records, see Note #3                    */
+    OS_MSG_SIZE          BufSize;                           /* Size of the storage (in bytes)                         */
+    OS_MSG_SIZE          InIx;                              /* Index of the next byte to write                        */
+    OS_MSG_SIZE          OutIx;                             /* Index of the next byte to read                         */
+    OS_MSG_SIZE          NbrUsed;                           /* Number of bytes used, lengths included                 */
+    OS_MSG_QTY           NbrEntries;                        /* Number of records in the message buffer                */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_MSG_SIZE          NbrUsedMax;                        /* Peak number of bytes used                              */
+#endif
+};
+
+#define  OS_MSG_BUF_HDR_SIZE       ((OS_MSG_SIZE)sizeof(OS_MSG_SIZE)) /* Length of a record, see Note #3             */
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                              MUTUAL EXCLUSION SEMAPHORES
@@ -835,6 +1249,9 @@ struct  os_mutex {                                          /* Mutual Exclusion
     OS_MUTEX            *MutexGrpNextPtr;
     OS_TCB              *OwnerTCBPtr;
     OS_NESTING_CTR       OwnerNestingCtr;                   /* Mutex is available when the counter is 0               */
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+    OS_PRIO              CeilPrio;                          /* Priority ceiling, OS_PRIO_INIT for inheritance         */
+#endif
 #if (OS_CFG_TS_EN > 0u)
     CPU_TS               TS;
 #endif
@@ -875,7 +1292,10 @@ struct  os_cond {                                           /* Condition Variabl
 ------------------------------------------------------------------------------------------------------------------------
 *                                                    MESSAGE QUEUES
 *
-* Note(s) : See  PEND OBJ  Note #1'.
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) .PostPendObj holds the tasks waiting in OSQPostWait() for room in the queue.  It is only used as the
+*               object those tasks pend on, and shares the name of the queue.
 ------------------------------------------------------------------------------------------------------------------------
 */
 
@@ -895,9 +1315,47 @@ struct  os_q {                                              /* Message Queue
 #endif
                                                             /* ------------------ SPECIFIC MEMBERS ------------------ */
     OS_MSG_Q             MsgQ;                              /* List of messages                                       */
+#if (OS_CFG_Q_SET_EN > 0u)
+    OS_Q_SET            *SetPtr;                            /* Queue set the queue is a member of, if any             */
+#endif
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    OS_PEND_OBJ          PostPendObj;                       /* Tasks waiting for room, see Note #2                    */
+#endif
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      QUEUE SETS
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) The messages of a queue set are pointers to its members (OS_Q or OS_SEM), one per message or count
+*               posted to a member while no task was waiting on the member, in post order.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_Q_SET_EN > 0u)
+struct  os_q_set {                                          /* Queue Set                                              */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_Q_SET                     */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Queue Set Name (NUL terminated ASCII)       */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on queue set                     */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_Q_SET            *DbgPrevPtr;
+    OS_Q_SET            *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_MSG_Q             MsgQ;                              /* List of members posted to, see Note #2                 */
+};
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                      SEMAPHORES
@@ -925,6 +1383,9 @@ struct  os_sem {                                            /* Semaphore
 #if (OS_CFG_TS_EN > 0u)
     CPU_TS               TS;
 #endif
+#if (OS_CFG_Q_SET_EN > 0u)
+    OS_Q_SET            *SetPtr;                            /* Queue set the semaphore is a member of, if any         */
+#endif
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
     CPU_ADDR             SemID;                             /* Unique ID for third-party debuggers and tracers.       */
 #endif
@@ -974,9 +1435,20 @@ struct os_tcb {
     OS_PEND_OBJ         *PendObjPtr;                        /* Pointer to object pended on.                           */
     OS_STATE             PendOn;                            /* Indicates what task is pending on                      */
     OS_STATUS            PendStatus;                        /* Pend status                                            */
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    OS_PEND_DATA        *PendDataTblPtr;                    /* Objects pended on in OSPendMulti()                     */
+    OS_OBJ_QTY           PendDataTblEntries;                /* Number of entries in the table                         */
+#endif
+#if (OS_CFG_PEND_LIST_BUCKET_EN > 0u)
+    OS_PRIO              PendListPrio;                      /* Priority bucket of the pend list holding the task      */
+#endif
 
     OS_STATE             TaskState;                         /* See OS_TASK_STATE_xxx                                  */
     OS_PRIO              Prio;                              /* Task priority (0 == highest)                           */
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    OS_CORE_ID           CoreId;                            /* Core running the task, OS_CORE_ID_NONE if not running  */
+    CPU_BOOLEAN          DelReq;                            /* Task deleted from another core, see OSTaskDel()        */
+#endif
 #if (OS_CFG_MUTEX_EN > 0u)
     OS_PRIO              BasePrio;                          /* Base priority (Not inherited)                          */
     OS_MUTEX            *MutexGrpHeadPtr;                   /* Owned mutex group head pointer                         */
@@ -999,6 +1471,10 @@ struct os_tcb {
 #if (OS_CFG_TICK_EN > 0u)
     OS_TICK              TickRemain;                        /* Number of ticks remaining                              */
     OS_TICK              TickCtrPrev;                       /* Used by OSTimeDlyXX() in PERIODIC mode                 */
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OS_TICK              TickCtrMatch;                      /* Tick wheel time at which the delay/timeout expires     */
+    OS_TICK_SPOKE       *TickSpokePtr;                      /* Pointer to tick wheel spoke the task is linked in      */
+#endif
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
@@ -1006,13 +1482,44 @@ struct os_tcb {
     OS_TICK              TimeQuantaCtr;
 #endif
 
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+    OS_PRIO              PreemptThres;                      /* Only tasks above this priority preempt the task        */
+    CPU_BOOLEAN          PreemptThresActive;                /* Task in the preemption threshold stack                 */
+    OS_TCB              *PreemptThresNextPtr;               /* Task below in the preemption threshold stack           */
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    OS_TICK              Budget;                            /* CPU budget per replenishment period, in ticks          */
+    OS_TICK              BudgetRemain;                      /* CPU budget left in the current period                  */
+    OS_TICK              BudgetPeriod;                      /* Replenishment period, in ticks                         */
+    OS_TICK              BudgetReplenishTick;               /* OSTickCtr value at which the budget is replenished     */
+    OS_OPT               BudgetOpt;                         /* Action taken when the budget is exhausted              */
+    OS_PRIO              BudgetPrio;                        /* Priority of the task while out of budget               */
+    OS_PRIO              BudgetPrioSave;                    /* Base priority to restore on replenishment              */
+    CPU_BOOLEAN          BudgetActive;                      /* Budget being consumed, replenishment pending           */
+    CPU_BOOLEAN          BudgetExhausted;                   /* Task demoted or suspended for lack of budget           */
+    OS_CTR               BudgetOverrunCtr;                  /* Number of times the task exhausted its budget          */
+    OS_TCB              *BudgetNextPtr;                     /* Next task in the list of tasks with a budget           */
+#endif
+
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    OS_TICK              DeadlineRel;                       /* Relative deadline of each job (0 means no deadline)    */
+    OS_TICK              DeadlineAbs;                       /* Absolute deadline of the current job, in OSTickCtr     */
+#endif
+
 #if (OS_MSG_EN > 0u)
     void                *MsgPtr;                            /* Message received                                       */
     OS_MSG_SIZE          MsgSize;
 #endif
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    OS_OPT               PostOpt;                           /* Options of the post waiting for room, MsgPtr/MsgSize   */
+#endif
 
 #if (OS_CFG_TASK_Q_EN > 0u)
     OS_MSG_Q             MsgQ;                              /* Message queue associated with task                     */
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    OS_PEND_OBJ          MsgQPostPendObj;                   /* Tasks waiting in OSTaskQPostWait() for room in MsgQ    */
+#endif
 #if (OS_CFG_TASK_PROFILE_EN > 0u)
     CPU_TS               MsgQPendTime;                      /* Time it took for signal to be received                 */
     CPU_TS               MsgQPendTimeMax;                   /* Max amount of time it took for signal to be received   */
@@ -1027,6 +1534,15 @@ struct os_tcb {
     OS_FLAGS             FlagsPend;                         /* Event flag(s) to wait on                               */
     OS_FLAGS             FlagsRdy;                          /* Event flags that made task ready to run                */
     OS_OPT               FlagsOpt;                          /* Options (See OS_OPT_FLAG_xxx)                          */
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+    OS_TCB              *FlagWaitNextPtr;                   /* Links in a wait list of the group, see EVENT FLAGS ... */
+    OS_TCB              *FlagWaitPrevPtr;
+    CPU_INT08U           FlagWaitBit;                       /* ... Note #2                                            */
+#endif
+#if (OS_CFG_FLAG_WIDE_EN > 0u)
+    OS_FLAGS_WIDE       *FlagsWidePendPtr;                  /* Wide event flags to wait on                            */
+    OS_FLAGS_WIDE       *FlagsWideRdyPtr;                   /* Wide event flags that made task ready to run           */
+#endif
 #endif
 
 #if (OS_CFG_TASK_SUSPEND_EN > 0u)
@@ -1075,8 +1591,24 @@ struct os_tcb {
 ------------------------------------------------------------------------------------------------------------------------
 */
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+struct  os_tick_spoke {
+    OS_TCB              *FirstPtr;                          /* Pointer to list of tasks linked in this spoke         */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_OBJ_QTY           NbrEntries;                        /* Current number of entries in the spoke                */
+#endif
+};
+#endif
+
+
 struct  os_tick_list {
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OS_TICK_SPOKE        Spokes[OS_TICK_WHEEL_LVL_QTY][OS_TICK_WHEEL_SPOKE_QTY];
+    OS_OBJ_QTY           LvlNbrEntries[OS_TICK_WHEEL_LVL_QTY];
+    OS_TICK              WheelCtr;                          /* Current tick wheel time                               */
+#else
     OS_TCB              *TCB_Ptr;                           /* Pointer to list of tasks in tick list                 */
+#endif
 #if (OS_CFG_DBG_EN > 0u)
     OS_OBJ_QTY           NbrEntries;                        /* Current number of entries in the tick list            */
     OS_OBJ_QTY           NbrUpdated;                        /* Number of entries updated                             */
@@ -1106,6 +1638,10 @@ struct  os_tmr {
     OS_TICK              Period;                            /* Period to repeat timer                                 */
     OS_OPT               Opt;                               /* Options (see OS_OPT_TMR_xxx)                           */
     OS_STATE             State;
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    OS_TICK              Match;                             /* Tick at which the timer expires                        */
+    OS_TMR_SPOKE        *SpokePtr;                          /* Pointer to timer wheel spoke the timer is linked in    */
+#endif
 #if (OS_CFG_DBG_EN > 0u)
     OS_TMR              *DbgPrevPtr;
     OS_TMR              *DbgNextPtr;
@@ -1113,6 +1649,20 @@ struct  os_tmr {
 };
 
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+struct  os_tmr_spoke {
+    OS_TMR              *FirstPtr;                          /* Pointer to list of timers linked in this spoke         */
+};
+
+
+struct  os_tmr_wheel {
+    OS_TMR_SPOKE         Spokes[OS_TMR_WHEEL_LVL_QTY][OS_TMR_WHEEL_SPOKE_QTY];
+    OS_OBJ_QTY           LvlNbrEntries[OS_TMR_WHEEL_LVL_QTY];
+    OS_TMR_SPOKE         Expired;                           /* Timers expired and waiting for their callback          */
+};
+#endif
+
+
 /*
 ************************************************************************************************************************
 ************************************************************************************************************************
@@ -1141,10 +1691,31 @@ OS_EXT            OS_IDLE_CTR               OSIdleTaskCtr;
 #endif
 #if (OS_CFG_TASK_IDLE_EN > 0u)
 OS_EXT            OS_TCB                    OSIdleTaskTCB;
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+OS_EXT            OS_TCB                    OSIdleTaskCoreTCB[OS_CFG_SMP_CORE_QTY - 1u]; /* Idle tasks of other cores */
+#endif
+#endif
+
+                                                                        /* ISR HANDLER TASK ------------------------- */
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+OS_EXT            OS_TCB                    OSIntQTaskTCB;
+OS_EXT            CPU_BOOLEAN               OSIntQTaskRdy;              /* ISR handler task is in the ready list      */
+#if (OS_CFG_TS_EN > 0u)
+OS_EXT            CPU_TS                    OSIntQTaskTS;               /* Time stamp of the post being replayed      */
+#endif
+OS_EXT            OS_OBJ_QTY                OSIntQInIx;                 /* Next entry filled by an ISR                */
+OS_EXT            OS_OBJ_QTY                OSIntQOutIx;                /* Next entry replayed by the task            */
+OS_EXT            OS_OBJ_QTY                OSIntQNbrEntries;           /* Number of posts not replayed yet           */
+OS_EXT            OS_OBJ_QTY                OSIntQNbrEntriesMax;        /* Peak number of posts waiting               */
+OS_EXT            OS_OBJ_QTY                OSIntQOvfCtr;               /* Number of posts lost to a full queue       */
 #endif
 
                                                                         /* MISCELLANEOUS ---------------------------- */
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+OS_EXT            OS_CORE                   OSCoreTbl[OS_CFG_SMP_CORE_QTY]; /* Per core scheduling state          */
+#else
 OS_EXT            OS_NESTING_CTR            OSIntNestingCtr;            /* Interrupt nesting level                    */
+#endif
 #ifdef CPU_CFG_INT_DIS_MEAS_EN
 #if (OS_CFG_TS_EN > 0u)
 OS_EXT            CPU_TS                    OSIntDisTimeMax;            /* Overall interrupt disable time             */
@@ -1164,6 +1735,10 @@ OS_EXT            CPU_INT32U                OSISRStkUsed;               /* Numbe
 #if (OS_CFG_DBG_EN  > 0u)
 OS_EXT            OS_FLAG_GRP              *OSFlagDbgListPtr;
 OS_EXT            OS_OBJ_QTY                OSFlagQty;
+#if (OS_CFG_FLAG_WIDE_EN > 0u)
+OS_EXT            OS_FLAG_WIDE_GRP         *OSFlagWideDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSFlagWideQty;
+#endif
 #endif
 #endif
 
@@ -1173,6 +1748,14 @@ OS_EXT            OS_OBJ_QTY                OSFlagQty;
 OS_EXT            OS_MEM                   *OSMemDbgListPtr;
 OS_EXT            OS_OBJ_QTY                OSMemQty;                   /* Number of memory partitions created        */
 #endif
+#endif
+
+                                                                        /* MESSAGE BUFFERS -------------------------- */
+#if (OS_CFG_MSG_BUF_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_MSG_BUF               *OSMsgBufDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSMsgBufQty;                /* Number of message buffers created          */
+#endif
 #endif
 
                                                                         /* OS_MSG POOL ------------------------------ */
@@ -1189,15 +1772,24 @@ OS_EXT            OS_OBJ_QTY                OSMutexQty;                 /* Numbe
 #endif
 
                                                                         /* PRIORITIES ------------------------------- */
+#if (OS_CFG_SMP_CORE_QTY == 1u)
 OS_EXT            OS_PRIO                   OSPrioCur;                  /* Priority of current task                   */
 OS_EXT            OS_PRIO                   OSPrioHighRdy;              /* Priority of highest priority task          */
+#endif
 OS_EXT            CPU_DATA                  OSPrioTbl[OS_PRIO_TBL_SIZE];
+#if (OS_CFG_PRIO_MAX > (2u * (CPU_CFG_DATA_SIZE * 8u)))
+OS_EXT            CPU_DATA                  OSPrioGrpTbl[OS_PRIO_GRP_TBL_SIZE]; /* Non-empty entries of OSPrioTbl[] */
+#endif
 
                                                                         /* QUEUES ----------------------------------- */
 #if (OS_CFG_Q_EN > 0u)
 #if (OS_CFG_DBG_EN > 0u)
 OS_EXT            OS_Q                     *OSQDbgListPtr;
 OS_EXT            OS_OBJ_QTY                OSQQty;                     /* Number of message queues created           */
+#if (OS_CFG_Q_SET_EN > 0u)
+OS_EXT            OS_Q_SET                 *OSQSetDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSQSetQty;                  /* Number of queue sets created               */
+#endif
 #endif
 #endif
 
@@ -1217,10 +1809,19 @@ OS_EXT            CPU_TS_TMR                OSSchedLockTimeMax;
 OS_EXT            CPU_TS_TMR                OSSchedLockTimeMaxCur;
 #endif
 
+#if (OS_CFG_SMP_CORE_QTY == 1u)
 OS_EXT            OS_NESTING_CTR            OSSchedLockNestingCtr;      /* Lock nesting level                         */
+#endif
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
 OS_EXT            OS_TICK                   OSSchedRoundRobinDfltTimeQuanta;
 OS_EXT            CPU_BOOLEAN               OSSchedRoundRobinEn;        /* Enable/Disable round-robin scheduling      */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_EXT            OS_TICK                   OSSchedRoundRobinTickCtrPrev; /* Tick up to which quanta was charged      */
+#endif
+#endif
+
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+OS_EXT            OS_TCB                   *OSSchedPreemptThresTCBPtr;  /* Top of the preemption threshold stack      */
 #endif
                                                                         /* SEMAPHORES ------------------------------- */
 #if (OS_CFG_SEM_EN > 0u)
@@ -1254,6 +1855,10 @@ OS_EXT            OS_TCB                   *OSTaskDbgListPtr;
 #endif
 #endif
 
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+OS_EXT            OS_TCB                   *OSTaskBudgetListPtr;        /* List of the tasks with a CPU budget        */
+#endif
+
 OS_EXT            OS_OBJ_QTY                OSTaskQty;                  /* Number of tasks created                    */
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -1280,7 +1885,11 @@ OS_EXT            CPU_TS                    OSTickTimeMax;
 OS_EXT            OS_TMR                   *OSTmrDbgListPtr;
 OS_EXT            OS_OBJ_QTY                OSTmrListEntries;           /* Doubly-linked list of timers               */
 #endif
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+OS_EXT            OS_TMR_WHEEL              OSTmrWheel;                 /* Timer wheel, relative to OSTmrTaskTickBase */
+#else
 OS_EXT            OS_TMR                   *OSTmrListPtr;
+#endif
 OS_EXT            OS_COND                   OSTmrCond;
 OS_EXT            OS_MUTEX                  OSTmrMutex;
 
@@ -1300,8 +1909,10 @@ OS_EXT            OS_TICK                   OSTmrToTicksMult;           /* Conve
 
 
                                                                         /* TCBs ------------------------------------- */
+#if (OS_CFG_SMP_CORE_QTY == 1u)
 OS_EXT            OS_TCB                   *OSTCBCurPtr;                /* Pointer to currently running TCB           */
 OS_EXT            OS_TCB                   *OSTCBHighRdyPtr;            /* Pointer to highest priority  TCB           */
+#endif
 
 
 /*
@@ -1321,6 +1932,16 @@ extern  CPU_STK     * const OSCfg_ISRStkBasePtr;
 extern  CPU_STK_SIZE  const OSCfg_ISRStkSize;
 extern  CPU_INT32U    const OSCfg_ISRStkSizeRAM;
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+extern  OS_INT_Q    * const OSCfg_IntQBasePtr;
+extern  OS_OBJ_QTY    const OSCfg_IntQSize;
+extern  CPU_INT32U    const OSCfg_IntQSizeRAM;
+extern  CPU_STK     * const OSCfg_IntQTaskStkBasePtr;
+extern  CPU_STK_SIZE  const OSCfg_IntQTaskStkLimit;
+extern  CPU_STK_SIZE  const OSCfg_IntQTaskStkSize;
+extern  CPU_INT32U    const OSCfg_IntQTaskStkSizeRAM;
+#endif
+
 extern  OS_MSG_SIZE   const OSCfg_MsgPoolSize;
 extern  CPU_INT32U    const OSCfg_MsgPoolSizeRAM;
 extern  OS_MSG      * const OSCfg_MsgPoolBasePtr;
@@ -1347,12 +1968,20 @@ extern  CPU_INT32U    const OSCfg_DataSizeRAM;
 
 #if (OS_CFG_TASK_IDLE_EN > 0u)
 extern  CPU_STK        OSCfg_IdleTaskStk[OS_CFG_IDLE_TASK_STK_SIZE];
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+extern  CPU_STK        OSCfg_IdleTaskCoreStk[OS_CFG_SMP_CORE_QTY - 1u][OS_CFG_IDLE_TASK_STK_SIZE];
+#endif
 #endif
 
 #if (OS_CFG_ISR_STK_SIZE > 0u)
 extern  CPU_STK        OSCfg_ISRStk[OS_CFG_ISR_STK_SIZE];
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+extern  OS_INT_Q       OSCfg_IntQ[OS_CFG_INT_Q_SIZE];
+extern  CPU_STK        OSCfg_IntQTaskStk[OS_CFG_INT_Q_TASK_STK_SIZE];
+#endif
+
 #if (OS_MSG_EN > 0u)
 extern  OS_MSG         OSCfg_MsgPool[OS_CFG_MSG_POOL_SIZE];
 #endif
@@ -1428,6 +2057,53 @@ void          OS_FlagDbgListRemove      (OS_FLAG_GRP           *p_grp);
 void          OS_FlagTaskRdy            (OS_TCB                *p_tcb,
                                          OS_FLAGS               flags_rdy,
                                          CPU_TS                 ts);
+
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+void          OS_FlagWaitListRemove     (OS_TCB                *p_tcb);
+#endif
+
+#if (OS_CFG_FLAG_WIDE_EN > 0u)
+void          OSFlagWideCreate          (OS_FLAG_WIDE_GRP      *p_grp,
+                                         CPU_CHAR              *p_name,
+                                         const  OS_FLAGS_WIDE  *p_flags,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_FLAG_DEL_EN > 0u)
+OS_OBJ_QTY    OSFlagWideDel             (OS_FLAG_WIDE_GRP      *p_grp,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSFlagWidePend            (OS_FLAG_WIDE_GRP      *p_grp,
+                                         const  OS_FLAGS_WIDE  *p_flags,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_FLAGS_WIDE         *p_flags_rdy,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_FLAG_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY    OSFlagWidePendAbort       (OS_FLAG_WIDE_GRP      *p_grp,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSFlagWidePost            (OS_FLAG_WIDE_GRP      *p_grp,
+                                         const  OS_FLAGS_WIDE  *p_flags,
+                                         OS_OPT                 opt,
+                                         OS_FLAGS_WIDE         *p_flags_cur,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_FlagWideClr            (OS_FLAG_WIDE_GRP      *p_grp);
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_FlagWideDbgListAdd     (OS_FLAG_WIDE_GRP      *p_grp);
+
+void          OS_FlagWideDbgListRemove  (OS_FLAG_WIDE_GRP      *p_grp);
+#endif
+#endif
 #endif
 
 
@@ -1451,6 +2127,22 @@ void          OSMemPut                  (OS_MEM                *p_mem,
                                          void                  *p_blk,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_MEM_BUF_EN > 0u)
+OS_MEM_BUF   *OSMemBufGet               (OS_MEM                *p_mem,
+                                         OS_ERR                *p_err);
+
+void          OSMemBufChain             (OS_MEM_BUF            *p_buf,
+                                         OS_MEM_BUF            *p_next,
+                                         OS_ERR                *p_err);
+
+void          OSMemBufRefAdd            (OS_MEM_BUF            *p_buf,
+                                         OS_OBJ_QTY             qty,
+                                         OS_ERR                *p_err);
+
+void          OSMemBufRelease           (OS_MEM_BUF            *p_buf,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 #if (OS_CFG_DBG_EN > 0u)
@@ -1462,6 +2154,47 @@ void          OS_MemInit                (OS_ERR                *p_err);
 #endif
 
 
+/* ================================================================================================================== */
+/*                                                   MESSAGE BUFFERS                                                  */
+/* ================================================================================================================== */
+
+#if (OS_CFG_MSG_BUF_EN > 0u)
+
+void          OSMsgBufCreate            (OS_MSG_BUF            *p_buf,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_storage,
+                                         OS_MSG_SIZE            size,
+                                         OS_ERR                *p_err);
+
+OS_OBJ_QTY    OSMsgBufDel               (OS_MSG_BUF            *p_buf,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+OS_MSG_SIZE   OSMsgBufPend              (OS_MSG_BUF            *p_buf,
+                                         void                  *p_data,
+                                         OS_MSG_SIZE            size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSMsgBufPost              (OS_MSG_BUF            *p_buf,
+                                         const  void           *p_data,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_MsgBufDbgListAdd       (OS_MSG_BUF            *p_buf);
+
+void          OS_MsgBufDbgListRemove    (OS_MSG_BUF            *p_buf);
+#endif
+
+#endif
+
+
 /* ================================================================================================================== */
 /*                                             MUTUAL EXCLUSION SEMAPHORES                                            */
 /* ================================================================================================================== */
@@ -1472,6 +2205,13 @@ void          OSMutexCreate             (OS_MUTEX              *p_mutex,
                                          CPU_CHAR              *p_name,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+void          OSMutexCreateCeiling      (OS_MUTEX              *p_mutex,
+                                         CPU_CHAR              *p_name,
+                                         OS_PRIO                prio_ceil,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_MUTEX_DEL_EN > 0u)
 OS_OBJ_QTY    OSMutexDel                (OS_MUTEX              *p_mutex,
                                          OS_OPT                 opt,
@@ -1517,6 +2257,38 @@ void          OS_MutexGrpPostAll        (OS_TCB                *p_tcb);
 #endif
 
 
+/* ================================================================================================================== */
+/*                                              PEND ON MULTIPLE OBJECTS                                              */
+/* ================================================================================================================== */
+
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+
+OS_OBJ_QTY    OSPendMulti               (OS_PEND_DATA          *p_pend_data_tbl,
+                                         OS_OBJ_QTY             tbl_size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+OS_TCB       *OS_PendMultiHeadGet       (OS_PEND_LIST          *p_pend_list);
+
+void          OS_PendMultiRdy           (OS_TCB                *p_tcb,
+                                         OS_PEND_OBJ           *p_obj,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         CPU_TS                 ts);
+
+void          OS_PendMultiRemove        (OS_TCB                *p_tcb);
+
+void          OS_PendMultiChangePrio    (OS_TCB                *p_tcb);
+
+#define  OS_PEND_LIST_HEAD_GET(p_pend_list)         OS_PendMultiHeadGet(p_pend_list)
+#else
+#define  OS_PEND_LIST_HEAD_GET(p_pend_list)       ((p_pend_list)->HeadPtr)
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                   MESSAGE QUEUES                                                   */
 /* ================================================================================================================== */
@@ -1528,6 +2300,14 @@ void          OSQCreate                 (OS_Q                  *p_q,
                                          OS_MSG_QTY             max_qty,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_RING_EN > 0u)
+void          OSQCreateRing             (OS_Q                  *p_q,
+                                         CPU_CHAR              *p_name,
+                                         OS_MSG                *p_ring,
+                                         OS_MSG_QTY             max_qty,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_Q_DEL_EN > 0u)
 OS_OBJ_QTY    OSQDel                    (OS_Q                  *p_q,
                                          OS_OPT                 opt,
@@ -1552,12 +2332,41 @@ OS_OBJ_QTY    OSQPendAbort              (OS_Q                  *p_q,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_Q_MULTI_EN > 0u)
+OS_MSG_QTY    OSQPendMulti              (OS_Q                  *p_q,
+                                         void                 **p_void_tbl,
+                                         OS_MSG_SIZE           *p_msg_size_tbl,
+                                         OS_MSG_QTY             nbr_msgs,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+#endif
+
 void          OSQPost                   (OS_Q                  *p_q,
                                          void                  *p_void,
                                          OS_MSG_SIZE            msg_size,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_MULTI_EN > 0u)
+OS_MSG_QTY    OSQPostMulti              (OS_Q                  *p_q,
+                                         void                 **p_void_tbl,
+                                         OS_MSG_SIZE           *p_msg_size_tbl,
+                                         OS_MSG_QTY             nbr_msgs,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+void          OSQPostWait               (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_QClr                   (OS_Q                  *p_q);
@@ -1568,6 +2377,57 @@ void          OS_QDbgListAdd            (OS_Q                  *p_q);
 void          OS_QDbgListRemove         (OS_Q                  *p_q);
 #endif
 
+CPU_BOOLEAN   OS_QPost                  (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+CPU_BOOLEAN   OS_QPostWaitRdy           (OS_Q                  *p_q);
+#endif
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                     QUEUE SETS                                                     */
+/* ================================================================================================================== */
+
+#if (OS_CFG_Q_SET_EN > 0u)
+
+void          OSQSetAdd                 (OS_Q_SET              *p_set,
+                                         OS_PEND_OBJ           *p_obj,
+                                         OS_ERR                *p_err);
+
+void          OSQSetCreate              (OS_Q_SET              *p_set,
+                                         CPU_CHAR              *p_name,
+                                         OS_MSG_QTY             max_qty,
+                                         OS_ERR                *p_err);
+
+OS_PEND_OBJ  *OSQSetPend                (OS_Q_SET              *p_set,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSQSetRemove              (OS_Q_SET              *p_set,
+                                         OS_PEND_OBJ           *p_obj,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_QSetPost               (OS_Q_SET              *p_set,
+                                         OS_PEND_OBJ           *p_obj,
+                                         OS_MSG_QTY             msg_qty,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_QSetDbgListAdd         (OS_Q_SET              *p_set);
+#endif
+
 #endif
 
 
@@ -1672,6 +2532,15 @@ void          OSTaskQPost               (OS_TCB                *p_tcb,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+void          OSTaskQPostWait           (OS_TCB                *p_tcb,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -1735,11 +2604,36 @@ void          OSTaskTimeQuantaSet       (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+void          OSTaskBudgetSet           (OS_TCB                *p_tcb,
+                                         OS_TICK                budget,
+                                         OS_TICK                period,
+                                         OS_PRIO                prio,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+void          OSTaskPreemptThresSet     (OS_TCB                *p_tcb,
+                                         OS_PRIO                prio_thres,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+void          OSTaskDeadlineSet         (OS_TCB                *p_tcb,
+                                         OS_TICK                deadline,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_TaskBlock              (OS_TCB                *p_tcb,
                                          OS_TICK                timeout);
 
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+void          OS_TaskBudgetTick         (OS_TCB                *p_tcb);
+#endif
+
 #if (OS_CFG_DBG_EN > 0u)
 void          OS_TaskDbgListAdd         (OS_TCB                *p_tcb);
 
@@ -1750,6 +2644,10 @@ void          OS_TaskInit               (OS_ERR                *p_err);
 
 void          OS_TaskInitTCB            (OS_TCB                *p_tcb);
 
+#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_Q_POST_WAIT_EN > 0u)
+CPU_BOOLEAN   OS_TaskQPostWaitRdy       (OS_TCB                *p_tcb);
+#endif
+
 void          OS_TaskReturn             (void);
 
 #if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
@@ -1928,6 +2826,23 @@ void          OS_IdleTask               (void                  *p_arg);
 
 void          OS_IdleTaskInit           (OS_ERR                *p_err);
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+void          OS_IntQTask               (void                  *p_arg);
+
+void          OS_IntQTaskInit           (OS_ERR                *p_err);
+
+void          OS_IntQPost               (OS_OBJ_TYPE            type,
+                                         void                  *p_obj,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_FLAGS               flags,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+
+void          OS_IntQTickPost           (OS_TICK                ticks);
+#endif
+
 #if (OS_CFG_STAT_TASK_EN > 0u)
 void          OS_StatTask               (void                  *p_arg);
 #endif
@@ -1936,6 +2851,10 @@ void          OS_StatTaskInit           (OS_ERR                *p_err);
 
 void          OS_TickInit               (OS_ERR                *p_err);
 void          OS_TickUpdate             (OS_TICK                ticks);
+#if (OS_CFG_DYN_TICK_EN > 0u)
+void          OS_TickStepSet            (void);
+void          OS_TickCtrAdvance         (OS_TICK                ticks);
+#endif
 
 /*
 ************************************************************************************************************************
@@ -1972,6 +2891,12 @@ void          OSTaskSwHook              (void);
 
 void          OSTimeTickHook            (void);
 
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+OS_CORE_ID    OS_CPU_CoreIdGet          (void);
+
+void          OS_CPU_CoreSchedReq       (OS_CORE_ID             core_id);
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -2002,6 +2927,12 @@ void         *OS_MsgQGet                (OS_MSG_Q              *p_msg_q,
 void          OS_MsgQInit               (OS_MSG_Q              *p_msg_q,
                                          OS_MSG_QTY             size);
 
+#if (OS_CFG_Q_RING_EN > 0u)
+void          OS_MsgQRingInit           (OS_MSG_Q              *p_msg_q,
+                                         OS_MSG                *p_ring,
+                                         OS_MSG_QTY             size);
+#endif
+
 void          OS_MsgQPut                (OS_MSG_Q              *p_msg_q,
                                          void                  *p_void,
                                          OS_MSG_SIZE            msg_size,
@@ -2043,8 +2974,24 @@ void          OS_SchedLockTimeMeasStart (void);
 void          OS_SchedLockTimeMeasStop  (void);
 #endif
 
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+void          OS_SchedPreemptThres      (void);
+
+void          OS_SchedPreemptThresDel   (OS_TCB                *p_tcb);
+#endif
+
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
-void          OS_SchedRoundRobin        (OS_RDY_LIST           *p_rdy_list);
+void          OS_SchedRoundRobin        (OS_RDY_LIST           *p_rdy_list,
+                                         OS_TICK                ticks);
+#if (OS_CFG_DYN_TICK_EN > 0u)
+void          OS_SchedRoundRobinDynTick (void);
+#endif
+#endif
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+OS_TCB       *OS_SchedCoreHighRdyGet    (OS_CORE_ID             core_id);
+
+void          OS_SchedCoreHighRdySet    (void);
 #endif
 
 /* --------------------------------------------- READY LIST MANAGEMENT ---------------------------------------------- */
@@ -2057,6 +3004,10 @@ void          OS_RdyListInsertHead      (OS_TCB                *p_tcb);
 
 void          OS_RdyListInsertTail      (OS_TCB                *p_tcb);
 
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+void          OS_RdyListInsertEDF       (OS_TCB                *p_tcb);
+#endif
+
 void          OS_RdyListMoveHeadToTail  (OS_RDY_LIST           *p_rdy_list);
 
 void          OS_RdyListRemove          (OS_TCB                *p_tcb);
@@ -2158,6 +3109,41 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #endif
 
 
+#if (OS_CFG_PEND_MULTI_EN > 0u) && (OS_CFG_SEM_EN == 0u) && (OS_CFG_Q_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_SEM_EN or OS_CFG_Q_EN must be Enabled (1) to use OSPendMulti()"
+#endif
+
+
+#if (OS_CFG_Q_SET_EN > 0u) && (OS_CFG_Q_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_Q_EN must be Enabled (1) to use queue sets"
+#endif
+
+
+#if (OS_CFG_Q_RING_EN > 0u) && (OS_CFG_Q_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_Q_EN must be Enabled (1) to use ring message queues"
+#endif
+
+
+#if (OS_CFG_MSG_BUF_EN > 0u) && (OS_MSG_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_Q_EN or OS_CFG_TASK_Q_EN must be Enabled (1) to use message buffers"
+#endif
+
+
+#if (OS_CFG_MEM_BUF_EN > 0u) && (OS_CFG_MEM_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_MEM_EN must be Enabled (1) to use memory buffers"
+#endif
+
+
+#if (OS_CFG_Q_POST_WAIT_EN > 0u) && (OS_MSG_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_Q_EN or OS_CFG_TASK_Q_EN must be Enabled (1) to use OSQPostWait() or OSTaskQPostWait()"
+#endif
+
+
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u) && (OS_CFG_FLAG_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_FLAG_EN must be Enabled (1) to use the wait lists of event flag groups"
+#endif
+
+
 #ifndef OS_CFG_SCHED_LOCK_TIME_MEAS_EN
 #error  "OS_CFG.H, Missing OS_CFG_SCHED_LOCK_TIME_MEAS_EN: Include code to measure scheduler lock time"
 #else
@@ -2170,9 +3156,60 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 
 #ifndef OS_CFG_SCHED_ROUND_ROBIN_EN
 #error  "OS_CFG.H, Missing OS_CFG_SCHED_ROUND_ROBIN_EN: Include code for Round Robin Scheduling"
-#else
-    #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_DYN_TICK_EN > 0u)
-    #error "OS_CFG.H, OS_CFG_DYN_TICK_EN must be Disabled (0) to use Round Robin scheduling."
+#endif
+
+
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    #ifndef OS_CFG_SCHED_EDF_PRIO
+    #error  "OS_CFG.H, Missing OS_CFG_SCHED_EDF_PRIO: Priority level scheduled Earliest Deadline First"
+    #elif   (OS_CFG_SCHED_EDF_PRIO >= (OS_CFG_PRIO_MAX - 1u))
+    #error  "OS_CFG.H, OS_CFG_SCHED_EDF_PRIO must be < OS_CFG_PRIO_MAX - 1 (the idle task priority)"
+    #endif
+    #if (OS_CFG_TICK_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to use Earliest Deadline First scheduling"
+    #endif
+#endif
+
+
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+    #if (OS_CFG_SMP_CORE_QTY > 1u)
+    #error  "OS_CFG.H, OS_CFG_SCHED_PREEMPT_THRES_EN is not supported with more than one core"
+    #endif
+#endif
+
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    #ifndef OS_CFG_INT_Q_SIZE
+    #error  "OS_CFG_APP.H, Missing OS_CFG_INT_Q_SIZE: Number of posts ISRs can defer to the ISR handler task"
+    #endif
+    #ifndef OS_CFG_INT_Q_TASK_STK_SIZE
+    #error  "OS_CFG_APP.H, Missing OS_CFG_INT_Q_TASK_STK_SIZE: Stack size of the ISR handler task"
+    #endif
+    #if (OS_CFG_SMP_CORE_QTY > 1u)
+    #error  "OS_CFG.H, OS_CFG_ISR_POST_DEFERRED_EN is not supported with more than one core"
+    #endif
+    #if (OS_CFG_SCHED_EDF_EN > 0u) && (OS_CFG_SCHED_EDF_PRIO == 0u)
+    #error  "OS_CFG.H, OS_CFG_SCHED_EDF_PRIO must be > 0, priority 0 is reserved for the ISR handler task"
+    #endif
+#endif
+
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    #if (OS_CFG_TICK_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to enforce task CPU budgets"
+    #endif
+    #if (OS_CFG_DYN_TICK_EN > 0u)
+    #error  "OS_CFG.H, OS_CFG_TASK_BUDGET_EN is not supported with the Dynamic Tick"
+    #endif
+#endif
+
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    #if (OS_CFG_TASK_IDLE_EN == 0u)
+    #error "OS_CFG.H, OS_CFG_TASK_IDLE_EN must be Enabled (1) to use more than one core"
+    #endif
+    #if (OS_CFG_SMP_CORE_QTY >= 255u)
+    #error "OS_CFG.H, OS_CFG_SMP_CORE_QTY must be < 255"
     #endif
 #endif
 
@@ -2210,6 +3247,14 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #ifndef OS_CFG_FLAG_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_FLAG_PEND_ABORT_EN: Include code for aborting pends from another task"
     #endif
+
+    #if (OS_CFG_FLAG_WIDE_EN > 0u)
+        #ifndef OS_CFG_FLAG_WIDE_WIDTH
+        #error  "OS_CFG.H, Missing OS_CFG_FLAG_WIDE_WIDTH: Number of flags in a wide event flag group"
+        #elif   (OS_CFG_FLAG_WIDE_WIDTH == 0u)
+        #error  "OS_CFG.H, OS_CFG_FLAG_WIDE_WIDTH must be > 0"
+        #endif
+    #endif
 #endif
 
 /*
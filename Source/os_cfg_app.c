@@ -37,6 +37,10 @@ const  CPU_CHAR  *os_cfg_app__c = "$Id: $";
 #define  OS_CFG_IDLE_TASK_STK_LIMIT      ((OS_CFG_IDLE_TASK_STK_SIZE  * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+#define  OS_CFG_INT_Q_TASK_STK_LIMIT     ((OS_CFG_INT_Q_TASK_STK_SIZE * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
+#endif
+
 #if (OS_CFG_STAT_TASK_EN > 0u)
 #define  OS_CFG_STAT_TASK_STK_LIMIT      ((OS_CFG_STAT_TASK_STK_SIZE  * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 #endif
@@ -53,12 +57,20 @@ const  CPU_CHAR  *os_cfg_app__c = "$Id: $";
 
 #if (OS_CFG_TASK_IDLE_EN > 0u)
 CPU_STK        OSCfg_IdleTaskStk   [OS_CFG_IDLE_TASK_STK_SIZE];
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+CPU_STK        OSCfg_IdleTaskCoreStk[OS_CFG_SMP_CORE_QTY - 1u][OS_CFG_IDLE_TASK_STK_SIZE];
+#endif
 #endif
 
 #if (OS_CFG_ISR_STK_SIZE > 0u)
 CPU_STK        OSCfg_ISRStk        [OS_CFG_ISR_STK_SIZE];
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+OS_INT_Q       OSCfg_IntQ          [OS_CFG_INT_Q_SIZE];
+CPU_STK        OSCfg_IntQTaskStk   [OS_CFG_INT_Q_TASK_STK_SIZE];
+#endif
+
 #if (OS_MSG_EN > 0u)
 OS_MSG         OSCfg_MsgPool       [OS_CFG_MSG_POOL_SIZE];
 #endif
@@ -100,6 +112,17 @@ CPU_INT32U     const  OSCfg_ISRStkSizeRAM        =             0u;
 #endif
 
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+OS_INT_Q     * const  OSCfg_IntQBasePtr          = &OSCfg_IntQ[0];
+OS_OBJ_QTY     const  OSCfg_IntQSize             =  OS_CFG_INT_Q_SIZE;
+CPU_INT32U     const  OSCfg_IntQSizeRAM          =  sizeof(OSCfg_IntQ);
+CPU_STK      * const  OSCfg_IntQTaskStkBasePtr   = &OSCfg_IntQTaskStk[0];
+CPU_STK_SIZE   const  OSCfg_IntQTaskStkLimit     =  OS_CFG_INT_Q_TASK_STK_LIMIT;
+CPU_STK_SIZE   const  OSCfg_IntQTaskStkSize      =  OS_CFG_INT_Q_TASK_STK_SIZE;
+CPU_INT32U     const  OSCfg_IntQTaskStkSizeRAM   =  sizeof(OSCfg_IntQTaskStk);
+#endif
+
+
 #if (OS_MSG_EN > 0u)
 OS_MSG_SIZE    const  OSCfg_MsgPoolSize          =  OS_CFG_MSG_POOL_SIZE;
 CPU_INT32U     const  OSCfg_MsgPoolSizeRAM       =  sizeof(OSCfg_MsgPool);
@@ -165,6 +188,14 @@ CPU_INT32U     const  OSCfg_DataSizeRAM          = 0u
 
 #if (OS_CFG_TASK_IDLE_EN > 0u)
                                                  + sizeof(OSCfg_IdleTaskStk)
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+                                                 + sizeof(OSCfg_IdleTaskCoreStk)
+#endif
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+                                                 + sizeof(OSCfg_IntQ)
+                                                 + sizeof(OSCfg_IntQTaskStk)
 #endif
 
 #if (OS_MSG_EN > 0u)
@@ -221,6 +252,16 @@ void  OSCfg_Init (void)
     (void)OSCfg_ISRStkSize;
     (void)OSCfg_ISRStkSizeRAM;
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    (void)OSCfg_IntQBasePtr;
+    (void)OSCfg_IntQSize;
+    (void)OSCfg_IntQSizeRAM;
+    (void)OSCfg_IntQTaskStkBasePtr;
+    (void)OSCfg_IntQTaskStkLimit;
+    (void)OSCfg_IntQTaskStkSize;
+    (void)OSCfg_IntQTaskStkSizeRAM;
+#endif
+
 #if (OS_MSG_EN > 0u)
     (void)OSCfg_MsgPoolSize;
     (void)OSCfg_MsgPoolSizeRAM;
@@ -51,6 +51,9 @@ void  OSInit (OS_ERR  *p_err)
     CPU_STK      *p_stk;
     CPU_STK_SIZE  size;
 #endif
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    OS_CORE_ID    core_id;
+#endif
 
 
 
@@ -75,6 +78,17 @@ void  OSInit (OS_ERR  *p_err)
     OSPrioCur             =           0u;                       /* Initialize priority variables to a known state       */
     OSPrioHighRdy         =           0u;
 
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    for (core_id = 0u; core_id < OS_CFG_SMP_CORE_QTY; core_id++) { /* Same for the state of every core                 */
+        OSCoreTbl[core_id].TCBCurPtr           = (OS_TCB *)0;
+        OSCoreTbl[core_id].TCBHighRdyPtr       = (OS_TCB *)0;
+        OSCoreTbl[core_id].PrioCur             =           0u;
+        OSCoreTbl[core_id].PrioHighRdy         =           0u;
+        OSCoreTbl[core_id].IntNestingCtr       =           0u;
+        OSCoreTbl[core_id].SchedLockNestingCtr =           0u;
+    }
+#endif
+
 #if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
     OSSchedLockTimeBegin  =           0u;
     OSSchedLockTimeMax    =           0u;
@@ -88,6 +102,13 @@ void  OSInit (OS_ERR  *p_err)
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
     OSSchedRoundRobinEn             = OS_FALSE;
     OSSchedRoundRobinDfltTimeQuanta = OSCfg_TickRate_Hz / 10u;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OSSchedRoundRobinTickCtrPrev    = 0u;
+#endif
+#endif
+
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+    OSSchedPreemptThresTCBPtr       = (OS_TCB *)0;
 #endif
 
 #if (OS_CFG_ISR_STK_SIZE > 0u)
@@ -132,6 +153,10 @@ void  OSInit (OS_ERR  *p_err)
 #if (OS_CFG_DBG_EN > 0u)
     OSFlagDbgListPtr = (OS_FLAG_GRP *)0;
     OSFlagQty        =                0u;
+#if (OS_CFG_FLAG_WIDE_EN > 0u)
+    OSFlagWideDbgListPtr = (OS_FLAG_WIDE_GRP *)0;
+    OSFlagWideQty        =                     0u;
+#endif
 #endif
 #endif
 
@@ -161,8 +186,20 @@ void  OSInit (OS_ERR  *p_err)
 
 #if (OS_CFG_Q_EN > 0u)                                          /* Initialize the Message Queue Manager module          */
 #if (OS_CFG_DBG_EN > 0u)
-    OSQDbgListPtr = (OS_Q *)0;
-    OSQQty        =         0u;
+    OSQDbgListPtr    = (OS_Q     *)0;
+    OSQQty           =             0u;
+#if (OS_CFG_Q_SET_EN > 0u)
+    OSQSetDbgListPtr = (OS_Q_SET *)0;
+    OSQSetQty        =             0u;
+#endif
+#endif
+#endif
+
+
+#if (OS_CFG_MSG_BUF_EN > 0u)                                    /* Initialize the Message Buffer Manager module         */
+#if (OS_CFG_DBG_EN > 0u)
+    OSMsgBufDbgListPtr = (OS_MSG_BUF *)0;
+    OSMsgBufQty        =               0u;
 #endif
 #endif
 
@@ -197,6 +234,14 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    OS_IntQTaskInit(p_err);                                     /* Initialize the ISR handler task                      */
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+
 #if (OS_CFG_TICK_EN > 0u)
     OS_TickInit(p_err);
     if (*p_err != OS_ERR_NONE) {
@@ -339,9 +384,21 @@ void  OSIntExit (void)
 #endif
 #endif
 
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    OS_SchedCoreHighRdySet();                                   /* Find highest priority task this core may run         */
+#else
     OSPrioHighRdy   = OS_PrioGetHighest();                      /* Find highest priority                                */
+#endif
 #if (OS_CFG_TASK_IDLE_EN > 0u)
+#if (OS_CFG_SMP_CORE_QTY == 1u)
     OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;         /* Get highest priority task ready-to-run               */
+#endif
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+    OS_SchedPreemptThres();                                     /* Only preempt a task above its preemption threshold   */
+#endif
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_DYN_TICK_EN > 0u)
+    OS_SchedRoundRobinDynTick();                                /* Charge the quanta and re-arm the tick for time slice */
+#endif
     if (OSTCBHighRdyPtr == OSTCBCurPtr) {                       /* Current task still the highest priority?             */
                                                                 /* Yes                                                  */
 #if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
@@ -358,6 +415,12 @@ void  OSIntExit (void)
 #else
     if (OSPrioHighRdy != (OS_CFG_PRIO_MAX - 1u)) {              /* Are we returning to idle?                            */
         OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;     /* No ... get highest priority task ready-to-run        */
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+        OS_SchedPreemptThres();                                 /* Only preempt a task above its preemption threshold   */
+#endif
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_DYN_TICK_EN > 0u)
+        OS_SchedRoundRobinDynTick();                            /* Charge the quanta and re-arm the tick for time slice */
+#endif
         if (OSTCBHighRdyPtr == OSTCBCurPtr) {                   /* Current task still the highest priority?             */
                                                                 /* Yes                                                  */
             OS_TRACE_ISR_EXIT();
@@ -447,9 +510,21 @@ void  OSSched (void)
     }
 
     CPU_INT_DIS();
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    OS_SchedCoreHighRdySet();                                   /* Find highest priority task this core may run         */
+#else
     OSPrioHighRdy   = OS_PrioGetHighest();                      /* Find the highest priority ready                      */
+#endif
 #if (OS_CFG_TASK_IDLE_EN > 0u)
+#if (OS_CFG_SMP_CORE_QTY == 1u)
     OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;         /* Get highest priority task ready-to-run               */
+#endif
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+    OS_SchedPreemptThres();                                     /* Only preempt a task above its preemption threshold   */
+#endif
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_DYN_TICK_EN > 0u)
+    OS_SchedRoundRobinDynTick();                                /* Charge the quanta and re-arm the tick for time slice */
+#endif
     if (OSTCBHighRdyPtr == OSTCBCurPtr) {                       /* Current task still the highest priority?             */
         CPU_INT_EN();                                           /* Yes                                                  */
         return;
@@ -457,6 +532,12 @@ void  OSSched (void)
 #else
     if (OSPrioHighRdy != (OS_CFG_PRIO_MAX - 1u)) {              /* Are we returning to idle?                              */
         OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;     /* No ... get highest priority task ready-to-run          */
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+        OS_SchedPreemptThres();                                 /* Only preempt a task above its preemption threshold   */
+#endif
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_DYN_TICK_EN > 0u)
+        OS_SchedRoundRobinDynTick();                            /* Charge the quanta and re-arm the tick for time slice */
+#endif
         if (OSTCBHighRdyPtr == OSTCBCurPtr) {                   /* Current task still the highest priority?               */
             CPU_INT_EN();                                       /* Yes                                                    */
             return;
@@ -694,6 +775,9 @@ void  OSSchedRoundRobinCfg (CPU_BOOLEAN   en,
     } else {
         OSSchedRoundRobinDfltTimeQuanta = (OS_TICK)(OSCfg_TickRate_Hz / 10u);
     }
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OSSchedRoundRobinTickCtrPrev = OSTickCtr + OS_DynTickGet(); /* Start charging time quanta from now on               */
+#endif
     CPU_CRITICAL_EXIT();
    *p_err = OS_ERR_NONE;
 }
@@ -710,13 +794,15 @@ void  OSSchedRoundRobinCfg (CPU_BOOLEAN   en,
 *
 *                             OS_ERR_NONE                   The call was successful
 *                             OS_ERR_ROUND_ROBIN_1          Only 1 task at this priority, nothing to yield to
-*                             OS_ERR_ROUND_ROBIN_DISABLED   Round Robin is not enabled
+*                             OS_ERR_ROUND_ROBIN_DISABLED   Round Robin is not enabled, or the task runs at the EDF level
 *                             OS_ERR_SCHED_LOCKED           The scheduler has been locked
 *                             OS_ERR_YIELD_ISR              Can't be called from an ISR
 *
 * Returns    : none
 *
 * Note(s)    : 1) This function MUST be called from a task.
+*
+*              2) Tasks at the OS_CFG_SCHED_EDF_PRIO level are ordered by deadline and are not time sliced.
 ************************************************************************************************************************
 */
 
@@ -753,6 +839,13 @@ void  OSSchedRoundRobinYield (OS_ERR  *p_err)
         return;
     }
 
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    if (OSPrioCur == OS_CFG_SCHED_EDF_PRIO) {                   /* See Note #2                                          */
+       *p_err = OS_ERR_ROUND_ROBIN_DISABLED;
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
     p_rdy_list = &OSRdyList[OSPrioCur];                         /* Can't yield if it's the only task at that priority   */
     if (p_rdy_list->HeadPtr == p_rdy_list->TailPtr) {
@@ -806,6 +899,10 @@ void  OSSchedRoundRobinYield (OS_ERR  *p_err)
 void  OSStart (OS_ERR  *p_err)
 {
     OS_OBJ_QTY  kernel_task_cnt;
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    OS_CORE_ID  core_id;
+    OS_TCB     *p_tcb;
+#endif
 
 
 #ifdef OS_SAFETY_CRITICAL
@@ -828,7 +925,7 @@ void  OSStart (OS_ERR  *p_err)
     kernel_task_cnt++;
 #endif
 #if (OS_CFG_TASK_IDLE_EN > 0u)
-    kernel_task_cnt++;
+    kernel_task_cnt += OS_CFG_SMP_CORE_QTY;                     /* One idle task per core                               */
 #endif
 
     if (OSTaskQty <= kernel_task_cnt) {                         /* No application task created                          */
@@ -837,10 +934,21 @@ void  OSStart (OS_ERR  *p_err)
     }
 
     if (OSRunning == OS_STATE_OS_STOPPED) {
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+        for (core_id = 0u; core_id < OS_CFG_SMP_CORE_QTY; core_id++) {
+            p_tcb                            = OS_SchedCoreHighRdyGet(core_id);
+            p_tcb->CoreId                    = core_id;         /* Give each core its highest priority task             */
+            OSCoreTbl[core_id].PrioHighRdy   = p_tcb->Prio;
+            OSCoreTbl[core_id].PrioCur       = p_tcb->Prio;
+            OSCoreTbl[core_id].TCBHighRdyPtr = p_tcb;
+            OSCoreTbl[core_id].TCBCurPtr     = p_tcb;
+        }
+#else
         OSPrioHighRdy   = OS_PrioGetHighest();                  /* Find the highest priority                            */
         OSPrioCur       = OSPrioHighRdy;
         OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;
         OSTCBCurPtr     = OSTCBHighRdyPtr;
+#endif
         OSRunning       = OS_STATE_OS_RUNNING;
         OSStartHighRdy();                                       /* Execute target specific code to start task           */
        *p_err           = OS_ERR_FATAL_RETURN;                  /* OSStart() is not supposed to return                  */
@@ -948,6 +1056,11 @@ void  OS_IdleTask (void  *p_arg)
 #if (OS_CFG_TASK_IDLE_EN > 0u)
 void  OS_IdleTaskInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    OS_CORE_ID  core_id;
+
+
+#endif
 #if (OS_CFG_DBG_EN > 0u)
     OSIdleTaskCtr = 0u;
 #endif
@@ -969,6 +1082,31 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
                  (void       *)0,
                  (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS)),
                   p_err);
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    for (core_id = 0u; core_id < (OS_CFG_SMP_CORE_QTY - 1u); core_id++) {
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+        OSTaskCreate(&OSIdleTaskCoreTCB[core_id],              /* Each core must always find a task to run             */
+#if  (OS_CFG_DBG_EN == 0u)
+                     (CPU_CHAR   *)0,
+#else
+                     (CPU_CHAR   *)"uC/OS-III Idle Task",
+#endif
+                      OS_IdleTask,
+                     (void       *)0,
+                     (OS_PRIO     )(OS_CFG_PRIO_MAX - 1u),
+                     &OSCfg_IdleTaskCoreStk[core_id][0],
+                      OSCfg_IdleTaskStkLimit,
+                      OSCfg_IdleTaskStkSize,
+                      0u,
+                      0u,
+                     (void       *)0,
+                     (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS)),
+                      p_err);
+    }
+#endif
 }
 #endif
 
@@ -993,6 +1131,9 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
 *                                 OS_TASK_PEND_ON_Q
 *                                 OS_TASK_PEND_ON_SEM
 *                                 OS_TASK_PEND_ON_TASK_SEM   <- No object (pending on a signal sent to the task)
+*                                 OS_TASK_PEND_ON_MULTI      <- No object (see OSPendMulti())
+*                                 OS_TASK_PEND_ON_MSG_BUF
+*                                 OS_TASK_PEND_ON_Q_POST     <- .PostPendObj of a queue, or .MsgQPostPendObj of a task
 *
 *              timeout        Is the amount of time the task will wait for the event to occur.
 *
@@ -1157,6 +1298,12 @@ void  OS_PendDbgNameAdd (OS_PEND_OBJ  *p_obj,
                  p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)"Task Sem");
                  break;
 
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+            case OS_TASK_PEND_ON_MULTI:
+                 p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)"Multi");
+                 break;
+#endif
+
             default:
                  p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)" ");
                  break;
@@ -1202,6 +1349,12 @@ void  OS_PendDbgNameRemove (OS_PEND_OBJ  *p_obj,
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
 *
 *              2) It's assumed that the TCB contains the NEW priority in its .Prio field.
+*
+*              3) When OS_CFG_PEND_LIST_BUCKET_EN is enabled, the task is also moved when it is alone in the list so that
+*                 it is filed under the bucket of its new priority.  Both operations are then constant time.
+*
+*              4) The wait lists of an event flag group are not ordered by priority, a task waiting on a group stays in
+*                 its wait list.
 ************************************************************************************************************************
 */
 
@@ -1209,15 +1362,29 @@ void  OS_PendListChangePrio (OS_TCB  *p_tcb)
 {
     OS_PEND_LIST  *p_pend_list;
     OS_PEND_OBJ   *p_obj;
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+    CPU_INT08U     flag_wait_bit;
+#endif
 
     p_obj       =  p_tcb->PendObjPtr;                           /* Get pointer to pend list                             */
     p_pend_list = &p_obj->PendList;
 
+#if (OS_CFG_PEND_LIST_BUCKET_EN > 0u)
+    if (p_tcb->PendListPrio != p_tcb->Prio) {                   /* Only move if the priority bucket changed             */
+#else
     if (p_pend_list->HeadPtr->PendNextPtr != (OS_TCB *)0) {     /* Only move if multiple entries in the list            */
+#endif
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+            flag_wait_bit      = p_tcb->FlagWaitBit;            /* See Note #4                                          */
+            p_tcb->FlagWaitBit = OS_FLAG_WAIT_NONE;
+#endif
             OS_PendListRemove(p_tcb);                           /* Remove entry from current position                   */
             p_tcb->PendObjPtr = p_obj;
             OS_PendListInsertPrio(p_pend_list,                  /* INSERT it back in the list                           */
                                   p_tcb);
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+            p_tcb->FlagWaitBit = flag_wait_bit;
+#endif
     }
 }
 
@@ -1239,11 +1406,24 @@ void  OS_PendListChangePrio (OS_TCB  *p_tcb)
 
 void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
 {
+#if (OS_CFG_PEND_LIST_BUCKET_EN > 0u)
+    OS_PRIO  ix;
+
+
+#endif
     p_pend_list->HeadPtr    = (OS_TCB *)0;
     p_pend_list->TailPtr    = (OS_TCB *)0;
 #if (OS_CFG_DBG_EN > 0u)
     p_pend_list->NbrEntries =           0u;
 #endif
+#if (OS_CFG_PEND_LIST_BUCKET_EN > 0u)
+    for (ix = 0u; ix < OS_PRIO_TBL_SIZE; ix++) {                /* .PrioHeadPtr[] is only read when its bit is set      */
+        p_pend_list->PrioTbl[ix] = 0u;
+    }
+#endif
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    p_pend_list->MultiHeadPtr = (OS_PEND_DATA *)0;
+#endif
 }
 
 
@@ -1307,9 +1487,70 @@ void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) When OS_CFG_PEND_LIST_BUCKET_EN is enabled, the pend list keeps a bitmap of the priorities that have
+*                 waiters and a pointer to the first waiter of each priority.  The insertion point is found from the
+*                 bitmap, i.e. just before the first waiter of the next lower priority, instead of walking the list.
+*                 Tasks of equal priority remain in FIFO order.
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_PEND_LIST_BUCKET_EN > 0u)
+void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
+                             OS_TCB        *p_tcb)
+{
+    OS_PRIO    prio;
+    OS_PRIO    ix;
+    CPU_DATA   bit;
+    CPU_DATA   bits;
+    OS_TCB    *p_tcb_next;
+
+
+    prio    = p_tcb->Prio;                                      /* Obtain the priority of the task to insert            */
+    ix      = (OS_PRIO)(prio / (CPU_CFG_DATA_SIZE * 8u));
+    bit     = (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ((CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u)));
+    bits    = p_pend_list->PrioTbl[ix] & (bit - 1u);            /* Keep the lower priorities of the same entry          */
+    while ((bits == 0u) && (ix < (OS_PRIO_TBL_SIZE - 1u))) {    /* Find the next lower priority having waiters          */
+        ix++;
+        bits = p_pend_list->PrioTbl[ix];
+    }
+    if (bits == 0u) {
+        p_tcb_next = (OS_TCB *)0;                               /* No waiter at a lower priority                        */
+    } else {
+        p_tcb_next = p_pend_list->PrioHeadPtr[(ix * (CPU_CFG_DATA_SIZE * 8u)) + CPU_CntLeadZeros(bits)];
+    }
+
+    ix = (OS_PRIO)(prio / (CPU_CFG_DATA_SIZE * 8u));
+    if ((p_pend_list->PrioTbl[ix] & bit) == 0u) {               /* First waiter at this priority?                       */
+        p_pend_list->PrioTbl[ix]       |= bit;                  /* Yes, it heads its bucket                             */
+        p_pend_list->PrioHeadPtr[prio]  = p_tcb;
+    }
+    p_tcb->PendListPrio = prio;
+#if (OS_CFG_DBG_EN > 0u)
+    p_pend_list->NbrEntries++;                                  /* One more OS_TCB in the list                          */
+#endif
+
+    if (p_tcb_next == (OS_TCB *)0) {                            /* Insert at the tail                                   */
+        p_tcb->PendNextPtr = (OS_TCB *)0;
+        p_tcb->PendPrevPtr =  p_pend_list->TailPtr;
+        if (p_pend_list->TailPtr == (OS_TCB *)0) {              /* List was empty                                       */
+            p_pend_list->HeadPtr = p_tcb;
+        } else {
+            p_pend_list->TailPtr->PendNextPtr = p_tcb;
+        }
+        p_pend_list->TailPtr = p_tcb;
+    } else {                                                    /* Insert BEFORE the next lower priority waiter         */
+        p_tcb->PendNextPtr = p_tcb_next;
+        p_tcb->PendPrevPtr = p_tcb_next->PendPrevPtr;
+        if (p_tcb->PendPrevPtr == (OS_TCB *)0) {                /* New TCB is highest priority                          */
+            p_pend_list->HeadPtr = p_tcb;
+        } else {
+            p_tcb->PendPrevPtr->PendNextPtr = p_tcb;
+        }
+        p_tcb_next->PendPrevPtr = p_tcb;
+    }
+}
+#else
 void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
                              OS_TCB        *p_tcb)
 {
@@ -1359,6 +1600,7 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
         }
     }
 }
+#endif
 
 
 /*
@@ -1406,6 +1648,11 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A task waiting in OSPendMulti() is removed from the lists of all the objects it waits on.
+*
+*              3) A task waiting on an event flag group is also removed from the wait list of the group it is in, see
+*                 OSFlagPost() Note #4.
 ************************************************************************************************************************
 */
 
@@ -1414,11 +1661,41 @@ void  OS_PendListRemove (OS_TCB  *p_tcb)
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_next;
     OS_TCB        *p_prev;
+#if (OS_CFG_PEND_LIST_BUCKET_EN > 0u)
+    OS_PRIO        prio;
+#endif
+
+
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {               /* See Note #2                                          */
+        OS_PendMultiRemove(p_tcb);
+        return;
+    }
+#endif
 
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+    if (p_tcb->FlagWaitBit != OS_FLAG_WAIT_NONE) {              /* See Note #3                                          */
+        OS_FlagWaitListRemove(p_tcb);
+    }
+#endif
 
     if (p_tcb->PendObjPtr != (OS_PEND_OBJ *)0) {                /* Only remove if object has a pend list.               */
         p_pend_list = &p_tcb->PendObjPtr->PendList;             /* Get pointer to pend list                             */
 
+#if (OS_CFG_PEND_LIST_BUCKET_EN > 0u)
+        prio = p_tcb->PendListPrio;
+        if (p_pend_list->PrioHeadPtr[prio] == p_tcb) {          /* Is the TCB the first waiter of its bucket?           */
+            p_next = p_tcb->PendNextPtr;
+            if ((p_next != (OS_TCB *)0) &&
+                (p_next->PendListPrio == prio)) {
+                p_pend_list->PrioHeadPtr[prio] = p_next;        /* Yes, the next waiter heads the bucket                */
+            } else {                                            /* Yes, the bucket becomes empty                        */
+                p_pend_list->PrioTbl[prio / (CPU_CFG_DATA_SIZE * 8u)] &=
+                    ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ((CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u))));
+            }
+        }
+#endif
+
                                                                 /* Remove TCB from the pend list.                       */
         if (p_pend_list->HeadPtr->PendNextPtr == (OS_TCB *)0) {
             p_pend_list->HeadPtr = (OS_TCB *)0;                 /* Only one entry in the pend list                      */
@@ -1470,7 +1747,11 @@ void  OS_PendListRemove (OS_TCB  *p_tcb)
 *
 * Returns    : none
 *
-* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) When posts from ISRs are deferred, the post services call this function with the scheduler locked
+*                 instead of interrupts disabled.  The ready list and the tick list are shared with the ISRs, so
+*                 interrupts are disabled while they are updated.
 ************************************************************************************************************************
 */
 
@@ -1480,6 +1761,11 @@ void  OS_Post (OS_PEND_OBJ  *p_obj,
                OS_MSG_SIZE   msg_size,
                CPU_TS        ts)
 {
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
 #if (OS_CFG_TS_EN == 0u)
     (void)ts;                                                   /* Prevent compiler warning for not using 'ts'          */
 #endif
@@ -1503,6 +1789,13 @@ void  OS_Post (OS_PEND_OBJ  *p_obj,
 #endif
 #if (OS_CFG_TS_EN > 0u)
                  p_tcb->TS      = ts;
+#endif
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+             OS_PendMultiRdy(p_tcb,                             /* Tell OSPendMulti() which object readied the task     */
+                             p_obj,
+                             p_void,
+                             msg_size,
+                             ts);
 #endif
              if (p_obj != (OS_PEND_OBJ *)0) {
                  OS_PendListRemove(p_tcb);                      /* Remove task from pend list                           */
@@ -1511,12 +1804,18 @@ void  OS_Post (OS_PEND_OBJ  *p_obj,
              OS_PendDbgNameRemove(p_obj,
                                   p_tcb);
 #endif
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+             CPU_CRITICAL_ENTER();                              /* See Note #2                                          */
+#endif
 #if (OS_CFG_TICK_EN > 0u)
              if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT) {
                  OS_TickListRemove(p_tcb);                      /* Remove from tick list                                */
              }
 #endif
              OS_RdyListInsert(p_tcb);                           /* Insert the task in the ready list                    */
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+             CPU_CRITICAL_EXIT();
+#endif
              p_tcb->TaskState  = OS_TASK_STATE_RDY;
              p_tcb->PendStatus = OS_STATUS_PEND_OK;             /* Clear pend status                                    */
              p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;       /* Indicate no longer pending                           */
@@ -1530,6 +1829,13 @@ void  OS_Post (OS_PEND_OBJ  *p_obj,
 #endif
 #if (OS_CFG_TS_EN > 0u)
              p_tcb->TS      = ts;
+#endif
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+             OS_PendMultiRdy(p_tcb,                             /* Tell OSPendMulti() which object readied the task     */
+                             p_obj,
+                             p_void,
+                             msg_size,
+                             ts);
 #endif
              if (p_obj != (OS_PEND_OBJ *)0) {
                  OS_PendListRemove(p_tcb);                      /* Remove from pend list                                */
@@ -1540,7 +1846,13 @@ void  OS_Post (OS_PEND_OBJ  *p_obj,
 #endif
 #if (OS_CFG_TICK_EN > 0u)
              if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED) {
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+                 CPU_CRITICAL_ENTER();                          /* See Note #2                                          */
+#endif
                  OS_TickListRemove(p_tcb);                      /* Cancel any timeout                                   */
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+                 CPU_CRITICAL_EXIT();
+#endif
              }
 #endif
              p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
@@ -1709,6 +2021,13 @@ void  OS_RdyListInsertHead (OS_TCB  *p_tcb)
 
 
 
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    if (p_tcb->Prio == OS_CFG_SCHED_EDF_PRIO) {                 /* The EDF level is kept in deadline order              */
+        OS_RdyListInsertEDF(p_tcb);
+        return;
+    }
+#endif
+
     p_rdy_list = &OSRdyList[p_tcb->Prio];
     if (p_rdy_list->HeadPtr == (OS_TCB *)0) {                   /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN > 0u)
@@ -1794,6 +2113,13 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 
 
 
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    if (p_tcb->Prio == OS_CFG_SCHED_EDF_PRIO) {                 /* The EDF level is kept in deadline order              */
+        OS_RdyListInsertEDF(p_tcb);
+        return;
+    }
+#endif
+
     p_rdy_list = &OSRdyList[p_tcb->Prio];
     if (p_rdy_list->HeadPtr == (OS_TCB *)0) {                   /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN > 0u)
@@ -1816,6 +2142,74 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 }
 
 
+/*
+************************************************************************************************************************
+*                                      INSERT TCB IN DEADLINE ORDER (EDF LEVEL)
+*
+* Description: This function is called to place an OS_TCB in the ready list of the OS_CFG_SCHED_EDF_PRIO level, which is
+*              kept sorted by absolute deadline so that the head of the list is the job with the earliest deadline.
+*
+* Arguments  : p_tcb     is the OS_TCB to insert in the list
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Tasks without a deadline (DeadlineRel == 0) are placed ahead of the tasks with a deadline.  Such a task
+*                 is typically a mutex owner raised to the EDF level by priority inheritance, which must run first to
+*                 release the mutex.
+*
+*              3) Deadlines are compared relative to each other so that they may wrap around OSTickCtr.  Tasks with the
+*                 same deadline are kept in FIFO order.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+void  OS_RdyListInsertEDF (OS_TCB  *p_tcb)
+{
+    OS_RDY_LIST  *p_rdy_list;
+    OS_TCB       *p_tcb2;
+    OS_TICK       delta;
+
+
+
+    p_rdy_list = &OSRdyList[p_tcb->Prio];
+    p_tcb2     =  p_rdy_list->HeadPtr;
+    while (p_tcb2 != (OS_TCB *)0) {                             /* Find the first task to run after ours                */
+        if (p_tcb2->DeadlineRel != 0u) {
+            if (p_tcb->DeadlineRel == 0u) {                     /* See Note #2                                          */
+                break;
+            }
+            delta = p_tcb2->DeadlineAbs - p_tcb->DeadlineAbs;   /* See Note #3                                          */
+            if ((delta != 0u) &&
+                (delta <= ((OS_TICK)~(OS_TICK)0 >> 1u))) {
+                break;
+            }
+        }
+        p_tcb2 = p_tcb2->NextPtr;
+    }
+
+#if (OS_CFG_DBG_EN > 0u)
+    p_rdy_list->NbrEntries++;                                   /* One more OS_TCB in the list                          */
+#endif
+    p_tcb->NextPtr = p_tcb2;                                    /* Insert BEFORE 'p_tcb2', or at the tail if none       */
+    if (p_tcb2 == (OS_TCB *)0) {
+        p_tcb->PrevPtr      = p_rdy_list->TailPtr;
+        p_rdy_list->TailPtr = p_tcb;
+    } else {
+        p_tcb->PrevPtr      = p_tcb2->PrevPtr;
+        p_tcb2->PrevPtr     = p_tcb;
+    }
+    if (p_tcb->PrevPtr == (OS_TCB *)0) {
+        p_rdy_list->HeadPtr     = p_tcb;
+    } else {
+        p_tcb->PrevPtr->NextPtr = p_tcb;
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                MOVE TCB AT HEAD TO TAIL
@@ -1992,6 +2386,126 @@ void  OS_RdyListRemove (OS_TCB  *p_tcb)
 }
 
 
+/*
+************************************************************************************************************************
+*                                  FIND THE HIGHEST PRIORITY TASK A CORE IS ALLOWED TO RUN
+*
+* Description: This function is called when more than one core is scheduled (OS_CFG_SMP_CORE_QTY > 1) to find the
+*              highest priority ready task that is either not running or already running on the specified core.  Tasks
+*              running on the other cores, and tasks another core is deleting, are skipped.
+*
+* Arguments  : core_id     is the core to schedule, or OS_CORE_ID_NONE to only consider tasks that no core is running
+*
+* Returns    : A pointer to the TCB of the task, or a NULL pointer if no such task is ready.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled, i.e. with the kernel lock held.
+*
+*              3) Only the (OS_CFG_SMP_CORE_QTY - 1) tasks running on other cores, and the tasks whose deletion is in
+*                 progress, can be skipped, so the search time is bounded.  Since there is one idle task per core, a
+*                 core always finds a task to run.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+OS_TCB  *OS_SchedCoreHighRdyGet (OS_CORE_ID  core_id)
+{
+    OS_PRIO    ix;
+    OS_PRIO    prio;
+    CPU_DATA   bits;
+    OS_TCB    *p_tcb;
+
+
+    for (ix = 0u; ix < OS_PRIO_TBL_SIZE; ix++) {
+        bits = OSPrioTbl[ix];
+        while (bits != 0u) {                                    /* Visit the ready priorities, highest first            */
+            prio  = (OS_PRIO)((ix * (CPU_CFG_DATA_SIZE * 8u)) + CPU_CntLeadZeros(bits));
+            p_tcb = OSRdyList[prio].HeadPtr;
+            while (p_tcb != (OS_TCB *)0) {
+                if (((p_tcb->CoreId == OS_CORE_ID_NONE) ||      /* Is the task free to run on this core ...             */
+                     (p_tcb->CoreId == core_id)) &&
+                    (p_tcb->DelReq == OS_FALSE)) {              /* ... and not being deleted?                           */
+                    return (p_tcb);                             /* Yes                                                  */
+                }
+                p_tcb = p_tcb->NextPtr;                         /* No, it runs on another core or is being deleted      */
+            }
+            bits &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ((CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u))));
+        }
+    }
+    return ((OS_TCB *)0);
+}
+
+
+/*
+************************************************************************************************************************
+*                                     SELECT THE TASK TO RUN ON THE CURRENT CORE
+*
+* Description: This function is called by OSSched() and OSIntExit() when more than one core is scheduled.  It sets
+*              OSTCBHighRdyPtr and OSPrioHighRdy for the current core, then checks whether another core must reschedule
+*              because a task got ready, blocked, was suspended or deleted.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled, i.e. with the kernel lock held.
+*
+*              3) At most one other core is asked to reschedule, the one running the lowest priority task that a waiting
+*                 task can preempt.  When that core reschedules, it calls this function in turn which propagates the
+*                 request to the next core if needed.
+************************************************************************************************************************
+*/
+
+void  OS_SchedCoreHighRdySet (void)
+{
+    OS_CORE_ID   core_id;
+    OS_CORE_ID   core_id_req;
+    OS_CORE_ID   ix;
+    OS_PRIO      prio_low;
+    OS_TCB      *p_tcb;
+    OS_TCB      *p_tcb_cur;
+
+
+    core_id         = OS_CPU_CoreIdGet();
+    OSTCBHighRdyPtr = OS_SchedCoreHighRdyGet(core_id);          /* See Note #3 of OS_SchedCoreHighRdyGet()              */
+    OSPrioHighRdy   = OSTCBHighRdyPtr->Prio;
+    if (OSTCBHighRdyPtr != OSTCBCurPtr) {                       /* Claim the new task for this core                     */
+        if (OSTCBCurPtr != (OS_TCB *)0) {
+            OSTCBCurPtr->CoreId = OS_CORE_ID_NONE;
+        }
+        OSTCBHighRdyPtr->CoreId = core_id;
+    }
+
+    p_tcb       = OS_SchedCoreHighRdyGet(OS_CORE_ID_NONE);      /* Highest priority task waiting for a core             */
+    core_id_req = OS_CORE_ID_NONE;
+    prio_low    = 0u;
+    for (ix = 0u; ix < OS_CFG_SMP_CORE_QTY; ix++) {
+        p_tcb_cur = OSCoreTbl[ix].TCBCurPtr;
+        if ((ix        == core_id) ||
+            (p_tcb_cur == (OS_TCB *)0)) {
+            continue;
+        }
+        if (p_tcb_cur->TaskState != OS_TASK_STATE_RDY) {        /* Task of that core blocked, was suspended or deleted  */
+            core_id_req = ix;
+            break;
+        }
+        if ((p_tcb           != (OS_TCB *)0) &&                 /* Find the core running the lowest priority task ...   */
+            (p_tcb_cur->Prio >  p_tcb->Prio) &&                 /* ... that the waiting task can preempt                */
+            (p_tcb_cur->Prio >= prio_low)) {
+            core_id_req = ix;
+            prio_low    = p_tcb_cur->Prio;
+        }
+    }
+    if (core_id_req != OS_CORE_ID_NONE) {
+        OS_CPU_CoreSchedReq(core_id_req);                       /* Ask that core to call OSSched()                      */
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               SCHEDULER LOCK TIME MEASUREMENT
@@ -2043,6 +2557,111 @@ void  OS_SchedLockTimeMeasStop (void)
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                          APPLY THE PREEMPTION THRESHOLDS
+*
+* Description: This function is called by the scheduler, once it found the highest priority task ready, to keep running
+*              a task with a preemption threshold unless the task found is above that threshold.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) A task with a threshold is pushed on the preemption threshold stack when it starts running, and stays
+*                 there until it stops being ready.  If a task above the threshold preempts it, the threshold still
+*                 holds against the other tasks once that task is done, as if the task had kept running at its
+*                 threshold priority.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+void  OS_SchedPreemptThres (void)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = OSTCBCurPtr;                                        /* Push the running task, e.g. first task or new thres  */
+    if ((p_tcb                     != (OS_TCB *)0)        &&
+        (p_tcb->TaskState          == OS_TASK_STATE_RDY)  &&
+        (p_tcb->PreemptThres       <  p_tcb->Prio)        &&
+        (p_tcb->PreemptThresActive == OS_FALSE)) {
+        p_tcb->PreemptThresNextPtr = OSSchedPreemptThresTCBPtr;
+        p_tcb->PreemptThresActive  = OS_TRUE;
+        OSSchedPreemptThresTCBPtr  = p_tcb;
+    }
+
+    p_tcb = OSSchedPreemptThresTCBPtr;
+    while ((p_tcb            != (OS_TCB *)0) &&                 /* Pop the tasks which stopped being ready              */
+           (p_tcb->TaskState != OS_TASK_STATE_RDY)) {
+        OSSchedPreemptThresTCBPtr  = p_tcb->PreemptThresNextPtr;
+        p_tcb->PreemptThresNextPtr = (OS_TCB *)0;
+        p_tcb->PreemptThresActive  = OS_FALSE;
+        p_tcb                      = OSSchedPreemptThresTCBPtr;
+    }
+
+    if (p_tcb != (OS_TCB *)0) {
+        if (OSPrioHighRdy >= p_tcb->PreemptThres) {             /* Task found above the threshold?                      */
+            OSTCBHighRdyPtr = p_tcb;                            /* No,  keep running the task with the threshold        */
+            OSPrioHighRdy   = p_tcb->Prio;
+            return;
+        }
+    }
+
+    p_tcb = OSTCBHighRdyPtr;                                    /* Push the task about to run, see Note #3              */
+    if ((p_tcb->PreemptThres       <  p_tcb->Prio) &&
+        (p_tcb->PreemptThresActive == OS_FALSE)) {
+        p_tcb->PreemptThresNextPtr = OSSchedPreemptThresTCBPtr;
+        p_tcb->PreemptThresActive  = OS_TRUE;
+        OSSchedPreemptThresTCBPtr  = p_tcb;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                   REMOVE A TASK FROM THE PREEMPTION THRESHOLD STACK
+*
+* Description: This function is called to remove a task from the preemption threshold stack, when the task is deleted or
+*              its threshold is removed.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task to remove
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_SchedPreemptThresDel (OS_TCB  *p_tcb)
+{
+    OS_TCB  **pp_tcb;
+
+
+    if (p_tcb->PreemptThresActive == OS_FALSE) {
+        return;
+    }
+
+    pp_tcb = &OSSchedPreemptThresTCBPtr;
+    while (*pp_tcb != (OS_TCB *)0) {
+        if (*pp_tcb == p_tcb) {
+           *pp_tcb                     = p_tcb->PreemptThresNextPtr;
+            p_tcb->PreemptThresNextPtr = (OS_TCB *)0;
+            p_tcb->PreemptThresActive  = OS_FALSE;
+            break;
+        }
+        pp_tcb = &(*pp_tcb)->PreemptThresNextPtr;
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                        RUN ROUND-ROBIN SCHEDULING ALGORITHM
@@ -2053,14 +2672,20 @@ void  OS_SchedLockTimeMeasStop (void)
 * Arguments  : p_rdy_list    is a pointer to the OS_RDY_LIST entry of the ready list at the current priority
 *              ----------
 *
+*              ticks         is the number of ticks which have elapsed
+*
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) In Dynamic Tick Mode (DTM), the running task is charged for all the ticks since its quanta was last
+*                 charged, see OS_SchedRoundRobinDynTick().
 ************************************************************************************************************************
 */
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
-void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
+void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list,
+                          OS_TICK       ticks)
 {
     OS_TCB  *p_tcb;
     CPU_SR_ALLOC();
@@ -2071,6 +2696,10 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
     }
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    ticks                         = (OSTickCtr + ticks) - OSSchedRoundRobinTickCtrPrev;
+    OSSchedRoundRobinTickCtrPrev += ticks;                      /* See Note #2                                          */
+#endif
     p_tcb = p_rdy_list->HeadPtr;                                /* Decrement time quanta counter                        */
 
     if (p_tcb == (OS_TCB *)0) {
@@ -2085,8 +2714,17 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
     }
 #endif
 
-    if (p_tcb->TimeQuantaCtr > 0u) {
-        p_tcb->TimeQuantaCtr--;
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    if (p_tcb->Prio == OS_CFG_SCHED_EDF_PRIO) {                 /* Tasks at the EDF level are not time sliced           */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+#endif
+
+    if (p_tcb->TimeQuantaCtr > ticks) {
+        p_tcb->TimeQuantaCtr -= ticks;
+    } else {
+        p_tcb->TimeQuantaCtr  = 0u;
     }
 
     if (p_tcb->TimeQuantaCtr > 0u) {                            /* Task not done with its time quanta                   */
@@ -2116,6 +2754,86 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                     ROUND-ROBIN SCHEDULING IN DYNAMIC TICK MODE
+*
+* Description: This function is called by the scheduler once it has found the highest priority task ready-to-run.  It
+*              charges the task being switched out for the ticks it ran and, if the task to run shares its priority with
+*              other ready tasks, makes sure the next tick event comes no later than the end of its time quanta.  Time
+*              slicing then only costs a tick interrupt at the end of each quanta.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) The tick event programmed is never later than OSTickCtrStep.  If the tick list comes due first, the
+*                 tick timer is left alone and the quanta is accounted for when the tick re-arms it.  Otherwise, no task
+*                 can expire before the end of the quanta, so OSTickCtr is brought up to date without expiring the tick
+*                 list and the task picked by the scheduler remains the highest priority task ready-to-run.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_DYN_TICK_EN > 0u)
+void  OS_SchedRoundRobinDynTick (void)
+{
+    OS_RDY_LIST  *p_rdy_list;
+    OS_TICK       elapsed;
+    OS_TICK       ticks;
+    OS_TICK       quanta;
+    OS_TICK       deadline;
+
+
+    if (OSSchedRoundRobinEn != OS_TRUE) {                       /* Make sure round-robin has been enabled               */
+        return;
+    }
+
+    elapsed = OS_DynTickGet();
+
+    if (OSTCBHighRdyPtr != OSTCBCurPtr) {                       /* Charge the task being switched out                   */
+        ticks = (OSTickCtr + elapsed) - OSSchedRoundRobinTickCtrPrev;
+        if (OSTCBCurPtr->TimeQuantaCtr > ticks) {
+            OSTCBCurPtr->TimeQuantaCtr -= ticks;
+        } else {
+            OSTCBCurPtr->TimeQuantaCtr  = 0u;
+        }
+        OSSchedRoundRobinTickCtrPrev = OSTickCtr + elapsed;     /* The task switched in starts being charged from now   */
+    }
+
+    p_rdy_list = &OSRdyList[OSPrioHighRdy];
+    if (p_rdy_list->HeadPtr == p_rdy_list->TailPtr) {           /* Nothing to time slice at this priority               */
+        return;
+    }
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    if (OSPrioHighRdy == OS_CFG_SCHED_EDF_PRIO) {               /* Tasks at the EDF level are not time sliced           */
+        return;
+    }
+#endif
+
+    quanta = p_rdy_list->HeadPtr->TimeQuantaCtr;
+    ticks  = (OSTickCtr + elapsed) - OSSchedRoundRobinTickCtrPrev;
+    if (quanta > ticks) {                                       /* Ticks from OSTickCtr to the end of the quanta        */
+        deadline = elapsed + (quanta - ticks);
+    } else {
+        deadline = elapsed + 1u;                                /* Quanta is over, time slice on the next tick          */
+    }
+    if ((OSTickCtrStep != 0u) &&                                /* See Note #3.                                         */
+        (OSTickCtrStep <= deadline)) {
+        return;
+    }
+
+    if (elapsed != 0u) {
+        OS_TickCtrAdvance(elapsed);
+    }
+    OS_TickStepSet();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                     BLOCK A TASK
@@ -55,6 +55,13 @@ CPU_INT32U  const  OSDbg_EndiannessTest        = 0x12345678LU;                 /
 
 CPU_INT08U  const  OSDbg_CalledFromISRChkEn    = OS_CFG_CALLED_FROM_ISR_CHK_EN;
 
+CPU_INT08U  const  OSDbg_ISRPostDeferredEn     = OS_CFG_ISR_POST_DEFERRED_EN;
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+CPU_INT16U  const  OSDbg_IntQSize              = sizeof(OS_INT_Q);             /* Size in bytes of an ISR queue entry */
+#else
+CPU_INT16U  const  OSDbg_IntQSize              = 0u;
+#endif
+
 CPU_INT08U  const  OSDbg_FlagEn                = OS_CFG_FLAG_EN;
 OS_FLAG_GRP const  OSDbg_FlagGrp               = { 0u };
 #if (OS_CFG_FLAG_EN > 0u)
@@ -63,12 +70,23 @@ CPU_INT08U  const  OSDbg_FlagModeClrEn         = OS_CFG_FLAG_MODE_CLR_EN;
 CPU_INT08U  const  OSDbg_FlagPendAbortEn       = OS_CFG_FLAG_PEND_ABORT_EN;
 CPU_INT16U  const  OSDbg_FlagGrpSize           = sizeof(OS_FLAG_GRP);          /* Size in Bytes of OS_FLAG_GRP        */
 CPU_INT16U  const  OSDbg_FlagWidth             = sizeof(OS_FLAGS);             /* Width (in bytes) of OS_FLAGS        */
+CPU_INT08U  const  OSDbg_FlagWideEn            = OS_CFG_FLAG_WIDE_EN;
+#if (OS_CFG_FLAG_WIDE_EN > 0u)
+CPU_INT16U  const  OSDbg_FlagWideGrpSize       = sizeof(OS_FLAG_WIDE_GRP);     /* Size in Bytes of OS_FLAG_WIDE_GRP   */
+CPU_INT16U  const  OSDbg_FlagWideWidth         = OS_CFG_FLAG_WIDE_WIDTH;       /* Width (in bits) of a wide group     */
+#else
+CPU_INT16U  const  OSDbg_FlagWideGrpSize       = 0u;
+CPU_INT16U  const  OSDbg_FlagWideWidth         = 0u;
+#endif
 #else
 CPU_INT08U  const  OSDbg_FlagDelEn             = 0u;
 CPU_INT08U  const  OSDbg_FlagModeClrEn         = 0u;
 CPU_INT08U  const  OSDbg_FlagPendAbortEn       = 0u;
 CPU_INT16U  const  OSDbg_FlagGrpSize           = 0u;
 CPU_INT16U  const  OSDbg_FlagWidth             = 0u;
+CPU_INT08U  const  OSDbg_FlagWideEn            = 0u;
+CPU_INT16U  const  OSDbg_FlagWideGrpSize       = 0u;
+CPU_INT16U  const  OSDbg_FlagWideWidth         = 0u;
 #endif
 
 OS_MEM      const  OSDbg_Mem                   = { 0u };
@@ -79,6 +97,13 @@ CPU_INT16U  const  OSDbg_MemSize               = sizeof(OS_MEM);               /
 CPU_INT16U  const  OSDbg_MemSize               = 0u;
 #endif
 
+CPU_INT08U  const  OSDbg_MemBufEn              = OS_CFG_MEM_BUF_EN;
+#if (OS_CFG_MEM_BUF_EN > 0u)
+CPU_INT16U  const  OSDbg_MemBufSize            = sizeof(OS_MEM_BUF);           /* Size in bytes of OS_MEM_BUF         */
+#else
+CPU_INT16U  const  OSDbg_MemBufSize            = 0u;
+#endif
+
 
 #if (OS_MSG_EN > 0u)
 CPU_INT08U  const  OSDbg_MsgEn                 = 1u;
@@ -92,14 +117,23 @@ CPU_INT16U  const  OSDbg_MsgPoolSize           = 0u;
 CPU_INT16U  const  OSDbg_MsgQSize              = 0u;
 #endif
 
+CPU_INT08U  const  OSDbg_MsgBufEn              = OS_CFG_MSG_BUF_EN;
+#if (OS_CFG_MSG_BUF_EN > 0u)
+CPU_INT16U  const  OSDbg_MsgBufSize            = sizeof(OS_MSG_BUF);           /* Size in bytes of OS_MSG_BUF         */
+#else
+CPU_INT16U  const  OSDbg_MsgBufSize            = 0u;
+#endif
+
 
 OS_MUTEX    const  OSDbg_Mutex                 = { 0u };
 CPU_INT08U  const  OSDbg_MutexEn               = OS_CFG_MUTEX_EN;
 #if (OS_CFG_MUTEX_EN > 0u)
+CPU_INT08U  const  OSDbg_MutexCeilEn           = OS_CFG_MUTEX_CEIL_EN;
 CPU_INT08U  const  OSDbg_MutexDelEn            = OS_CFG_MUTEX_DEL_EN;
 CPU_INT08U  const  OSDbg_MutexPendAbortEn      = OS_CFG_MUTEX_PEND_ABORT_EN;
 CPU_INT16U  const  OSDbg_MutexSize             = sizeof(OS_MUTEX);             /* Size in bytes of OS_MUTEX           */
 #else
+CPU_INT08U  const  OSDbg_MutexCeilEn           = 0u;
 CPU_INT08U  const  OSDbg_MutexDelEn            = 0u;
 CPU_INT08U  const  OSDbg_MutexPendAbortEn      = 0u;
 CPU_INT16U  const  OSDbg_MutexSize             = 0u;
@@ -109,9 +143,17 @@ CPU_INT08U  const  OSDbg_ObjTypeChkEn          = OS_CFG_OBJ_TYPE_CHK_EN;
 CPU_INT08U  const  OSDbg_ObjCreatedChkEn       = OS_CFG_OBJ_CREATED_CHK_EN;
 
 
+CPU_INT08U  const  OSDbg_PendListBucketEn      = OS_CFG_PEND_LIST_BUCKET_EN;
 CPU_INT16U  const  OSDbg_PendListSize          = sizeof(OS_PEND_LIST);
 CPU_INT16U  const  OSDbg_PendObjSize           = sizeof(OS_PEND_OBJ);
 
+CPU_INT08U  const  OSDbg_PendMultiEn           = OS_CFG_PEND_MULTI_EN;
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+CPU_INT16U  const  OSDbg_PendDataSize          = sizeof(OS_PEND_DATA);         /* Size in Bytes of OS_PEND_DATA       */
+#else
+CPU_INT16U  const  OSDbg_PendDataSize          = 0u;
+#endif
+
 
 CPU_INT16U  const  OSDbg_PrioMax               = OS_CFG_PRIO_MAX;              /* Maximum number of priorities        */
 CPU_INT16U  const  OSDbg_PrioTblSize           = sizeof(OSPrioTbl);
@@ -125,16 +167,38 @@ CPU_INT08U  const  OSDbg_QEn                   = OS_CFG_Q_EN;
 CPU_INT08U  const  OSDbg_QDelEn                = OS_CFG_Q_DEL_EN;
 CPU_INT08U  const  OSDbg_QFlushEn              = OS_CFG_Q_FLUSH_EN;
 CPU_INT08U  const  OSDbg_QPendAbortEn          = OS_CFG_Q_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_QMultiEn              = OS_CFG_Q_MULTI_EN;
 CPU_INT16U  const  OSDbg_QSize                 = sizeof(OS_Q);                 /* Size in bytes of OS_Q structure     */
+CPU_INT08U  const  OSDbg_QSetEn                = OS_CFG_Q_SET_EN;
+#if (OS_CFG_Q_SET_EN > 0u)
+CPU_INT16U  const  OSDbg_QSetSize              = sizeof(OS_Q_SET);             /* Size in bytes of OS_Q_SET structure */
+#else
+CPU_INT16U  const  OSDbg_QSetSize              = 0u;
+#endif
+CPU_INT08U  const  OSDbg_QRingEn               = OS_CFG_Q_RING_EN;
 #else
 CPU_INT08U  const  OSDbg_QDelEn                = 0u;
 CPU_INT08U  const  OSDbg_QFlushEn              = 0u;
 CPU_INT08U  const  OSDbg_QPendAbortEn          = 0u;
+CPU_INT08U  const  OSDbg_QMultiEn              = 0u;
 CPU_INT16U  const  OSDbg_QSize                 = 0u;
+CPU_INT08U  const  OSDbg_QSetEn                = 0u;
+CPU_INT16U  const  OSDbg_QSetSize              = 0u;
+CPU_INT08U  const  OSDbg_QRingEn               = 0u;
 #endif
+CPU_INT08U  const  OSDbg_QPostWaitEn           = OS_CFG_Q_POST_WAIT_EN;        /* Also covers OSTaskQPostWait()       */
 
 
 CPU_INT08U  const  OSDbg_SchedRoundRobinEn     = OS_CFG_SCHED_ROUND_ROBIN_EN;
+CPU_INT08U  const  OSDbg_SchedEDFEn            = OS_CFG_SCHED_EDF_EN;
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+OS_PRIO     const  OSDbg_SchedEDFPrio          = OS_CFG_SCHED_EDF_PRIO;        /* EDF priority level                  */
+#else
+OS_PRIO     const  OSDbg_SchedEDFPrio          = 0u;
+#endif
+CPU_INT08U  const  OSDbg_SchedPreemptThresEn   = OS_CFG_SCHED_PREEMPT_THRES_EN;
+
+CPU_INT08U  const  OSDbg_SMP_CoreQty           = OS_CFG_SMP_CORE_QTY;          /* Number of cores scheduled           */
 
 
 OS_SEM      const  OSDbg_Sem                   = { 0u };
@@ -160,6 +224,7 @@ CPU_INT08U  const  OSDbg_StkWidth              = sizeof(CPU_STK);
 CPU_INT08U  const  OSDbg_StatTaskEn            = OS_CFG_STAT_TASK_EN;
 CPU_INT08U  const  OSDbg_StatTaskStkChkEn      = OS_CFG_STAT_TASK_STK_CHK_EN;
 
+CPU_INT08U  const  OSDbg_TaskBudgetEn          = OS_CFG_TASK_BUDGET_EN;
 CPU_INT08U  const  OSDbg_TaskChangePrioEn      = OS_CFG_TASK_CHANGE_PRIO_EN;
 CPU_INT08U  const  OSDbg_TaskDelEn             = OS_CFG_TASK_DEL_EN;
 CPU_INT08U  const  OSDbg_TaskQEn               = OS_CFG_TASK_Q_EN;
@@ -173,6 +238,7 @@ CPU_INT08U  const  OSDbg_TaskSuspendEn         = OS_CFG_TASK_SUSPEND_EN;
 CPU_INT16U  const  OSDbg_TCBSize               = sizeof(OS_TCB);               /* Size in Bytes of OS_TCB             */
 
 CPU_INT16U  const  OSDbg_TickListSize          = sizeof(OS_TICK_LIST);
+CPU_INT08U  const  OSDbg_TickWheelEn           = OS_CFG_TICK_WHEEL_EN;
 
 CPU_INT08U  const  OSDbg_TimeDlyHMSMEn         = OS_CFG_TIME_DLY_HMSM_EN;
 CPU_INT08U  const  OSDbg_TimeDlyResumeEn       = OS_CFG_TIME_DLY_RESUME_EN;
@@ -189,9 +255,11 @@ CPU_INT08U  const  OSDbg_TmrEn                 = OS_CFG_TMR_EN;
 #if (OS_CFG_TMR_EN > 0u)
 CPU_INT08U  const  OSDbg_TmrDelEn              = OS_CFG_TMR_DEL_EN;
 CPU_INT16U  const  OSDbg_TmrSize               = sizeof(OS_TMR);
+CPU_INT08U  const  OSDbg_TmrWheelEn            = OS_CFG_TMR_WHEEL_EN;
 #else
 CPU_INT08U  const  OSDbg_TmrDelEn              = 0u;
 CPU_INT16U  const  OSDbg_TmrSize               = 0u;
+CPU_INT08U  const  OSDbg_TmrWheelEn            = 0u;
 #endif
 
 CPU_INT16U  const  OSDbg_VersionNbr            = OS_VERSION;
@@ -225,6 +293,22 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #endif
 #if (OS_CFG_TASK_IDLE_EN > 0u)
                                   + sizeof(OSIdleTaskTCB)
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+                                  + sizeof(OSIdleTaskCoreTCB)
+#endif
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+                                  + sizeof(OSIntQTaskTCB)
+                                  + sizeof(OSIntQTaskRdy)
+#if (OS_CFG_TS_EN > 0u)
+                                  + sizeof(OSIntQTaskTS)
+#endif
+                                  + sizeof(OSIntQInIx)
+                                  + sizeof(OSIntQOutIx)
+                                  + sizeof(OSIntQNbrEntries)
+                                  + sizeof(OSIntQNbrEntriesMax)
+                                  + sizeof(OSIntQOvfCtr)
 #endif
 
 #ifdef CPU_CFG_INT_DIS_MEAS_EN
@@ -265,6 +349,10 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #if (OS_CFG_DBG_EN > 0u)
                                   + sizeof(OSFlagDbgListPtr)
                                   + sizeof(OSFlagQty)
+#if (OS_CFG_FLAG_WIDE_EN > 0u)
+                                  + sizeof(OSFlagWideDbgListPtr)
+                                  + sizeof(OSFlagWideQty)
+#endif
 #endif
 #endif
 
@@ -279,6 +367,13 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSMsgPool)
 #endif
 
+#if (OS_CFG_MSG_BUF_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSMsgBufDbgListPtr)
+                                  + sizeof(OSMsgBufQty)
+#endif
+#endif
+
 #if (OS_CFG_MUTEX_EN > 0u)
 #if (OS_CFG_DBG_EN > 0u)
                                   + sizeof(OSMutexDbgListPtr)
@@ -289,11 +384,18 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSPrioCur)
                                   + sizeof(OSPrioHighRdy)
                                   + sizeof(OSPrioTbl)
+#if (OS_CFG_PRIO_MAX > (2u * (CPU_CFG_DATA_SIZE * 8u)))
+                                  + sizeof(OSPrioGrpTbl)
+#endif
 
 #if (OS_CFG_Q_EN > 0u)
 #if (OS_CFG_DBG_EN > 0u)
                                   + sizeof(OSQDbgListPtr)
                                   + sizeof(OSQQty)
+#if (OS_CFG_Q_SET_EN > 0u)
+                                  + sizeof(OSQSetDbgListPtr)
+                                  + sizeof(OSQSetQty)
+#endif
 #endif
 #endif
 
@@ -310,6 +412,9 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
                                   + sizeof(OSSchedRoundRobinDfltTimeQuanta)
                                   + sizeof(OSSchedRoundRobinEn)
+#if (OS_CFG_DYN_TICK_EN > 0u)
+                                  + sizeof(OSSchedRoundRobinTickCtrPrev)
+#endif
 #endif
 
 #if (OS_CFG_SEM_EN > 0u)
@@ -358,7 +463,11 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSTmrDbgListPtr)
                                   + sizeof(OSTmrListEntries)
 #endif
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+                                  + sizeof(OSTmrWheel)
+#else
                                   + sizeof(OSTmrListPtr)
+#endif
                                   + sizeof(OSTmrMutex)
                                   + sizeof(OSTmrCond)
 #if (OS_CFG_DBG_EN > 0u)
@@ -377,6 +486,11 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSTaskRegNextAvailID)
 #endif
 
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+                                  + sizeof(OSCoreTbl)                   /* One core is counted by the terms of each field */
+                                  - sizeof(OS_CORE)
+#endif
+
                                   + sizeof(OSTCBCurPtr)
                                   + sizeof(OSTCBHighRdyPtr);
 
@@ -418,6 +532,9 @@ void  OS_Dbg_Init (void)
 
     p_temp08 = (CPU_INT08U const *)&OSDbg_CalledFromISRChkEn;
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_ISRPostDeferredEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_IntQSize;
+
     p_temp16 = (CPU_INT16U const *)&OSDbg_FlagGrp;
     p_temp08 = (CPU_INT08U const *)&OSDbg_FlagEn;
 #if (OS_CFG_FLAG_EN > 0u)
@@ -426,6 +543,9 @@ void  OS_Dbg_Init (void)
     p_temp08 = (CPU_INT08U const *)&OSDbg_FlagPendAbortEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_FlagGrpSize;
     p_temp16 = (CPU_INT16U const *)&OSDbg_FlagWidth;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_FlagWideEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_FlagWideGrpSize;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_FlagWideWidth;
 #endif
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_Mem;
@@ -434,6 +554,11 @@ void  OS_Dbg_Init (void)
     p_temp16 = (CPU_INT16U const *)&OSDbg_MemSize;
 #endif
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MemBufEn;
+#if (OS_CFG_MEM_BUF_EN > 0u)
+    p_temp16 = (CPU_INT16U const *)&OSDbg_MemBufSize;
+#endif
+
     p_temp08 = (CPU_INT08U const *)&OSDbg_MsgEn;
 #if (OS_MSG_EN > 0u)
     p_temp16 = (CPU_INT16U const *)&OSDbg_MsgSize;
@@ -441,9 +566,15 @@ void  OS_Dbg_Init (void)
     p_temp16 = (CPU_INT16U const *)&OSDbg_MsgQSize;
 #endif
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MsgBufEn;
+#if (OS_CFG_MSG_BUF_EN > 0u)
+    p_temp16 = (CPU_INT16U const *)&OSDbg_MsgBufSize;
+#endif
+
     p_temp16 = (CPU_INT16U const *)&OSDbg_Mutex;
     p_temp08 = (CPU_INT08U const *)&OSDbg_MutexEn;
 #if (OS_CFG_MUTEX_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MutexCeilEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_MutexDelEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_MutexPendAbortEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_MutexSize;
@@ -452,8 +583,11 @@ void  OS_Dbg_Init (void)
     p_temp08 = (CPU_INT08U const *)&OSDbg_ObjTypeChkEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_ObjCreatedChkEn;
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_PendListBucketEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_PendListSize;
     p_temp16 = (CPU_INT16U const *)&OSDbg_PendObjSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_PendMultiEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_PendDataSize;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_PrioMax;
     p_temp16 = (CPU_INT16U const *)&OSDbg_PrioTblSize;
@@ -466,10 +600,20 @@ void  OS_Dbg_Init (void)
     p_temp08 = (CPU_INT08U const *)&OSDbg_QDelEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_QFlushEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_QPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_QMultiEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_QSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_QSetEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_QSetSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_QRingEn;
 #endif
+    p_temp08 = (CPU_INT08U const *)&OSDbg_QPostWaitEn;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_SchedRoundRobinEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SchedEDFEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SchedEDFPrio;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SchedPreemptThresEn;
+
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SMP_CoreQty;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_Sem;
     p_temp08 = (CPU_INT08U const *)&OSDbg_SemEn;
@@ -488,6 +632,7 @@ void  OS_Dbg_Init (void)
     p_temp08 = (CPU_INT08U const *)&OSDbg_StatTaskEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_StatTaskStkChkEn;
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskBudgetEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskChangePrioEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskDelEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskQEn;
@@ -500,6 +645,7 @@ void  OS_Dbg_Init (void)
     p_temp16 = (CPU_INT16U const *)&OSDbg_TCBSize;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_TickListSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TickWheelEn;
 
     p_temp08 = (CPU_INT08U const *)&OSDbg_TimeDlyHMSMEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TimeDlyResumeEn;
@@ -511,6 +657,7 @@ void  OS_Dbg_Init (void)
 #if (OS_CFG_TMR_EN > 0u)
     p_temp08 = (CPU_INT08U const *)&OSDbg_TmrDelEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_TmrSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TmrWheelEn;
 #endif
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_VersionNbr;
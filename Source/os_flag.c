@@ -33,6 +33,31 @@ const  CPU_CHAR  *os_flag__c = "$Id: $";
 
 #if (OS_CFG_FLAG_EN > 0u)
 
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_FlagWaitListInit   (OS_FLAG_GRP  *p_grp);
+
+static  void  OS_FlagWaitListInsert (OS_FLAG_GRP  *p_grp,
+                                     OS_TCB       *p_tcb);
+
+static  void  OS_FlagWaitListUnlink (OS_FLAG_GRP  *p_grp,
+                                     OS_TCB       *p_tcb);
+
+static  void  OS_FlagWaitListPost   (OS_FLAG_GRP  *p_grp,
+                                     OS_FLAGS      flags_chg,
+                                     CPU_TS        ts);
+
+static  void  OS_FlagWaitListTest   (OS_FLAG_GRP  *p_grp,
+                                     OS_TCB       *p_tcb,
+                                     CPU_TS        ts);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                 CREATE AN EVENT FLAG
@@ -110,9 +135,17 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,
 #else
     (void)p_name;
 #endif
-    p_grp->Flags   = flags;                                     /* Set to desired initial value                         */
+    p_grp->Flags         = flags;                               /* Set to desired initial value                         */
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+    OS_FlagWaitListInit(p_grp);
+#else
+    p_grp->FlagsWatched  = 0u;
+#endif
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+    p_grp->FlagsConsumed = 0u;
+#endif
 #if (OS_CFG_TS_EN > 0u)
-    p_grp->TS      = 0u;
+    p_grp->TS            = 0u;
 #endif
     OS_PendListInit(&p_grp->PendList);
 
@@ -459,6 +492,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
              if (flags_rdy == flags) {                          /* Must match ALL the bits that we want                 */
                  if (consume == OS_TRUE) {                      /* See if we need to consume the flags                  */
                      p_grp->Flags &= ~flags_rdy;                /* Clear ONLY the flags that we wanted                  */
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+                     p_grp->FlagsConsumed |= flags_rdy;         /* See OSFlagPost(), Note #2                            */
+#endif
                  }
                  OSTCBCurPtr->FlagsRdy = flags_rdy;             /* Save flags that were ready                           */
 #if (OS_CFG_TS_EN > 0u)
@@ -501,6 +537,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
              if (flags_rdy != 0u) {                             /* See if any flag set                                  */
                  if (consume == OS_TRUE) {                      /* See if we need to consume the flags                  */
                      p_grp->Flags &= ~flags_rdy;                /* Clear ONLY the flags that we got                     */
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+                     p_grp->FlagsConsumed |= flags_rdy;         /* See OSFlagPost(), Note #2                            */
+#endif
                  }
                  OSTCBCurPtr->FlagsRdy = flags_rdy;             /* Save flags that were ready                           */
 #if (OS_CFG_TS_EN > 0u)
@@ -542,6 +581,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
              if (flags_rdy == flags) {                          /* Must match ALL the bits that we want                 */
                  if (consume == OS_TRUE) {                      /* See if we need to consume the flags                  */
                      p_grp->Flags |= flags_rdy;                 /* Set ONLY the flags that we wanted                    */
+                     p_grp->FlagsConsumed |= flags_rdy;         /* See OSFlagPost(), Note #2                            */
                  }
                  OSTCBCurPtr->FlagsRdy = flags_rdy;             /* Save flags that were ready                           */
 #if (OS_CFG_TS_EN > 0u)
@@ -582,6 +622,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
              if (flags_rdy != 0u) {                             /* See if any flag cleared                              */
                  if (consume == OS_TRUE) {                      /* See if we need to consume the flags                  */
                      p_grp->Flags |= flags_rdy;                 /* Set ONLY the flags that we got                       */
+                     p_grp->FlagsConsumed |= flags_rdy;         /* See OSFlagPost(), Note #2                            */
                  }
                  OSTCBCurPtr->FlagsRdy = flags_rdy;             /* Save flags that were ready                           */
 #if (OS_CFG_TS_EN > 0u)
@@ -690,12 +731,16 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
             case OS_OPT_PEND_FLAG_SET_ALL:
             case OS_OPT_PEND_FLAG_SET_ANY:                      /* Clear ONLY the flags we got                          */
                  p_grp->Flags &= ~flags_rdy;
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+                 p_grp->FlagsConsumed |= flags_rdy;             /* See OSFlagPost(), Note #2                            */
+#endif
                  break;
 
 #if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
             case OS_OPT_PEND_FLAG_CLR_ALL:
             case OS_OPT_PEND_FLAG_CLR_ANY:                      /* Set   ONLY the flags we got                          */
                  p_grp->Flags |=  flags_rdy;
+                 p_grp->FlagsConsumed |= flags_rdy;             /* See OSFlagPost(), Note #2                            */
                  break;
 #endif
             default:
@@ -932,10 +977,32 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (OS_ERR  *p_err)
 *                                OS_ERR_OBJ_TYPE            You are not pointing to an event flag group
 *                                OS_ERR_OPT_INVALID         You specified an invalid option
 *                                OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                                OS_ERR_INT_Q_FULL          If the ISR queue is full, when posts from ISRs are deferred
 *
 * Returns    : the new value of the event flags bits that are still set.
 *
 * Note(s)    : 1) The execution time of this function depends on the number of tasks waiting on the event flag group.
+*                 When posts from ISRs are deferred (OS_CFG_ISR_POST_DEFERRED_EN), an ISR only spends a constant time
+*                 queuing the post for the ISR handler task, and this function then returns 0.
+*
+*              2) A waiting task can only be readied by a change of the flags it waits on.  The group keeps the union
+*                 of the flags its waiting tasks wait on, 'FlagsWatched', and a post that changes none of them returns
+*                 without going through the waiting tasks.  This is only a fast path for such posts.  'FlagsWatched'
+*                 is rebuilt on each pass through the list, so it may hold the flags of tasks that timed out or were
+*                 aborted until the next pass.  Flags changed by a task consuming them in OSFlagPend() are looked at on
+*                 the next post, as if it had changed them.
+*
+*              3) A post that changes a flag any task waits on still goes through ALL the waiting tasks, as without
+*                 Note #2, and costs about the same.  Only the wait condition of the tasks whose flags did not change
+*                 is skipped.
+*
+*              4) With OS_CFG_FLAG_WAIT_LIST_EN, the fast path of Note #2 tests the flags of the wait lists instead of
+*                 'FlagsWatched', and Note #3 does not apply.  A post only looks at the tasks filed under the flags it
+*                 changes, see OS_FlagWaitListPost().  A task waiting for ALL of its flags, or for a single
+*                 flag, is filed under ONE of its flags that does not satisfy its wait, since it cannot be readied until
+*                 that flag changes.  When it does, the task is readied or filed under another such flag.  A task
+*                 waiting for ANY of several flags is kept in one list per group, looked at by the posts that change
+*                 one of the flags of its tasks.
 ************************************************************************************************************************
 */
 
@@ -946,11 +1013,15 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
 {
 
     OS_FLAGS       flags_cur;
+    OS_FLAGS       flags_chg;
+#if (OS_CFG_FLAG_WAIT_LIST_EN == 0u)
     OS_FLAGS       flags_rdy;
+    OS_FLAGS       flags_watched;
     OS_OPT         mode;
-    OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     OS_TCB        *p_tcb_next;
+#endif
+    OS_PEND_LIST  *p_pend_list;
     CPU_TS         ts;
     CPU_SR_ALLOC();
 
@@ -996,18 +1067,40 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     ts = 0u;
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Defer posts made from ISRs to the ISR handler task   */
+        OS_IntQPost(OS_OBJ_TYPE_FLAG,
+                    (void *)p_grp,
+                    (void *)0,
+                    0u,
+                    flags,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_FLAG_POST_EXIT(*p_err);
+        return (0u);
+    }
+#if (OS_CFG_TS_EN > 0u)
+    if (OSTCBCurPtr == &OSIntQTaskTCB) {                        /* Keep the time stamp of a replayed ISR post           */
+        ts = OSIntQTaskTS;
+    }
+#endif
+#endif
+
     OS_TRACE_FLAG_POST(p_grp);
 
     switch (opt) {
         case OS_OPT_POST_FLAG_SET:
         case OS_OPT_POST_FLAG_SET | OS_OPT_POST_NO_SCHED:
-             CPU_CRITICAL_ENTER();
+             OS_CRITICAL_ENTER();
+             flags_chg     = (OS_FLAGS)(flags & ~p_grp->Flags); /* Flags that go from 0 to 1                            */
              p_grp->Flags |=  flags;                            /* Set   the flags specified in the group               */
              break;
 
         case OS_OPT_POST_FLAG_CLR:
         case OS_OPT_POST_FLAG_CLR | OS_OPT_POST_NO_SCHED:
-             CPU_CRITICAL_ENTER();
+             OS_CRITICAL_ENTER();
+             flags_chg     = (OS_FLAGS)(flags &  p_grp->Flags); /* Flags that go from 1 to 0                            */
              p_grp->Flags &= ~flags;                            /* Clear the flags specified in the group               */
              break;
 
@@ -1018,75 +1111,114 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     }
 #if (OS_CFG_TS_EN > 0u)
     p_grp->TS   = ts;
+#endif
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+    flags_chg            |= p_grp->FlagsConsumed;               /* See Note #2                                          */
+    p_grp->FlagsConsumed  = 0u;
 #endif
     p_pend_list = &p_grp->PendList;
     if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on event flag group?                */
-        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+#if (OS_CFG_FLAG_WAIT_LIST_EN == 0u)
+        p_grp->FlagsWatched = 0u;
+#endif
+        OS_CRITICAL_EXIT();                                     /* No                                                   */
        *p_err = OS_ERR_NONE;
         OS_TRACE_FLAG_POST_EXIT(*p_err);
         return (p_grp->Flags);
     }
 
-    p_tcb = p_pend_list->HeadPtr;
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+    if ((flags_chg & (p_grp->WaitListFlags | p_grp->WaitAnyFlags)) == 0u) {
+#else
+    if ((flags_chg & p_grp->FlagsWatched) == 0u) {              /* Did a flag a task waits on change?                   */
+#endif
+        flags_cur = p_grp->Flags;                               /* No, no task can be readied                           */
+        OS_CRITICAL_EXIT();
+       *p_err     = OS_ERR_NONE;
+        OS_TRACE_FLAG_POST_EXIT(*p_err);
+        return (flags_cur);
+    }
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+    OS_FlagWaitListPost(p_grp,                                  /* Only look at the tasks filed under the changed ...   */
+                        flags_chg,                              /* ... flags, see Note #4                               */
+                        ts);
+#else
+
+    flags_watched = 0u;
+    p_tcb         = p_pend_list->HeadPtr;
     while (p_tcb != (OS_TCB *)0) {                              /* Go through all tasks waiting on event flag(s)        */
         p_tcb_next = p_tcb->PendNextPtr;
-        mode       = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK;
-        switch (mode) {
-            case OS_OPT_PEND_FLAG_SET_ALL:                      /* See if all req. flags are set for current node       */
-                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy == p_tcb->FlagsPend) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
-
-            case OS_OPT_PEND_FLAG_SET_ANY:                      /* See if any flag set                                  */
-                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy != 0u) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
+        if ((p_tcb->FlagsPend & flags_chg) == 0u) {             /* Skip tasks whose flags did not change, see Note #3   */
+            flags_watched |= p_tcb->FlagsPend;
+        } else {
+            mode = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK;
+            switch (mode) {
+                case OS_OPT_PEND_FLAG_SET_ALL:                  /* See if all req. flags are set for current node       */
+                     flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
+                     if (flags_rdy == p_tcb->FlagsPend) {
+                         OS_FlagTaskRdy(p_tcb,                  /* Make task RTR, event(s) Rx'd                         */
+                                        flags_rdy,
+                                        ts);
+                     } else {
+                         flags_watched |= p_tcb->FlagsPend;
+                     }
+                     break;
+
+                case OS_OPT_PEND_FLAG_SET_ANY:                  /* See if any flag set                                  */
+                     flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
+                     if (flags_rdy != 0u) {
+                         OS_FlagTaskRdy(p_tcb,                  /* Make task RTR, event(s) Rx'd                         */
+                                        flags_rdy,
+                                        ts);
+                     } else {
+                         flags_watched |= p_tcb->FlagsPend;
+                     }
+                     break;
 
 #if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
-            case OS_OPT_PEND_FLAG_CLR_ALL:                      /* See if all req. flags are set for current node       */
-                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy == p_tcb->FlagsPend) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
-
-            case OS_OPT_PEND_FLAG_CLR_ANY:                      /* See if any flag set                                  */
-                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy != 0u) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
+                case OS_OPT_PEND_FLAG_CLR_ALL:                  /* See if all req. flags are set for current node       */
+                     flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
+                     if (flags_rdy == p_tcb->FlagsPend) {
+                         OS_FlagTaskRdy(p_tcb,                  /* Make task RTR, event(s) Rx'd                         */
+                                        flags_rdy,
+                                        ts);
+                     } else {
+                         flags_watched |= p_tcb->FlagsPend;
+                     }
+                     break;
+
+                case OS_OPT_PEND_FLAG_CLR_ANY:                  /* See if any flag set                                  */
+                     flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
+                     if (flags_rdy != 0u) {
+                         OS_FlagTaskRdy(p_tcb,                  /* Make task RTR, event(s) Rx'd                         */
+                                        flags_rdy,
+                                        ts);
+                     } else {
+                         flags_watched |= p_tcb->FlagsPend;
+                     }
+                     break;
 #endif
-            default:
-                 CPU_CRITICAL_EXIT();
-                *p_err = OS_ERR_FLAG_PEND_OPT;
-                 OS_TRACE_FLAG_POST_EXIT(*p_err);
-                 return (0u);
+                default:
+                     OS_CRITICAL_EXIT();
+                    *p_err = OS_ERR_FLAG_PEND_OPT;
+                     OS_TRACE_FLAG_POST_EXIT(*p_err);
+                     return (0u);
+            }
         }
                                                                 /* Point to next task waiting for event flag(s)         */
         p_tcb = p_tcb_next;
     }
-    CPU_CRITICAL_EXIT();
+    p_grp->FlagsWatched = flags_watched;                        /* Drop the flags of the readied tasks                  */
+#endif
+    OS_CRITICAL_EXIT();
 
     if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
         OSSched();
     }
 
-    CPU_CRITICAL_ENTER();
+    OS_CRITICAL_ENTER();
     flags_cur = p_grp->Flags;
-    CPU_CRITICAL_EXIT();
+    OS_CRITICAL_EXIT();
    *p_err     = OS_ERR_NONE;
 
     OS_TRACE_FLAG_POST_EXIT(*p_err);
@@ -1135,6 +1267,12 @@ void  OS_FlagBlock (OS_FLAG_GRP  *p_grp,
     OSTCBCurPtr->FlagsPend = flags;                             /* Save the flags that we need to wait for              */
     OSTCBCurPtr->FlagsOpt  = opt;                               /* Save the type of wait we are doing                   */
     OSTCBCurPtr->FlagsRdy  = 0u;
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+    OS_FlagWaitListInsert(p_grp,                                /* Only posts changing its flag look at the task        */
+                          OSTCBCurPtr);
+#else
+    p_grp->FlagsWatched   |= flags;                             /* Only posts changing these flags look at the task     */
+#endif
 
     OS_Pend((OS_PEND_OBJ *)((void *)p_grp),
              OSTCBCurPtr,
@@ -1171,6 +1309,14 @@ void  OS_FlagClr (OS_FLAG_GRP  *p_grp)
     p_grp->NamePtr          = (CPU_CHAR *)((void *)"?FLAG");    /* Unknown name                                         */
 #endif
     p_grp->Flags            =  0u;
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+    OS_FlagWaitListInit(p_grp);
+#else
+    p_grp->FlagsWatched     =  0u;
+#endif
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+    p_grp->FlagsConsumed    =  0u;
+#endif
     p_pend_list             = &p_grp->PendList;
     OS_PendListInit(p_pend_list);
 }
@@ -1260,6 +1406,11 @@ void   OS_FlagTaskRdy (OS_TCB    *p_tcb,
                        OS_FLAGS   flags_rdy,
                        CPU_TS     ts)
 {
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
 #if (OS_CFG_TS_EN == 0u)
     (void)ts;                                                   /* Prevent compiler warning for not using 'ts'          */
 #endif
@@ -1269,6 +1420,9 @@ void   OS_FlagTaskRdy (OS_TCB    *p_tcb,
     p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;                /* Indicate no longer pending                           */
 #if (OS_CFG_TS_EN > 0u)
     p_tcb->TS         = ts;
+#endif
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    CPU_CRITICAL_ENTER();                                       /* The ISRs share the ready list and the tick list      */
 #endif
     switch (p_tcb->TaskState) {
         case OS_TASK_STATE_PEND:
@@ -1300,6 +1454,292 @@ void   OS_FlagTaskRdy (OS_TCB    *p_tcb,
                                                                 /* Default case.                                        */
              break;
     }
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    CPU_CRITICAL_EXIT();
+#endif
     OS_PendListRemove(p_tcb);
 }
+
+
+/*
+************************************************************************************************************************
+*                                       INITIALIZE THE WAIT LISTS OF A GROUP
+*
+* Description: This function is called by OSFlagCreate() and OS_FlagClr() to empty the wait lists of an event flag
+*              group.
+*
+* Arguments  : p_grp     is a pointer to the event flag group
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+static  void  OS_FlagWaitListInit (OS_FLAG_GRP  *p_grp)
+{
+    CPU_INT08U  bit;
+
+
+    p_grp->WaitListFlags  =  0u;
+    p_grp->WaitAnyFlags   =  0u;
+    p_grp->WaitAnyHeadPtr = (OS_TCB *)0;
+    for (bit = 0u; bit < OS_FLAG_BIT_QTY; bit++) {
+        p_grp->WaitListTbl[bit] = (OS_TCB *)0;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                        FILE A WAITING TASK IN A WAIT LIST
+*
+* Description: This function files a task waiting on an event flag group under one of the flags it waits on that does not
+*              satisfy its wait, or in the list of the tasks waiting for ANY of several flags, see OSFlagPost() Note #4.
+*
+* Arguments  : p_grp     is a pointer to the event flag group
+*
+*              p_tcb     is a pointer to the TCB of the waiting task, '.FlagsPend' and '.FlagsOpt' already set
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) The task is filed under the lowest such flag.  A task waiting for ANY of no flag at all can never be
+*                 readied by a post and is not filed.
+************************************************************************************************************************
+*/
+
+static  void  OS_FlagWaitListInsert (OS_FLAG_GRP  *p_grp,
+                                     OS_TCB       *p_tcb)
+{
+    OS_FLAGS     flags_wait;
+    OS_OPT       mode;
+    CPU_INT08U   bit;
+    OS_TCB     **p_head;
+
+
+    mode = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK;
+    if ((mode == OS_OPT_PEND_FLAG_SET_ALL) ||
+        (mode == OS_OPT_PEND_FLAG_SET_ANY)) {
+        flags_wait = (OS_FLAGS)(p_tcb->FlagsPend & ~p_grp->Flags);  /* Flags still to be set                            */
+    } else {
+        flags_wait = (OS_FLAGS)(p_tcb->FlagsPend &  p_grp->Flags);  /* Flags still to be cleared                        */
+    }
+
+    if (((mode == OS_OPT_PEND_FLAG_SET_ANY) || (mode == OS_OPT_PEND_FLAG_CLR_ANY)) &&
+        ((p_tcb->FlagsPend & (OS_FLAGS)(p_tcb->FlagsPend - 1u)) != 0u)) {
+        bit                  = OS_FLAG_WAIT_ANY;                /* ANY of several flags                                 */
+        p_head               = &p_grp->WaitAnyHeadPtr;
+        p_grp->WaitAnyFlags |=  p_tcb->FlagsPend;
+    } else if (flags_wait != 0u) {
+        bit                   = (CPU_INT08U)CPU_CntTrailZeros32((CPU_INT32U)flags_wait);
+        p_head                = &p_grp->WaitListTbl[bit];
+        p_grp->WaitListFlags |= (OS_FLAGS)((OS_FLAGS)1u << bit);
+    } else {
+        p_tcb->FlagWaitBit    = OS_FLAG_WAIT_NONE;              /* See Note #2                                          */
+        return;
+    }
+
+    p_tcb->FlagWaitBit     =  bit;                              /* Insert at the head of the list                       */
+    p_tcb->FlagWaitPrevPtr = (OS_TCB *)0;
+    p_tcb->FlagWaitNextPtr = *p_head;
+    if (*p_head != (OS_TCB *)0) {
+        (*p_head)->FlagWaitPrevPtr = p_tcb;
+    }
+   *p_head                 =  p_tcb;
+}
+
+
+/*
+************************************************************************************************************************
+*                                       REMOVE A WAITING TASK FROM ITS WAIT LIST
+*
+* Description: These functions remove a task from the wait list of an event flag group it is filed in.
+*              OS_FlagWaitListRemove() is called by OS_PendListRemove() when the task stops waiting on the group.
+*
+* Arguments  : p_grp     is a pointer to the event flag group
+*
+*              p_tcb     is a pointer to the TCB of the task
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application should not call them.
+*
+*              2) '.WaitAnyFlags' is only cleared when its list becomes empty, it is otherwise rebuilt by the next post
+*                 that goes through the list.
+************************************************************************************************************************
+*/
+
+void  OS_FlagWaitListRemove (OS_TCB  *p_tcb)
+{
+    OS_FlagWaitListUnlink((OS_FLAG_GRP *)((void *)p_tcb->PendObjPtr),
+                           p_tcb);
+}
+
+
+static  void  OS_FlagWaitListUnlink (OS_FLAG_GRP  *p_grp,
+                                     OS_TCB       *p_tcb)
+{
+    OS_TCB     **p_head;
+    OS_TCB      *p_next;
+    OS_TCB      *p_prev;
+    CPU_INT08U   bit;
+
+
+    bit = p_tcb->FlagWaitBit;
+    if (bit == OS_FLAG_WAIT_NONE) {                             /* Not filed                                            */
+        return;
+    }
+    if (bit == OS_FLAG_WAIT_ANY) {
+        p_head = &p_grp->WaitAnyHeadPtr;
+    } else {
+        p_head = &p_grp->WaitListTbl[bit];
+    }
+
+    p_next = p_tcb->FlagWaitNextPtr;
+    p_prev = p_tcb->FlagWaitPrevPtr;
+    if (p_prev == (OS_TCB *)0) {
+       *p_head                  = p_next;
+    } else {
+        p_prev->FlagWaitNextPtr = p_next;
+    }
+    if (p_next != (OS_TCB *)0) {
+        p_next->FlagWaitPrevPtr = p_prev;
+    }
+
+    if (*p_head == (OS_TCB *)0) {                               /* List now empty?                                      */
+        if (bit == OS_FLAG_WAIT_ANY) {
+            p_grp->WaitAnyFlags   =  0u;                        /* See Note #2                                          */
+        } else {
+            p_grp->WaitListFlags &= (OS_FLAGS)~((OS_FLAGS)1u << bit);
+        }
+    }
+    p_tcb->FlagWaitNextPtr = (OS_TCB *)0;
+    p_tcb->FlagWaitPrevPtr = (OS_TCB *)0;
+    p_tcb->FlagWaitBit     =  OS_FLAG_WAIT_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                    LOOK AT THE TASKS WAITING FOR THE CHANGED FLAGS
+*
+* Description: This function is called by OSFlagPost() to test the wait of the tasks filed under the flags that the post
+*              changed, and of the tasks waiting for ANY of several flags if one of their flags changed, see OSFlagPost()
+*              Note #4.
+*
+* Arguments  : p_grp       is a pointer to the event flag group
+*
+*              flags_chg   are the flags changed by the post
+*
+*              ts          is the timestamp of the post
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) A task filed under another flag by OS_FlagWaitListTest() may be looked at again in the same post, it
+*                 then stays where it is.
+************************************************************************************************************************
+*/
+
+static  void  OS_FlagWaitListPost (OS_FLAG_GRP  *p_grp,
+                                   OS_FLAGS      flags_chg,
+                                   CPU_TS        ts)
+{
+    OS_FLAGS     flags;
+    OS_FLAGS     flags_any;
+    CPU_INT08U   bit;
+    OS_TCB      *p_tcb;
+    OS_TCB      *p_tcb_next;
+
+
+    flags = flags_chg & p_grp->WaitListFlags;
+    while (flags != 0u) {                                       /* Go through the changed flags having waiting tasks    */
+        bit    = (CPU_INT08U)CPU_CntTrailZeros32((CPU_INT32U)flags);
+        flags &= (OS_FLAGS)(flags - 1u);
+        p_tcb  = p_grp->WaitListTbl[bit];
+        while (p_tcb != (OS_TCB *)0) {
+            p_tcb_next = p_tcb->FlagWaitNextPtr;
+            OS_FlagWaitListTest(p_grp, p_tcb, ts);              /* See Note #2                                          */
+            p_tcb      = p_tcb_next;
+        }
+    }
+
+    if ((flags_chg & p_grp->WaitAnyFlags) != 0u) {              /* Did a flag a task waiting for ANY flag change?       */
+        flags_any = 0u;
+        p_tcb     = p_grp->WaitAnyHeadPtr;
+        while (p_tcb != (OS_TCB *)0) {
+            p_tcb_next = p_tcb->FlagWaitNextPtr;
+            if ((p_tcb->FlagsPend & flags_chg) != 0u) {
+                OS_FlagWaitListTest(p_grp, p_tcb, ts);
+            }
+            if (p_tcb->FlagWaitBit == OS_FLAG_WAIT_ANY) {       /* Still waiting?                                       */
+                flags_any |= p_tcb->FlagsPend;
+            }
+            p_tcb      = p_tcb_next;
+        }
+        p_grp->WaitAnyFlags = flags_any;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                          TEST THE WAIT OF A WAITING TASK
+*
+* Description: This function readies a task whose wait is satisfied by the flags of its event flag group.  Otherwise, a
+*              task filed under a flag that now satisfies its wait is filed under another flag, see OSFlagPost() Note #4.
+*
+* Arguments  : p_grp     is a pointer to the event flag group
+*
+*              p_tcb     is a pointer to the TCB of the waiting task
+*
+*              ts        is the timestamp of the post
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_FlagWaitListTest (OS_FLAG_GRP  *p_grp,
+                                   OS_TCB       *p_tcb,
+                                   CPU_TS        ts)
+{
+    OS_FLAGS  flags_rdy;
+    OS_OPT    mode;
+
+
+    mode = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK;
+    if ((mode == OS_OPT_PEND_FLAG_SET_ALL) ||
+        (mode == OS_OPT_PEND_FLAG_SET_ANY)) {
+        flags_rdy = (OS_FLAGS)( p_grp->Flags & p_tcb->FlagsPend);
+    } else {
+        flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
+    }
+
+    if ((mode == OS_OPT_PEND_FLAG_SET_ALL) ||
+        (mode == OS_OPT_PEND_FLAG_CLR_ALL)) {
+        if (flags_rdy == p_tcb->FlagsPend) {
+            OS_FlagTaskRdy(p_tcb,                               /* Make task RTR, event(s) Rx'd                         */
+                           flags_rdy,
+                           ts);
+        } else if ((flags_rdy & ((OS_FLAGS)1u << p_tcb->FlagWaitBit)) != 0u) {
+            OS_FlagWaitListUnlink(p_grp, p_tcb);                /* Its flag is satisfied, file it under another one     */
+            OS_FlagWaitListInsert(p_grp, p_tcb);
+        } else {
+                                                                /* Its flag is still not satisfied, leave it there      */
+        }
+    } else {
+        if (flags_rdy != 0u) {
+            OS_FlagTaskRdy(p_tcb,                               /* Make task RTR, event(s) Rx'd                         */
+                           flags_rdy,
+                           ts);
+        }
+    }
+}
+#endif
 #endif
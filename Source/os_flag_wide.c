@@ -0,0 +1,1060 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      WIDE EVENT FLAG MANAGEMENT
+*
+* File    : os_flag_wide.c
+* Version : V3.08.02
+*********************************************************************************************************
+* Note(s) : (1) A wide event flag group holds OS_CFG_FLAG_WIDE_WIDTH flags instead of the width of OS_FLAGS.  Its
+*               services behave as the OSFlag...() services, with the flags passed by pointer in an OS_FLAGS_WIDE.
+*
+*           (2) Flags are matched one CPU_DATA word at a time: a wide group costs OS_FLAG_WIDE_WORD_QTY logical
+*               operations per waiting task and per post, without branching on each word.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_flag_wide__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_FLAG_EN > 0u) && (OS_CFG_FLAG_WIDE_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_FlagWideTest    (const  OS_FLAGS_WIDE     *p_grp_flags,
+                                         const  OS_FLAGS_WIDE     *p_flags,
+                                                OS_OPT             mode);
+
+static  void         OS_FlagWideRdyGet  (const  OS_FLAGS_WIDE     *p_grp_flags,
+                                         const  OS_FLAGS_WIDE     *p_flags,
+                                                OS_OPT             mode,
+                                                OS_FLAGS_WIDE     *p_flags_rdy);
+
+static  void         OS_FlagWideConsume (       OS_FLAG_WIDE_GRP  *p_grp,
+                                         const  OS_FLAGS_WIDE     *p_flags_rdy,
+                                                OS_OPT             mode);
+
+
+/*
+************************************************************************************************************************
+*                                             CREATE A WIDE EVENT FLAG GROUP
+*
+* Description: This function is called to create a wide event flag group.
+*
+* Arguments  : p_grp          is a pointer to the wide event flag group to create
+*
+*              p_name         is the name of the wide event flag group
+*
+*              p_flags        is a pointer to the initial value to store in the group.  If you pass a NULL pointer
+*                             (i.e. (OS_FLAGS_WIDE *)0), all the flags are cleared.
+*
+*              p_err          is a pointer to an error code which will be returned to your application:
+*
+*                                 OS_ERR_NONE                    If the call was successful
+*                                 OS_ERR_CREATE_ISR              If you attempted to create an Event Flag from an ISR
+*                                 OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the Event Flag after you
+*                                                                   called OSSafetyCriticalStart().
+*                                 OS_ERR_OBJ_PTR_NULL            If 'p_grp' is a NULL pointer
+*                                 OS_ERR_OBJ_CREATED             If the event flag was already created
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSFlagWideCreate (OS_FLAG_WIDE_GRP       *p_grp,
+                        CPU_CHAR               *p_name,
+                        const  OS_FLAGS_WIDE   *p_flags,
+                        OS_ERR                 *p_err)
+{
+    CPU_DATA  ix;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from ISR ...                           */
+       *p_err = OS_ERR_CREATE_ISR;                              /* ... can't CREATE from an ISR                         */
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_FLAG_WIDE_GRP *)0) {                       /* Validate 'p_grp'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_grp->Type == OS_OBJ_TYPE_FLAG_WIDE) {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_grp->Type    = OS_OBJ_TYPE_FLAG_WIDE;                     /* Set to wide event flag group type                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_grp->NamePtr = p_name;
+#else
+    (void)p_name;
+#endif
+    for (ix = 0u; ix < OS_FLAG_WIDE_WORD_QTY; ix++) {           /* Set to desired initial value                         */
+        if (p_flags == (const OS_FLAGS_WIDE *)0) {
+            p_grp->Flags.Word[ix] = 0u;
+        } else {
+            p_grp->Flags.Word[ix] = p_flags->Word[ix];
+        }
+    }
+#if (OS_CFG_TS_EN > 0u)
+    p_grp->TS      = 0u;
+#endif
+    OS_PendListInit(&p_grp->PendList);
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_FlagWideDbgListAdd(p_grp);
+    OSFlagWideQty++;
+#endif
+
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          DELETE A WIDE EVENT FLAG GROUP
+*
+* Description: This function deletes a wide event flag group and readies all tasks pending on it.
+*
+* Arguments  : p_grp     is a pointer to the desired wide event flag group.
+*
+*              opt       determines delete options as follows:
+*
+*                            OS_OPT_DEL_NO_PEND           Deletes the event flag group ONLY if no task pending
+*                            OS_OPT_DEL_ALWAYS            Deletes the event flag group even if tasks are waiting.
+*                                                         In this case, all the tasks pending will be readied.
+*
+*              p_err     is a pointer to an error code that can contain one of the following values:
+*
+*                            OS_ERR_NONE                    The call was successful and the event flag group was deleted
+*                            OS_ERR_DEL_ISR                 If you attempted to delete the event flag group from an ISR
+*                            OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the event flag group after you
+*                                                             called OSStart()
+*                            OS_ERR_OBJ_PTR_NULL            If 'p_grp' is a NULL pointer
+*                            OS_ERR_OBJ_TYPE                If you didn't pass a pointer to a wide event flag group
+*                            OS_ERR_OPT_INVALID             An invalid option was specified
+*                            OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                            OS_ERR_TASK_WAITING            One or more tasks were waiting on the event flag group
+*
+* Returns    : == 0          if no tasks were waiting on the event flag group, or upon error.
+*              >  0          if one or more tasks waiting on the event flag group are now readied and informed.
+*
+* Note(s)    : 1) This function must be used with care.  Tasks that would normally expect the presence of the event flag
+*                 group MUST check the return code of OSFlagWidePost and OSFlagWidePend().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_DEL_EN > 0u)
+OS_OBJ_QTY  OSFlagWideDel (OS_FLAG_WIDE_GRP  *p_grp,
+                           OS_OPT             opt,
+                           OS_ERR            *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from ISR ...                           */
+       *p_err = OS_ERR_DEL_ISR;                                 /* ... can't DELETE from an ISR                         */
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_FLAG_WIDE_GRP *)0) {                       /* Validate 'p_grp'                                     */
+       *p_err  = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_grp->Type != OS_OBJ_TYPE_FLAG_WIDE) {                 /* Validate event group object                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_grp->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete group if no task waiting                      */
+             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_FlagWideDbgListRemove(p_grp);
+                 OSFlagWideQty--;
+#endif
+                 OS_FlagWideClr(p_grp);
+
+                 CPU_CRITICAL_EXIT();
+
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the event flag group                   */
+#if (OS_CFG_TS_EN > 0u)
+             ts = OS_TS_GET();                                  /* Get local time stamp so all tasks get the same time  */
+#else
+             ts = 0u;
+#endif
+             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks from the pend list                  */
+                 p_tcb = p_pend_list->HeadPtr;
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_FlagWideDbgListRemove(p_grp);
+             OSFlagWideQty--;
+#endif
+             OS_FlagWideClr(p_grp);
+             CPU_CRITICAL_EXIT();
+
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          WAIT ON A WIDE EVENT FLAG GROUP
+*
+* Description: This function is called to wait for a combination of flags in a wide event flag group.  Your application
+*              can wait for ANY flag to be set or ALL flags to be set, or cleared.
+*
+* Arguments  : p_grp         is a pointer to the desired wide event flag group.
+*
+*              p_flags       is a pointer to the flags you wish to wait for.  The flags are copied, so they may be
+*                            changed while the task waits.
+*
+*              timeout       is an optional timeout (in clock ticks) that your task will wait for the
+*                            desired flag combination.  If you specify 0, however, your task will wait
+*                            forever at the specified event flag group or, until a message arrives.
+*
+*              opt           specifies the type of wait, with the same options as OSFlagPend():
+*
+*                                OS_OPT_PEND_FLAG_CLR_ALL   You will wait for ALL flags in 'p_flags' to be clear (0)
+*                                OS_OPT_PEND_FLAG_CLR_ANY   You will wait for ANY flag  in 'p_flags' to be clear (0)
+*                                OS_OPT_PEND_FLAG_SET_ALL   You will wait for ALL flags in 'p_flags' to be set   (1)
+*                                OS_OPT_PEND_FLAG_SET_ANY   You will wait for ANY flag  in 'p_flags' to be set   (1)
+*
+*                            You can 'ADD' OS_OPT_PEND_FLAG_CONSUME if you want the flags that made the task ready
+*                            to be 'consumed' by the call, and 'ONE' of the two options:
+*
+*                                OS_OPT_PEND_NON_BLOCKING   Task will NOT block if flags are not available
+*                                OS_OPT_PEND_BLOCKING       Task will     block if flags are not available
+*
+*              p_flags_rdy   is a pointer to where the flags that made the task ready will be stored, all cleared if
+*                            a timeout or an error occurred.  If you pass a NULL pointer (i.e. (OS_FLAGS_WIDE *)0),
+*                            you will not get the flags.
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the event flag group was
+*                            posted, aborted or the event flag group deleted.  If you pass a NULL pointer (i.e. (CPU_TS *)0)
+*                            then you will not get the timestamp.
+*
+*              p_err         is a pointer to an error code and can be:
+*
+*                                OS_ERR_NONE                The desired flags have been set within the specified 'timeout'
+*                                OS_ERR_OBJ_DEL             If the event group was deleted
+*                                OS_ERR_OBJ_PTR_NULL        If 'p_grp' is a NULL pointer.
+*                                OS_ERR_OBJ_TYPE            You are not pointing to a wide event flag group
+*                                OS_ERR_OPT_INVALID         You didn't specify a proper 'opt' argument
+*                                OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT          The wait on the flag was aborted
+*                                OS_ERR_PEND_ISR            If you tried to PEND from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK    If you specified non-blocking but the flags were not
+*                                                           available
+*                                OS_ERR_PTR_INVALID         If 'p_flags' is a NULL pointer
+*                                OS_ERR_SCHED_LOCKED        If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID      If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT             The flags have not been set in the specified 'timeout'
+*                                OS_ERR_TICK_DISABLED       If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : none
+*
+* Note(s)    : 1) This API 'MUST NOT' be called from a timer callback function.
+*
+*              2) While the task waits, its OS_TCB points to the flags it waits for and to the flags that made it ready,
+*                 both held on the task's stack.  OSFlagWidePost() stores the flags that made the task ready there.
+************************************************************************************************************************
+*/
+
+void  OSFlagWidePend (OS_FLAG_WIDE_GRP       *p_grp,
+                      const  OS_FLAGS_WIDE   *p_flags,
+                      OS_TICK                 timeout,
+                      OS_OPT                  opt,
+                      OS_FLAGS_WIDE          *p_flags_rdy,
+                      CPU_TS                 *p_ts,
+                      OS_ERR                 *p_err)
+{
+    OS_FLAGS_WIDE  flags;
+    OS_FLAGS_WIDE  flags_rdy;
+    CPU_BOOLEAN    consume;
+    OS_OPT         mode;
+    CPU_DATA       ix;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    for (ix = 0u; ix < OS_FLAG_WIDE_WORD_QTY; ix++) {           /* Nothing is ready until the wait ends                 */
+        flags_rdy.Word[ix] = 0u;
+    }
+    if (p_flags_rdy != (OS_FLAGS_WIDE *)0) {
+       *p_flags_rdy = flags_rdy;
+    }
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from ISR ...                           */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;                            /* ... can't PEND from an ISR                           */
+            return;
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_FLAG_WIDE_GRP *)0) {                       /* Validate 'p_grp'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_flags == (const OS_FLAGS_WIDE *)0) {                  /* Validate 'p_flags'                                   */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_FLAG_CLR_ALL:
+        case OS_OPT_PEND_FLAG_CLR_ANY:
+        case OS_OPT_PEND_FLAG_SET_ALL:
+        case OS_OPT_PEND_FLAG_SET_ANY:
+        case OS_OPT_PEND_FLAG_CLR_ALL | OS_OPT_PEND_FLAG_CONSUME:
+        case OS_OPT_PEND_FLAG_CLR_ANY | OS_OPT_PEND_FLAG_CONSUME:
+        case OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_FLAG_CONSUME:
+        case OS_OPT_PEND_FLAG_SET_ANY | OS_OPT_PEND_FLAG_CONSUME:
+        case OS_OPT_PEND_FLAG_CLR_ALL | OS_OPT_PEND_NON_BLOCKING:
+        case OS_OPT_PEND_FLAG_CLR_ANY | OS_OPT_PEND_NON_BLOCKING:
+        case OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_NON_BLOCKING:
+        case OS_OPT_PEND_FLAG_SET_ANY | OS_OPT_PEND_NON_BLOCKING:
+        case OS_OPT_PEND_FLAG_CLR_ALL | (OS_OPT)(OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_NON_BLOCKING):
+        case OS_OPT_PEND_FLAG_CLR_ANY | (OS_OPT)(OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_NON_BLOCKING):
+        case OS_OPT_PEND_FLAG_SET_ALL | (OS_OPT)(OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_NON_BLOCKING):
+        case OS_OPT_PEND_FLAG_SET_ANY | (OS_OPT)(OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_NON_BLOCKING):
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_grp->Type != OS_OBJ_TYPE_FLAG_WIDE) {                 /* Validate that we are pointing at a wide event flag   */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    mode = opt & OS_OPT_PEND_FLAG_MASK;
+    switch (mode) {
+        case OS_OPT_PEND_FLAG_SET_ALL:
+        case OS_OPT_PEND_FLAG_SET_ANY:
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+        case OS_OPT_PEND_FLAG_CLR_ALL:
+        case OS_OPT_PEND_FLAG_CLR_ANY:
+#endif
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+
+    if ((opt & OS_OPT_PEND_FLAG_CONSUME) != 0u) {               /* See if we need to consume the flags                  */
+        consume = OS_TRUE;
+    } else {
+        consume = OS_FALSE;
+    }
+
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
+    }
+
+    flags = *p_flags;                                           /* See Note #2                                          */
+
+    CPU_CRITICAL_ENTER();
+    if (OS_FlagWideTest(&p_grp->Flags, &flags, mode) == OS_TRUE) {
+        OS_FlagWideRdyGet(&p_grp->Flags, &flags, mode, &flags_rdy);
+        if (consume == OS_TRUE) {                               /* See if we need to consume the flags                  */
+            OS_FlagWideConsume(p_grp, &flags_rdy, mode);
+        }
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = p_grp->TS;
+        }
+#endif
+        CPU_CRITICAL_EXIT();                                    /* Yes, condition met, return to caller                 */
+        if (p_flags_rdy != (OS_FLAGS_WIDE *)0) {
+           *p_flags_rdy = flags_rdy;
+        }
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* Specified non-blocking so task would block           */
+        return;
+    }
+    if (OSSchedLockNestingCtr > 0u) {                           /* See if called with scheduler locked ...              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_LOCKED;                            /* ... can't PEND when locked                           */
+        return;
+    }
+
+    OSTCBCurPtr->FlagsPend        =  0u;                        /* Save the flags that we need to wait for              */
+    OSTCBCurPtr->FlagsOpt         =  opt;                       /* Save the type of wait we are doing                   */
+    OSTCBCurPtr->FlagsRdy         =  0u;
+    OSTCBCurPtr->FlagsWidePendPtr = &flags;
+    OSTCBCurPtr->FlagsWideRdyPtr  = &flags_rdy;
+    OS_Pend((OS_PEND_OBJ *)((void *)p_grp),
+             OSTCBCurPtr,
+             OS_TASK_PEND_ON_FLAG,
+             timeout);
+    CPU_CRITICAL_EXIT();
+
+    OSSched();                                                  /* Find next HPT ready to run                           */
+
+    CPU_CRITICAL_ENTER();
+    OSTCBCurPtr->FlagsWidePendPtr = (OS_FLAGS_WIDE *)0;
+    OSTCBCurPtr->FlagsWideRdyPtr  = (OS_FLAGS_WIDE *)0;
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* We got the event flags                               */
+             if (consume == OS_TRUE) {                          /* See if we need to consume the flags                  */
+                 OS_FlagWideConsume(p_grp, &flags_rdy, mode);
+             }
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             CPU_CRITICAL_EXIT();
+             if (p_flags_rdy != (OS_FLAGS_WIDE *)0) {
+                *p_flags_rdy = flags_rdy;
+             }
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get the flags within timeout */
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                       ABORT WAITING ON A WIDE EVENT FLAG GROUP
+*
+* Description: This function aborts & readies any tasks currently waiting on a wide event flag group.
+*
+* Arguments  : p_grp     is a pointer to the wide event flag group
+*
+*              opt       determines the type of ABORT performed:
+*
+*                            OS_OPT_PEND_ABORT_1          ABORT wait for a single task (HPT) waiting on the event flag
+*                            OS_OPT_PEND_ABORT_ALL        ABORT wait for ALL tasks that are  waiting on the event flag
+*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                  At least one task waiting on the event flag group and was
+*                                                         readied and informed of the aborted wait
+*                            OS_ERR_OBJ_PTR_NULL          If 'p_grp' is a NULL pointer
+*                            OS_ERR_OBJ_TYPE              If 'p_grp' is not pointing at a wide event flag group
+*                            OS_ERR_OPT_INVALID           If you specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING        If uC/OS-III is not running yet
+*                            OS_ERR_PEND_ABORT_ISR        If you called this function from an ISR
+*                            OS_ERR_PEND_ABORT_NONE       No task were pending
+*
+* Returns    : == 0          if no tasks were waiting on the event flag group, or upon error.
+*              >  0          if one or more tasks waiting on the event flag group are now readied and informed.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY  OSFlagWidePendAbort (OS_FLAG_WIDE_GRP  *p_grp,
+                                 OS_OPT             opt,
+                                 OS_ERR            *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    OS_OBJ_QTY     nbr_tasks;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_OBJ_QTY)0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to Pend Abort from an ISR                */
+       *p_err = OS_ERR_PEND_ABORT_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_FLAG_WIDE_GRP *)0) {                       /* Validate 'p_grp'                                     */
+       *p_err  =  OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_ABORT_1:
+        case OS_OPT_PEND_ABORT_ALL:
+        case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_grp->Type != OS_OBJ_TYPE_FLAG_WIDE) {                 /* Make sure event flag group was created               */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_grp->PendList;
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on flag group?                      */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_PEND_ABORT_NONE;
+        return (0u);
+    }
+
+    nbr_tasks = 0u;
+#if (OS_CFG_TS_EN > 0u)
+    ts        = OS_TS_GET();                                    /* Get local time stamp so all tasks get the same time  */
+#else
+    ts        = 0u;
+#endif
+
+    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
+        p_tcb = p_pend_list->HeadPtr;
+        OS_PendAbort(p_tcb,
+                     ts,
+                     OS_STATUS_PEND_ABORT);
+        nbr_tasks++;
+        if (opt != OS_OPT_PEND_ABORT_ALL) {                     /* Pend abort all tasks waiting?                        */
+            break;                                              /* No                                                   */
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              POST WIDE EVENT FLAGS
+*
+* Description: This function is called to set or clear some flags in a wide event flag group.
+*
+* Arguments  : p_grp         is a pointer to the desired wide event flag group.
+*
+*              p_flags       is a pointer to the flags to set or clear.  Each flag set in 'p_flags' sets or clears the
+*                            corresponding flag in the group, depending on 'opt'.
+*
+*              opt           indicates whether the flags will be:
+*
+*                                OS_OPT_POST_FLAG_SET       set
+*                                OS_OPT_POST_FLAG_CLR       cleared
+*
+*                            you can also 'add' OS_OPT_POST_NO_SCHED to prevent the scheduler from being called.
+*
+*              p_flags_cur   is a pointer to where the flags of the group are stored once posted.  If you pass a NULL
+*                            pointer (i.e. (OS_FLAGS_WIDE *)0), you will not get the flags.
+*
+*              p_err         is a pointer to an error code and can be:
+*
+*                                OS_ERR_NONE                The call was successful
+*                                OS_ERR_OBJ_PTR_NULL        You passed a NULL pointer
+*                                OS_ERR_OBJ_TYPE            You are not pointing to a wide event flag group
+*                                OS_ERR_OPT_INVALID         You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                                OS_ERR_PTR_INVALID         If 'p_flags' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : 1) The execution time of this function depends on the number of tasks waiting on the event flag group.
+*
+*              2) Posts from ISRs are processed in the ISR, even when OS_CFG_ISR_POST_DEFERRED_EN defers the posts to
+*                 the other kernel objects.  An entry of the ISR queue only holds the flags of an OS_FLAG_GRP.
+************************************************************************************************************************
+*/
+
+void  OSFlagWidePost (OS_FLAG_WIDE_GRP       *p_grp,
+                      const  OS_FLAGS_WIDE   *p_flags,
+                      OS_OPT                  opt,
+                      OS_FLAGS_WIDE          *p_flags_cur,
+                      OS_ERR                 *p_err)
+{
+    OS_OPT         mode;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    OS_TCB        *p_tcb_next;
+    CPU_TS         ts;
+    CPU_DATA       ix;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_FLAG_WIDE_GRP *)0) {                       /* Validate 'p_grp'                                     */
+       *p_err  = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_flags == (const OS_FLAGS_WIDE *)0) {                  /* Validate 'p_flags'                                   */
+       *p_err  = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_grp->Type != OS_OBJ_TYPE_FLAG_WIDE) {                 /* Make sure we are pointing to a wide event flag grp   */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    switch (opt) {
+        case OS_OPT_POST_FLAG_SET:
+        case OS_OPT_POST_FLAG_SET | OS_OPT_POST_NO_SCHED:
+             CPU_CRITICAL_ENTER();
+             for (ix = 0u; ix < OS_FLAG_WIDE_WORD_QTY; ix++) {  /* Set   the flags specified in the group               */
+                 p_grp->Flags.Word[ix] |=  p_flags->Word[ix];
+             }
+             break;
+
+        case OS_OPT_POST_FLAG_CLR:
+        case OS_OPT_POST_FLAG_CLR | OS_OPT_POST_NO_SCHED:
+             CPU_CRITICAL_ENTER();
+             for (ix = 0u; ix < OS_FLAG_WIDE_WORD_QTY; ix++) {  /* Clear the flags specified in the group               */
+                 p_grp->Flags.Word[ix] &= ~p_flags->Word[ix];
+             }
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;                        /* INVALID option                                       */
+             return;
+    }
+#if (OS_CFG_TS_EN > 0u)
+    p_grp->TS   = ts;
+#endif
+    p_pend_list = &p_grp->PendList;
+    p_tcb       = p_pend_list->HeadPtr;
+    while (p_tcb != (OS_TCB *)0) {                              /* Go through all tasks waiting on event flag(s)        */
+        p_tcb_next = p_tcb->PendNextPtr;
+        mode       = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK;
+        if (OS_FlagWideTest(&p_grp->Flags, p_tcb->FlagsWidePendPtr, mode) == OS_TRUE) {
+            OS_FlagWideRdyGet(&p_grp->Flags,                    /* See OSFlagWidePend(), Note #2                        */
+                               p_tcb->FlagsWidePendPtr,
+                               mode,
+                               p_tcb->FlagsWideRdyPtr);
+            OS_FlagTaskRdy(p_tcb,                               /* Make task RTR, event(s) Rx'd                         */
+                           0u,
+                           ts);
+        }
+        p_tcb = p_tcb_next;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();
+    }
+
+    if (p_flags_cur != (OS_FLAGS_WIDE *)0) {
+        CPU_CRITICAL_ENTER();
+       *p_flags_cur = p_grp->Flags;
+        CPU_CRITICAL_EXIT();
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                  CLEAR THE CONTENTS OF A WIDE EVENT FLAG GROUP
+*
+* Description: This function is called by OSFlagWideDel() to clear the contents of a wide event flag group
+*
+* Argument(s): p_grp     is a pointer to the wide event flag group to clear
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_FlagWideClr (OS_FLAG_WIDE_GRP  *p_grp)
+{
+    OS_PEND_LIST  *p_pend_list;
+    CPU_DATA       ix;
+
+
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_grp->Type             = OS_OBJ_TYPE_NONE;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_grp->NamePtr          = (CPU_CHAR *)((void *)"?FLAG");    /* Unknown name                                         */
+#endif
+    for (ix = 0u; ix < OS_FLAG_WIDE_WORD_QTY; ix++) {
+        p_grp->Flags.Word[ix] = 0u;
+    }
+    p_pend_list             = &p_grp->PendList;
+    OS_PendListInit(p_pend_list);
+}
+
+
+/*
+************************************************************************************************************************
+*                                 ADD/REMOVE WIDE EVENT FLAG GROUP TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a wide event flag group from the wide event
+*              flag debug list.
+*
+* Arguments  : p_grp     is a pointer to the wide event flag group to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_FlagWideDbgListAdd (OS_FLAG_WIDE_GRP  *p_grp)
+{
+    p_grp->DbgNamePtr                    = (CPU_CHAR *)((void *)" ");
+    p_grp->DbgPrevPtr                    = (OS_FLAG_WIDE_GRP *)0;
+    if (OSFlagWideDbgListPtr == (OS_FLAG_WIDE_GRP *)0) {
+        p_grp->DbgNextPtr                = (OS_FLAG_WIDE_GRP *)0;
+    } else {
+        p_grp->DbgNextPtr                = OSFlagWideDbgListPtr;
+        OSFlagWideDbgListPtr->DbgPrevPtr = p_grp;
+    }
+    OSFlagWideDbgListPtr                 = p_grp;
+}
+
+
+void  OS_FlagWideDbgListRemove (OS_FLAG_WIDE_GRP  *p_grp)
+{
+    OS_FLAG_WIDE_GRP  *p_grp_next;
+    OS_FLAG_WIDE_GRP  *p_grp_prev;
+
+
+    p_grp_prev = p_grp->DbgPrevPtr;
+    p_grp_next = p_grp->DbgNextPtr;
+
+    if (p_grp_prev == (OS_FLAG_WIDE_GRP *)0) {
+        OSFlagWideDbgListPtr = p_grp_next;
+        if (p_grp_next != (OS_FLAG_WIDE_GRP *)0) {
+            p_grp_next->DbgPrevPtr = (OS_FLAG_WIDE_GRP *)0;
+        }
+        p_grp->DbgNextPtr = (OS_FLAG_WIDE_GRP *)0;
+
+    } else if (p_grp_next == (OS_FLAG_WIDE_GRP *)0) {
+        p_grp_prev->DbgNextPtr = (OS_FLAG_WIDE_GRP *)0;
+        p_grp->DbgPrevPtr      = (OS_FLAG_WIDE_GRP *)0;
+
+    } else {
+        p_grp_prev->DbgNextPtr =  p_grp_next;
+        p_grp_next->DbgPrevPtr =  p_grp_prev;
+        p_grp->DbgNextPtr      = (OS_FLAG_WIDE_GRP *)0;
+        p_grp->DbgPrevPtr      = (OS_FLAG_WIDE_GRP *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              MATCH WIDE EVENT FLAGS
+*
+* Description: OS_FlagWideTest() tells whether the flags of a group satisfy a wait.  OS_FlagWideRdyGet() then computes
+*              the flags that made the wait satisfied, and OS_FlagWideConsume() consumes them from the group.
+*
+* Arguments  : p_grp_flags   is a pointer to the flags of the group
+*
+*              p_grp         is a pointer to the group to consume the flags from
+*
+*              p_flags       is a pointer to the flags waited for
+*
+*              mode          is the type of wait, OS_OPT_PEND_FLAG_xxx_ALL or OS_OPT_PEND_FLAG_xxx_ANY
+*
+*              p_flags_rdy   is a pointer to the flags that made, or make, the wait satisfied
+*
+* Returns    : OS_FlagWideTest() returns OS_TRUE if the wait is satisfied, OS_FALSE otherwise.
+*
+* Note(s)    : 1) The group's flags are inverted when waiting for flags to be cleared, so that each word is matched the
+*                 same way, without branching, whatever the type of wait.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_FlagWideTest (const  OS_FLAGS_WIDE  *p_grp_flags,
+                                      const  OS_FLAGS_WIDE  *p_flags,
+                                             OS_OPT          mode)
+{
+    CPU_DATA  inv;
+    CPU_DATA  rdy;
+    CPU_DATA  rdy_any;
+    CPU_DATA  rdy_miss;
+    CPU_DATA  ix;
+
+
+    if ((mode == OS_OPT_PEND_FLAG_CLR_ALL) ||                   /* See Note #1                                          */
+        (mode == OS_OPT_PEND_FLAG_CLR_ANY)) {
+        inv = (CPU_DATA)~(CPU_DATA)0u;
+    } else {
+        inv = 0u;
+    }
+
+    rdy_any  = 0u;
+    rdy_miss = 0u;
+    for (ix = 0u; ix < OS_FLAG_WIDE_WORD_QTY; ix++) {
+        rdy       = (p_grp_flags->Word[ix] ^ inv) & p_flags->Word[ix];
+        rdy_any  |=  rdy;                                       /* Any flag waited for is ready                         */
+        rdy_miss |=  rdy ^ p_flags->Word[ix];                   /* Any flag waited for is not ready                     */
+    }
+
+    switch (mode) {
+        case OS_OPT_PEND_FLAG_SET_ALL:
+        case OS_OPT_PEND_FLAG_CLR_ALL:
+             return ((rdy_miss == 0u) ? OS_TRUE : OS_FALSE);
+
+        case OS_OPT_PEND_FLAG_SET_ANY:
+        case OS_OPT_PEND_FLAG_CLR_ANY:
+             return ((rdy_any  != 0u) ? OS_TRUE : OS_FALSE);
+
+        default:
+             return (OS_FALSE);
+    }
+}
+
+
+static  void  OS_FlagWideRdyGet (const  OS_FLAGS_WIDE  *p_grp_flags,
+                                 const  OS_FLAGS_WIDE  *p_flags,
+                                        OS_OPT          mode,
+                                        OS_FLAGS_WIDE  *p_flags_rdy)
+{
+    CPU_DATA  inv;
+    CPU_DATA  ix;
+
+
+    if ((mode == OS_OPT_PEND_FLAG_CLR_ALL) ||                   /* See Note #1                                          */
+        (mode == OS_OPT_PEND_FLAG_CLR_ANY)) {
+        inv = (CPU_DATA)~(CPU_DATA)0u;
+    } else {
+        inv = 0u;
+    }
+
+    for (ix = 0u; ix < OS_FLAG_WIDE_WORD_QTY; ix++) {
+        p_flags_rdy->Word[ix] = (p_grp_flags->Word[ix] ^ inv) & p_flags->Word[ix];
+    }
+}
+
+
+static  void  OS_FlagWideConsume (       OS_FLAG_WIDE_GRP  *p_grp,
+                                  const  OS_FLAGS_WIDE     *p_flags_rdy,
+                                         OS_OPT             mode)
+{
+    CPU_DATA  ix;
+
+
+    if ((mode == OS_OPT_PEND_FLAG_CLR_ALL) ||
+        (mode == OS_OPT_PEND_FLAG_CLR_ANY)) {
+        for (ix = 0u; ix < OS_FLAG_WIDE_WORD_QTY; ix++) {       /* Set   ONLY the flags we got                          */
+            p_grp->Flags.Word[ix] |=  p_flags_rdy->Word[ix];
+        }
+    } else {
+        for (ix = 0u; ix < OS_FLAG_WIDE_WORD_QTY; ix++) {       /* Clear ONLY the flags we got                          */
+            p_grp->Flags.Word[ix] &= ~p_flags_rdy->Word[ix];
+        }
+    }
+}
+#endif
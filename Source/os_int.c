@@ -0,0 +1,416 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       DEFERRED ISR POST MANAGEMENT
+*
+* File    : os_int.c
+* Version : V3.08.02
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_int__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_INT_Q  *OS_IntQEntryGet (void);
+
+static  void       OS_IntQRePost   (OS_INT_Q  *p_entry);
+
+
+/*
+************************************************************************************************************************
+*                                                 DEFER A POST FROM AN ISR
+*
+* Description: This function is called by the post services when they are called from an ISR.  Instead of walking the
+*              pend list and readying the tasks waiting on the object, the post is copied in the ISR queue and the ISR
+*              handler task is made ready to run.  The task replays the post once the ISRs have completed.
+*
+* Arguments  : type          is the type of object posted to:
+*
+*                                OS_OBJ_TYPE_FLAG           OSFlagPost()
+*                                OS_OBJ_TYPE_Q              OSQPost()
+*                                OS_OBJ_TYPE_SEM            OSSemPost()
+*                                OS_OBJ_TYPE_TASK_MSG       OSTaskQPost()
+*                                OS_OBJ_TYPE_TASK_SIGNAL    OSTaskSemPost()
+*
+*              p_obj         is a pointer to the object posted to, or to the OS_TCB of the task posted to
+*
+*              p_void        is the message posted, for queues
+*
+*              msg_size      is the size of the message posted, for queues
+*
+*              flags         are the flags posted, for event flag groups
+*
+*              opt           are the options passed to the post service
+*
+*              ts            is the time stamp of the post
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE         if the post was deferred
+*                                OS_ERR_INT_Q_FULL   if the ISR queue is full, the post is lost
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Interrupts are disabled to reserve and fill one entry of the queue and to make the ISR handler task
+*                 ready to run.  The ISR handler task is the only task at priority 0, so this is done in constant
+*                 time, whatever the number of tasks waiting on the object.
+*
+*              3) The ISRs no longer access the kernel objects, the post services thus protect them by locking the
+*                 scheduler, see OS_CRITICAL_ENTER().  Interrupts are only disabled to update the ready list and the
+*                 tick list, one task at a time.
+************************************************************************************************************************
+*/
+
+void  OS_IntQPost (OS_OBJ_TYPE   type,
+                   void         *p_obj,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_FLAGS      flags,
+                   OS_OPT        opt,
+                   CPU_TS        ts,
+                   OS_ERR       *p_err)
+{
+    OS_INT_Q  *p_entry;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_entry = OS_IntQEntryGet();                                /* See Note #2                                          */
+    if (p_entry == (OS_INT_Q *)0) {                             /* Make sure the queue is not full                      */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_INT_Q_FULL;
+        return;
+    }
+    p_entry->Type    = type;
+    p_entry->ObjPtr  = p_obj;
+    p_entry->MsgPtr  = p_void;
+    p_entry->MsgSize = msg_size;
+    p_entry->Flags   = flags;
+    p_entry->Opt     = opt;
+    p_entry->TS      = ts;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 DEFER THE SYSTEM TICK
+*
+* Description: This function is called by OSTimeTick() and OSTimeDynTick() to have the ISR handler task process the
+*              ticks, in order with the posts deferred by the ISRs.
+*
+* Arguments  : ticks         is the number of ticks elapsed
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The ticks are charged to the task that was running when they occurred, which is saved in the entry.
+*
+*              3) The ticks are lost, and counted in OSIntQOvfCtr, if the ISR queue is full.
+************************************************************************************************************************
+*/
+
+void  OS_IntQTickPost (OS_TICK  ticks)
+{
+    OS_INT_Q  *p_entry;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_entry = OS_IntQEntryGet();
+    if (p_entry != (OS_INT_Q *)0) {                             /* See Note #3                                          */
+        p_entry->Type   = OS_OBJ_TYPE_TICK;
+        p_entry->ObjPtr = (void *)OSTCBCurPtr;                  /* See Note #2                                          */
+        p_entry->Ticks  = ticks;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 ISR HANDLER TASK
+*
+* Description: This task is created by OS_IntQTaskInit().  It replays, in order, the posts and the ticks deferred by
+*              the ISRs and then runs the scheduler once the ISR queue is empty.
+*
+* Arguments  : p_arg     is an argument passed to the task when the task is created (unused).
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) An entry is only released once it has been replayed, so that the ISRs never overwrite it.
+*
+*              3) The task removes itself from the ready list when the queue is empty and OS_IntQPost() puts it back.
+************************************************************************************************************************
+*/
+
+void  OS_IntQTask (void  *p_arg)
+{
+    OS_INT_Q  *p_entry;
+    CPU_SR_ALLOC();
+
+
+    (void)p_arg;                                                /* Prevent compiler warning for not using 'p_arg'       */
+
+    for (;;) {
+        CPU_CRITICAL_ENTER();
+        if (OSIntQNbrEntries == 0u) {                           /* Sleep until an ISR defers a post, see Note #3        */
+            OSIntQTaskRdy = OS_FALSE;
+            OS_RdyListRemove(&OSIntQTaskTCB);
+            CPU_CRITICAL_EXIT();
+            OSSched();                                          /* Run the tasks readied by the replayed posts          */
+        } else {
+            p_entry = &OSCfg_IntQBasePtr[OSIntQOutIx];
+            CPU_CRITICAL_EXIT();
+
+            OS_IntQRePost(p_entry);
+
+            CPU_CRITICAL_ENTER();                               /* Release the entry, see Note #2                       */
+            OSIntQOutIx++;
+            if (OSIntQOutIx >= OSCfg_IntQSize) {
+                OSIntQOutIx = 0u;
+            }
+            OSIntQNbrEntries--;
+            CPU_CRITICAL_EXIT();
+        }
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                          INITIALIZE THE ISR HANDLER TASK
+*
+* Description: This function is called by OSInit() to create the ISR handler task and to empty the ISR queue.
+*
+* Arguments  : p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE
+*                            OS_ERR_INT_Q_SIZE               if the ISR queue holds less than 2 entries
+*                            OS_ERR_INT_Q_STK_INVALID        if you didn't specify a stack for the ISR handler task
+*                            OS_ERR_INT_Q_STK_SIZE_INVALID   if you didn't allocate enough space for the stack
+*                            OS_ERR_xxx                      any error code returned by OSTaskCreate()
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The ISR handler task runs at priority 0, which is reserved for it.
+************************************************************************************************************************
+*/
+
+void  OS_IntQTaskInit (OS_ERR  *p_err)
+{
+    OSIntQInIx          = 0u;
+    OSIntQOutIx         = 0u;
+    OSIntQNbrEntries    = 0u;
+    OSIntQNbrEntriesMax = 0u;
+    OSIntQOvfCtr        = 0u;
+#if (OS_CFG_TS_EN > 0u)
+    OSIntQTaskTS        = 0u;
+#endif
+
+    if (OSCfg_IntQSize < 2u) {
+       *p_err = OS_ERR_INT_Q_SIZE;
+        return;
+    }
+
+    if (OSCfg_IntQTaskStkBasePtr == (CPU_STK *)0) {
+       *p_err = OS_ERR_INT_Q_STK_INVALID;
+        return;
+    }
+
+    if (OSCfg_IntQTaskStkSize < OSCfg_StkSizeMin) {
+       *p_err = OS_ERR_INT_Q_STK_SIZE_INVALID;
+        return;
+    }
+
+    OSIntQTaskRdy = OS_TRUE;                                    /* The task is ready once created                       */
+    OSTaskCreate(&OSIntQTaskTCB,
+#if  (OS_CFG_DBG_EN == 0u)
+                 (CPU_CHAR *)0,
+#else
+                 (CPU_CHAR *)"uC/OS-III ISR Queue Task",
+#endif
+                  OS_IntQTask,
+                 (void     *)0,
+                 (OS_PRIO   )0u,                                /* See Note #2                                          */
+                  OSCfg_IntQTaskStkBasePtr,
+                  OSCfg_IntQTaskStkLimit,
+                  OSCfg_IntQTaskStkSize,
+                  0u,
+                  0u,
+                 (void     *)0,
+                 (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS)),
+                  p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                               REPLAY A DEFERRED POST
+*
+* Description: This function calls the post service for an entry of the ISR queue, or processes the deferred ticks.
+*
+* Arguments  : p_entry   is a pointer to the entry to replay
+*
+* Returns    : none
+*
+* Note(s)    : 1) The scheduler is not run after each post, OS_IntQTask() runs it once the queue is empty.
+*
+*              2) The post services use the time stamp taken in the ISR when called from the ISR handler task.
+*
+*              3) There is no one to report an error to, so errors detected by the post services are ignored.
+*
+*              4) The ticks are processed as OSTimeTick() does, for the task that was running when they occurred.
+************************************************************************************************************************
+*/
+
+static  void  OS_IntQRePost (OS_INT_Q  *p_entry)
+{
+    OS_TCB  *p_tcb;
+    OS_OPT   opt;
+    OS_ERR   err;
+
+
+    opt = p_entry->Opt | OS_OPT_POST_NO_SCHED;                  /* See Note #1                                          */
+#if (OS_CFG_TS_EN > 0u)
+    OSIntQTaskTS = p_entry->TS;                                 /* See Note #2                                          */
+#endif
+    switch (p_entry->Type) {                                    /* See Note #3                                          */
+#if (OS_CFG_FLAG_EN > 0u)
+        case OS_OBJ_TYPE_FLAG:
+             (void)OSFlagPost((OS_FLAG_GRP *)p_entry->ObjPtr,
+                               p_entry->Flags,
+                               opt,
+                              &err);
+             break;
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+        case OS_OBJ_TYPE_Q:
+             OSQPost((OS_Q *)p_entry->ObjPtr,
+                      p_entry->MsgPtr,
+                      p_entry->MsgSize,
+                      opt,
+                     &err);
+             break;
+#endif
+
+#if (OS_CFG_SEM_EN > 0u)
+        case OS_OBJ_TYPE_SEM:
+             (void)OSSemPost((OS_SEM *)p_entry->ObjPtr,
+                              opt,
+                             &err);
+             break;
+#endif
+
+#if (OS_CFG_TASK_Q_EN > 0u)
+        case OS_OBJ_TYPE_TASK_MSG:
+             OSTaskQPost((OS_TCB *)p_entry->ObjPtr,
+                          p_entry->MsgPtr,
+                          p_entry->MsgSize,
+                          opt,
+                         &err);
+             break;
+#endif
+
+        case OS_OBJ_TYPE_TASK_SIGNAL:
+             (void)OSTaskSemPost((OS_TCB *)p_entry->ObjPtr,
+                                  opt,
+                                 &err);
+             break;
+
+        case OS_OBJ_TYPE_TICK:                                  /* See Note #4                                          */
+             p_tcb = (OS_TCB *)p_entry->ObjPtr;
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+             OS_SchedRoundRobin(&OSRdyList[p_tcb->Prio], p_entry->Ticks);
+#endif
+#if (OS_CFG_TICK_EN > 0u)
+             OS_TickUpdate(p_entry->Ticks);
+#endif
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+             OS_TaskBudgetTick(p_tcb);
+#endif
+             (void)p_tcb;
+             break;
+
+        default:
+             break;
+    }
+    (void)err;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              GET A FREE ISR QUEUE ENTRY
+*
+* Description: This function reserves the next free entry of the ISR queue and makes the ISR handler task ready to run.
+*
+* Arguments  : none
+*
+* Returns    : A pointer to the entry to fill, or a NULL pointer if the queue is full.
+*
+* Note(s)    : 1) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  OS_INT_Q  *OS_IntQEntryGet (void)
+{
+    OS_INT_Q  *p_entry;
+
+
+    if (OSIntQNbrEntries >= OSCfg_IntQSize) {
+        OSIntQOvfCtr++;
+        return ((OS_INT_Q *)0);
+    }
+    p_entry = &OSCfg_IntQBasePtr[OSIntQInIx];
+    OSIntQInIx++;
+    if (OSIntQInIx >= OSCfg_IntQSize) {                         /* Wrap around                                          */
+        OSIntQInIx = 0u;
+    }
+    OSIntQNbrEntries++;
+    if (OSIntQNbrEntriesMax < OSIntQNbrEntries) {
+        OSIntQNbrEntriesMax = OSIntQNbrEntries;
+    }
+    if (OSIntQTaskRdy == OS_FALSE) {                            /* Wake up the ISR handler task                         */
+        OSIntQTaskRdy = OS_TRUE;
+        OS_RdyListInsert(&OSIntQTaskTCB);
+    }
+    return (p_entry);
+}
+#endif
@@ -338,6 +338,294 @@ void  OSMemPut (OS_MEM  *p_mem,
 }
 
 
+/*
+************************************************************************************************************************
+*                                                 GET A MEMORY BUFFER
+*
+* Description : Get a memory block from a partition and set it up as a memory buffer.  The buffer descriptor is kept at
+*               the start of the block and its data follows, so the data can be passed to several consumers without
+*               being copied.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               If the memory buffer was taken from the partition
+*                            OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_mem'
+*                            OS_ERR_MEM_INVALID_SIZE   If the blocks of the partition cannot hold a descriptor and data
+*                            OS_ERR_MEM_NO_FREE_BLKS   If there are no more free memory blocks to allocate to the caller
+*                            OS_ERR_OBJ_TYPE           If 'p_mem' is not pointing at a memory partition
+*
+* Returns     : A pointer to the memory buffer if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : 1) The memory buffer is returned with one reference, held by the caller, and an empty data area of
+*                  .DataSize bytes at .DataPtr.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_BUF_EN > 0u)
+OS_MEM_BUF  *OSMemBufGet (OS_MEM  *p_mem,
+                          OS_ERR  *p_err)
+{
+    OS_MEM_BUF  *p_buf;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_MEM_BUF *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mem == (OS_MEM *)0) {                                 /* Must point to a valid memory partition               */
+       *p_err  = OS_ERR_MEM_INVALID_P_MEM;
+        return ((OS_MEM_BUF *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the memory partition was created           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((OS_MEM_BUF *)0);
+    }
+#endif
+
+    if (p_mem->BlkSize <= sizeof(OS_MEM_BUF)) {                 /* Blocks must hold the descriptor and some data        */
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return ((OS_MEM_BUF *)0);
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (p_mem->NbrFree == 0u) {                                 /* See if there are any free memory blocks              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_NO_FREE_BLKS;
+        return ((OS_MEM_BUF *)0);
+    }
+    p_buf              = (OS_MEM_BUF *)p_mem->FreeListPtr;      /* Yes, take the next free memory block                 */
+    p_mem->FreeListPtr = *(void **)p_buf;
+    p_mem->NbrFree--;
+    CPU_CRITICAL_EXIT();
+
+    p_buf->MemPtr      =  p_mem;                                /* The block is now only known to the caller            */
+    p_buf->NextPtr     = (OS_MEM_BUF *)0;
+    p_buf->DataPtr     = (CPU_INT08U *)p_buf + sizeof(OS_MEM_BUF);
+    p_buf->DataSize    = (OS_MEM_SIZE)(p_mem->BlkSize - sizeof(OS_MEM_BUF));
+    p_buf->DataLen     =  0u;
+    p_buf->RefCtr      =  1u;
+   *p_err              =  OS_ERR_NONE;
+    return (p_buf);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                CHAIN MEMORY BUFFERS
+*
+* Description : Append a memory buffer, and the buffers chained to it, at the end of the chain of another memory buffer.
+*               This is used to gather data spread over blocks of one or more partitions into a single buffer.
+*
+* Arguments   : p_buf    is a pointer to the first memory buffer of the chain
+*
+*               p_next   is a pointer to the memory buffer to append
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               If 'p_next' was appended to the chain
+*                            OS_ERR_MEM_INVALID_P_BLK  If you passed a NULL pointer for 'p_buf' or 'p_next', or if
+*                                                      'p_next' is already part of the chain
+*
+* Returns     : none
+*
+* Note(s)     : 1) The reference the caller holds on 'p_next' passes to the chain: 'p_next' is released when the buffer
+*                  before it in the chain returns to its partition.
+*
+*               2) Buffers should be chained before the chain is shared with other tasks or ISRs.
+************************************************************************************************************************
+*/
+
+void  OSMemBufChain (OS_MEM_BUF  *p_buf,
+                     OS_MEM_BUF  *p_next,
+                     OS_ERR      *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((p_buf  == (OS_MEM_BUF *)0) ||                          /* Must chain valid buffers                             */
+        (p_next == (OS_MEM_BUF *)0)) {
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+#endif
+
+    for (;;) {                                                  /* Find the end of the chain                            */
+        if (p_buf == p_next) {                                  /* Don't loop the chain on itself                       */
+           *p_err = OS_ERR_MEM_INVALID_P_BLK;
+            return;
+        }
+        if (p_buf->NextPtr == (OS_MEM_BUF *)0) {
+            break;
+        }
+        p_buf = p_buf->NextPtr;
+    }
+    p_buf->NextPtr = p_next;
+   *p_err          = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          ADD REFERENCES TO A MEMORY BUFFER
+*
+* Description : Add references to a memory buffer, typically one per additional consumer before posting the buffer to
+*               several message queues.
+*
+* Arguments   : p_buf    is a pointer to the memory buffer
+*
+*               qty      is the number of references to add
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               If the references were added
+*                            OS_ERR_MEM_BUF_REF_OVF    If the reference counter would overflow
+*                            OS_ERR_MEM_INVALID_P_BLK  If you passed a NULL pointer for 'p_buf' or if the buffer was
+*                                                      already released
+*
+* Returns     : none
+*
+* Note(s)     : 1) The caller MUST hold a reference to the memory buffer.  Each reference is dropped by a call to
+*                  OSMemBufRelease().
+*
+*               2) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSMemBufRefAdd (OS_MEM_BUF  *p_buf,
+                      OS_OBJ_QTY   qty,
+                      OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_buf == (OS_MEM_BUF *)0) {                             /* Must reference a valid buffer                        */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_buf->RefCtr == 0u) {                                  /* Buffer already returned to its partition?            */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+    if (qty > ((OS_OBJ_QTY)~(OS_OBJ_QTY)0 - p_buf->RefCtr)) {   /* Prevent overflowing the reference counter            */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_BUF_REF_OVF;
+        return;
+    }
+    p_buf->RefCtr += qty;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              RELEASE A MEMORY BUFFER
+*
+* Description : Drop a reference to a memory buffer.  When the last reference is dropped, the buffer returns to its
+*               partition and drops the reference it holds on the next buffer of its chain, and so on.
+*
+* Arguments   : p_buf    is a pointer to the memory buffer
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               If the reference was dropped
+*                            OS_ERR_MEM_FULL           If a buffer of the chain returns to an already FULL partition
+*                            OS_ERR_MEM_INVALID_P_BLK  If you passed a NULL pointer for 'p_buf' or if a buffer of the
+*                                                      chain was already released
+*
+* Returns     : none
+*
+* Note(s)     : 1) The whole chain is handled in a single critical section, so interrupts stay disabled for as many
+*                  buffers as are returned to their partitions.
+*
+*               2) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSMemBufRelease (OS_MEM_BUF  *p_buf,
+                       OS_ERR      *p_err)
+{
+    OS_MEM      *p_mem;
+    OS_MEM_BUF  *p_next;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_buf == (OS_MEM_BUF *)0) {                             /* Must release a valid buffer                          */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+#endif
+
+   *p_err = OS_ERR_NONE;
+    CPU_CRITICAL_ENTER();
+    while (p_buf != (OS_MEM_BUF *)0) {
+        if (p_buf->RefCtr == 0u) {                              /* Buffer already returned to its partition?            */
+           *p_err = OS_ERR_MEM_INVALID_P_BLK;
+            break;
+        }
+        p_buf->RefCtr--;
+        if (p_buf->RefCtr > 0u) {                               /* Still referenced, the rest of the chain stays too    */
+            break;
+        }
+        p_mem = p_buf->MemPtr;
+        if (p_mem->NbrFree >= p_mem->NbrMax) {                  /* Make sure all blocks not already returned            */
+           *p_err = OS_ERR_MEM_FULL;
+            break;
+        }
+        p_next             = p_buf->NextPtr;
+       *(void **)p_buf     = p_mem->FreeListPtr;                /* Insert released block into free block list           */
+        p_mem->FreeListPtr = p_buf;
+        p_mem->NbrFree++;
+        p_buf              = p_next;                            /* Drop the reference held on the next buffer           */
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                           ADD MEMORY PARTITION TO DEBUG LIST
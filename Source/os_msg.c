@@ -113,6 +113,8 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
 * Returns    : the number of OS_MSGs returned to the free list
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A ring message queue is only emptied since its OS_MSGs do not come from the free list.
 ************************************************************************************************************************
 */
 
@@ -124,6 +126,17 @@ OS_MSG_QTY  OS_MsgQFreeAll (OS_MSG_Q  *p_msg_q)
 
 
     qty = p_msg_q->NbrEntries;                                  /* Get the number of OS_MSGs being freed                */
+#if (OS_CFG_Q_RING_EN > 0u)
+    if (p_msg_q->RingPtr != (OS_MSG *)0) {                      /* A ring owns its OS_MSGs, nothing to return           */
+        p_msg_q->NbrEntries     = 0u;
+#if (OS_CFG_DBG_EN > 0u)
+        p_msg_q->NbrEntriesMax  = 0u;
+#endif
+        p_msg_q->InPtr          = p_msg_q->RingPtr;
+        p_msg_q->OutPtr         = p_msg_q->RingPtr;
+        return (qty);
+    }
+#endif
     if (p_msg_q->NbrEntries > 0u) {
         p_msg                   = p_msg_q->InPtr;               /* Point to end of message chain                        */
         p_msg->NextPtr          = OSMsgPool.NextPtr;
@@ -168,7 +181,43 @@ void  OS_MsgQInit (OS_MSG_Q    *p_msg_q,
 #endif
     p_msg_q->InPtr          = (OS_MSG *)0;
     p_msg_q->OutPtr         = (OS_MSG *)0;
+#if (OS_CFG_Q_RING_EN > 0u)
+    p_msg_q->RingPtr        = (OS_MSG *)0;
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                           INITIALIZE A RING MESSAGE QUEUE
+*
+* Description: This function is called to initialize a message queue which stores its messages in a ring of OS_MSGs
+*              supplied by the caller instead of the OS_MSG pool.
+*
+* Arguments  : p_msg_q      is a pointer to the message queue to initialize
+*              -------
+*
+*              p_ring       is a pointer to an array of 'size' OS_MSGs
+*
+*              size         is the maximum number of entries that the message queue can have.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_RING_EN > 0u)
+void  OS_MsgQRingInit (OS_MSG_Q    *p_msg_q,
+                       OS_MSG      *p_ring,
+                       OS_MSG_QTY   size)
+{
+    OS_MsgQInit(p_msg_q, size);
+    p_msg_q->RingPtr        = p_ring;
+    p_msg_q->InPtr          = p_ring;                           /* Next slot to write                                   */
+    p_msg_q->OutPtr         = p_ring;                           /* Next slot to read                                    */
 }
+#endif
 
 
 /*
@@ -192,6 +241,8 @@ void  OS_MsgQInit (OS_MSG_Q    *p_msg_q,
 * Returns    : The message (a pointer)
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A ring message queue is read at .OutPtr, which then moves to the next slot of the ring.
 ************************************************************************************************************************
 */
 
@@ -228,6 +279,19 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
     }
 #endif
 
+#if (OS_CFG_Q_RING_EN > 0u)
+    if (p_msg_q->RingPtr != (OS_MSG *)0) {                      /* Ring, advance to the next slot                       */
+        p_msg++;
+        if (p_msg == &p_msg_q->RingPtr[p_msg_q->NbrEntriesSize]) {
+            p_msg = p_msg_q->RingPtr;                           /* Wrap around                                          */
+        }
+        p_msg_q->OutPtr = p_msg;
+        p_msg_q->NbrEntries--;
+       *p_err           = OS_ERR_NONE;
+        return (p_void);
+    }
+#endif
+
     p_msg_q->OutPtr = p_msg->NextPtr;                           /* Point to next message to extract                     */
 
     if (p_msg_q->OutPtr == (OS_MSG *)0) {                       /* Are there any more messages in the queue?            */
@@ -276,6 +340,9 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A ring message queue writes FIFO messages at .InPtr and LIFO messages just before .OutPtr, without
+*                 taking an OS_MSG from the free list.
 ************************************************************************************************************************
 */
 
@@ -299,6 +366,39 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
         return;
     }
 
+#if (OS_CFG_Q_RING_EN > 0u)
+    if (p_msg_q->RingPtr != (OS_MSG *)0) {                      /* Ring, see Note #2                                    */
+        if ((opt & OS_OPT_POST_LIFO) == OS_OPT_POST_FIFO) {
+            p_msg = p_msg_q->InPtr;                             /* FIFO, write at .InPtr and advance it                 */
+            p_msg_in = p_msg + 1u;
+            if (p_msg_in == &p_msg_q->RingPtr[p_msg_q->NbrEntriesSize]) {
+                p_msg_in = p_msg_q->RingPtr;                    /* Wrap around                                          */
+            }
+            p_msg_q->InPtr  = p_msg_in;
+        } else {
+            p_msg = p_msg_q->OutPtr;                            /* LIFO, move .OutPtr back and write there              */
+            if (p_msg == p_msg_q->RingPtr) {
+                p_msg = &p_msg_q->RingPtr[p_msg_q->NbrEntriesSize];
+            }
+            p_msg--;
+            p_msg_q->OutPtr = p_msg;
+        }
+        p_msg_q->NbrEntries++;
+#if (OS_CFG_DBG_EN > 0u)
+        if (p_msg_q->NbrEntriesMax < p_msg_q->NbrEntries) {
+            p_msg_q->NbrEntriesMax = p_msg_q->NbrEntries;
+        }
+#endif
+        p_msg->MsgPtr  = p_void;                                /* Deposit message in the ring slot                     */
+        p_msg->MsgSize = msg_size;
+#if (OS_CFG_TS_EN > 0u)
+        p_msg->MsgTS   = ts;
+#endif
+       *p_err          = OS_ERR_NONE;
+        return;
+    }
+#endif
+
     if (OSMsgPool.NbrFree == 0u) {
        *p_err = OS_ERR_MSG_POOL_EMPTY;                          /* No more OS_MSG to use                                */
         return;
@@ -0,0 +1,1050 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        MESSAGE BUFFER MANAGEMENT
+*
+* File    : os_msg_buf.c
+* Version : V3.08.02
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_msg_buf__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_MSG_BUF_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_MSG_SIZE  OS_MsgBufCopyIn   (OS_MSG_BUF        *p_buf,
+                                        OS_MSG_SIZE        ix,
+                                        const  CPU_INT08U *p_src,
+                                        OS_MSG_SIZE        len);
+
+static  OS_MSG_SIZE  OS_MsgBufCopyOut  (OS_MSG_BUF        *p_buf,
+                                        OS_MSG_SIZE        ix,
+                                        CPU_INT08U        *p_dst,
+                                        OS_MSG_SIZE        len);
+
+static  OS_MSG_SIZE  OS_MsgBufLenGet   (OS_MSG_BUF        *p_buf);
+
+static  void         OS_MsgBufRead     (OS_MSG_BUF        *p_buf,
+                                        void              *p_dst,
+                                        OS_MSG_SIZE        len);
+
+static  void         OS_MsgBufWrite    (OS_MSG_BUF        *p_buf,
+                                        const  void       *p_src,
+                                        OS_MSG_SIZE        len);
+
+static  OS_OBJ_QTY   OS_MsgBufRdyPend  (OS_MSG_BUF        *p_buf,
+                                        CPU_TS             ts);
+
+static  OS_OBJ_QTY   OS_MsgBufRdyPost  (OS_MSG_BUF        *p_buf,
+                                        CPU_TS             ts);
+
+
+/*
+************************************************************************************************************************
+*                                               CREATE A MESSAGE BUFFER
+*
+* Description: This function is called by your application to create a message buffer.  A message buffer transports
+*              variable-length records by value: OSMsgBufPost() copies a record into the storage of the message buffer
+*              and OSMsgBufPend() copies it out, so that neither side allocates or frees a memory block per record.
+*
+* Arguments  : p_buf       is a pointer to the message buffer
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the message buffer
+*
+*              p_storage   is a pointer to 'size' bytes which hold the records.  The storage belongs to the message
+*                          buffer until the message buffer is deleted.
+*
+*              size        is the size of the storage (in bytes).  Each record takes its length plus
+*                          OS_MSG_BUF_HDR_SIZE bytes of the storage.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the message buffer after you
+*                                                               called OSSafetyCriticalStart()
+*                              OS_ERR_MSG_BUF_SIZE            If 'size' cannot hold a record of one byte
+*                              OS_ERR_OBJ_CREATED             If the message buffer was already created
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_buf'
+*                              OS_ERR_PTR_INVALID             If you passed a NULL pointer for 'p_storage'
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSMsgBufCreate (OS_MSG_BUF   *p_buf,
+                      CPU_CHAR     *p_name,
+                      void         *p_storage,
+                      OS_MSG_SIZE   size,
+                      OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_buf == (OS_MSG_BUF *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_storage == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (size <= OS_MSG_BUF_HDR_SIZE) {                          /* Must hold at least the length and one byte           */
+       *p_err = OS_ERR_MSG_BUF_SIZE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_buf->Type == OS_OBJ_TYPE_MSG_BUF) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_buf->Type                   = OS_OBJ_TYPE_MSG_BUF;        /* Mark the data structure as a message buffer          */
+    p_buf->PostPendObj.Type       = OS_OBJ_TYPE_MSG_BUF;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_buf->NamePtr                = p_name;
+    p_buf->PostPendObj.NamePtr    = p_name;
+    p_buf->PostPendObj.DbgNamePtr = (CPU_CHAR *)((void *)" ");
+#else
+    (void)p_name;
+#endif
+    OS_PendListInit(&p_buf->PendList);                          /* Initialize the waiting lists                         */
+    OS_PendListInit(&p_buf->PostPendObj.PendList);
+    p_buf->BufPtr                 = (CPU_INT08U *)p_storage;
+    p_buf->BufSize                = size;
+    p_buf->InIx                   = 0u;
+    p_buf->OutIx                  = 0u;
+    p_buf->NbrUsed                = 0u;
+    p_buf->NbrEntries             = 0u;
+#if (OS_CFG_DBG_EN > 0u)
+    p_buf->NbrUsedMax             = 0u;
+    OS_MsgBufDbgListAdd(p_buf);
+    OSMsgBufQty++;                                              /* One more message buffer created                      */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              DELETE A MESSAGE BUFFER
+*
+* Description: This function deletes a message buffer and readies all tasks waiting on it, for a record or for room.
+*
+* Arguments  : p_buf     is a pointer to the message buffer you want to delete
+*
+*              opt       determines delete options as follows:
+*
+*                            OS_OPT_DEL_NO_PEND          Delete the message buffer ONLY if no task waiting
+*                            OS_OPT_DEL_ALWAYS           Deletes the message buffer even if tasks are waiting.
+*                                                        In this case, all the tasks waiting will be readied.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    The call was successful and the message buffer was deleted
+*                            OS_ERR_DEL_ISR                 If you tried to delete the message buffer from an ISR
+*                            OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the message buffer after you
+*                                                             called OSStart()
+*                            OS_ERR_OBJ_PTR_NULL            If you pass a NULL pointer for 'p_buf'
+*                            OS_ERR_OBJ_TYPE                If the message buffer was not created
+*                            OS_ERR_OPT_INVALID             An invalid option was specified
+*                            OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                            OS_ERR_TASK_WAITING            One or more tasks were waiting on the message buffer
+*
+* Returns    : == 0          if no tasks were waiting on the message buffer, or upon error.
+*              >  0          if one or more tasks waiting on the message buffer are now readied and informed.
+*
+* Note(s)    : 1) The records still in the message buffer are discarded.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSMsgBufDel (OS_MSG_BUF  *p_buf,
+                         OS_OPT       opt,
+                         OS_ERR      *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_PEND_LIST  *p_post_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't delete a message buffer from an ISR            */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_buf == (OS_MSG_BUF *)0) {                             /* Validate 'p_buf'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_buf->Type != OS_OBJ_TYPE_MSG_BUF) {                   /* Make sure message buffer was created                 */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list      = &p_buf->PendList;
+    p_post_pend_list = &p_buf->PostPendObj.PendList;
+    nbr_tasks        = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete message buffer only if no task waiting        */
+             if ((OS_PEND_LIST_HEAD_GET(p_pend_list)      != (OS_TCB *)0) ||
+                 (OS_PEND_LIST_HEAD_GET(p_post_pend_list) != (OS_TCB *)0)) {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+                 return (0u);
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the message buffer                     */
+#if (OS_CFG_TS_EN > 0u)
+             ts = OS_TS_GET();                                  /* Get local time stamp so all tasks get the same time  */
+#else
+             ts = 0u;
+#endif
+             while (OS_PEND_LIST_HEAD_GET(p_pend_list) != (OS_TCB *)0) {  /* Ready the tasks waiting for a record       */
+                 p_tcb = OS_PEND_LIST_HEAD_GET(p_pend_list);
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+             while (OS_PEND_LIST_HEAD_GET(p_post_pend_list) != (OS_TCB *)0) { /* ... and the ones waiting for room      */
+                 p_tcb = OS_PEND_LIST_HEAD_GET(p_post_pend_list);
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    OS_MsgBufDbgListRemove(p_buf);
+    OSMsgBufQty--;
+#endif
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_buf->Type                = OS_OBJ_TYPE_NONE;              /* Mark the data structure as a NONE                    */
+    p_buf->PostPendObj.Type    = OS_OBJ_TYPE_NONE;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_buf->NamePtr             = (CPU_CHAR *)((void *)"?MBUF");
+    p_buf->PostPendObj.NamePtr = (CPU_CHAR *)((void *)"?MBUF");
+    p_buf->NbrUsedMax          = 0u;
+#endif
+    OS_PendListInit(p_pend_list);                               /* Initialize the waiting lists                         */
+    OS_PendListInit(p_post_pend_list);
+    p_buf->BufPtr              = (CPU_INT08U *)0;               /* Discard the records, see Note #1                     */
+    p_buf->BufSize             = 0u;
+    p_buf->InIx                = 0u;
+    p_buf->OutIx               = 0u;
+    p_buf->NbrUsed             = 0u;
+    p_buf->NbrEntries          = 0u;
+    CPU_CRITICAL_EXIT();
+    if (nbr_tasks > 0u) {
+        OSSched();                                              /* Find highest priority task ready to run              */
+    }
+   *p_err = OS_ERR_NONE;
+    return (nbr_tasks);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          PEND ON A MESSAGE BUFFER FOR A RECORD
+*
+* Description: This function copies the oldest record of a message buffer into your buffer, waiting for a record if the
+*              message buffer is empty.
+*
+* Arguments  : p_buf         is a pointer to the message buffer
+*
+*              p_data        is a pointer to where the record will be copied
+*
+*              size          is the size of the buffer pointed to by 'p_data' (in bytes)
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            record up to the amount of time specified by this argument.  If you specify 0, however,
+*                            your task will wait forever or, until a record is posted.
+*
+*              opt           determines whether the user wants to block if the message buffer is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the record was copied
+*                                OS_ERR_MSG_BUF_SIZE       If the record is larger than 'size', see Note #1
+*                                OS_ERR_OBJ_DEL            If 'p_buf' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_buf'
+*                                OS_ERR_OBJ_TYPE           If the message buffer was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the result
+*                                                          would lead to a suspension
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the message buffer was empty
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_data'
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            A record was not received within the specified timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : The length of the record (in bytes), or 0 if no record was received.
+*
+* Note(s)    : 1) A record larger than 'size' is left in the message buffer and its length is returned, so that it can
+*                 be received with a larger buffer.
+*
+*              2) The record is copied with interrupts disabled, so message buffers are meant for small records.
+*
+*              3) Tasks waiting for room are readied, in priority order, as long as their records fit.
+*
+*              4) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+OS_MSG_SIZE  OSMsgBufPend (OS_MSG_BUF   *p_buf,
+                           void         *p_data,
+                           OS_MSG_SIZE   size,
+                           OS_TICK       timeout,
+                           OS_OPT        opt,
+                           OS_ERR       *p_err)
+{
+    OS_MSG_SIZE  len;
+    OS_OBJ_QTY   nbr_tasks;
+    CPU_TS       ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return (0u);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_buf == (OS_MSG_BUF *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_data == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_buf->Type != OS_OBJ_TYPE_MSG_BUF) {                   /* Make sure message buffer was created                 */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_buf->NbrEntries > 0u) {                               /* Any record in the message buffer?                    */
+        len = OS_MsgBufLenGet(p_buf);                           /* Yes                                                  */
+        if (len > size) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_MSG_BUF_SIZE;                        /* See Note #1                                          */
+            return (len);
+        }
+        OS_MsgBufRead(p_buf, p_data, len);
+#if (OS_CFG_TS_EN > 0u)
+        ts        = OS_TS_GET();
+#else
+        ts        = 0u;
+#endif
+        nbr_tasks = OS_MsgBufRdyPost(p_buf, ts);                /* See Note #3                                          */
+        CPU_CRITICAL_EXIT();
+        if (nbr_tasks > 0u) {
+            OSSched();                                          /* Find the next highest priority task ready to run     */
+        }
+       *p_err = OS_ERR_NONE;
+        return (len);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return (0u);
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+    }
+
+    OSTCBCurPtr->MsgPtr  = p_data;                              /* Tell OSMsgBufPost() where to copy the record         */
+    OSTCBCurPtr->MsgSize = size;
+    OS_Pend((OS_PEND_OBJ *)((void *)p_buf),                     /* Block task pending on message buffer                 */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_MSG_BUF,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Record copied by OSMsgBufPost()                      */
+             len = OSTCBCurPtr->MsgSize;
+             if (OSTCBCurPtr->MsgPtr == (void *)0) {            /* Record left in the message buffer, see Note #1       */
+                *p_err = OS_ERR_MSG_BUF_SIZE;
+             } else {
+                *p_err = OS_ERR_NONE;
+             }
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+             len    = 0u;
+            *p_err  = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get a record within TO       */
+             len    = 0u;
+            *p_err  = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+             len    = 0u;
+            *p_err  = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             len    = 0u;
+            *p_err  = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (len);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           POST A RECORD TO A MESSAGE BUFFER
+*
+* Description: This function copies a record into a message buffer, waiting for room if the message buffer is full.
+*
+* Arguments  : p_buf         is a pointer to the message buffer
+*
+*              p_data        is a pointer to the record to copy
+*
+*              msg_size      is the length of the record (in bytes)
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for room
+*                            up to the amount of time specified by this argument.  If you specify 0, however, your task
+*                            will wait forever or, until there is room for the record.
+*
+*              opt           determines whether the user wants to block if there is no room for the record or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The record was copied into the message buffer
+*                                OS_ERR_MSG_BUF_SIZE       If 'msg_size' is 0 or larger than the message buffer can hold
+*                                OS_ERR_OBJ_DEL            If 'p_buf' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_buf'
+*                                OS_ERR_OBJ_TYPE           If the message buffer was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The wait for room was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the result
+*                                                          would lead to a suspension
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but there was no room
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_data'
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            There was no room for the record within the specified timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : none
+*
+* Note(s)    : 1) The record is copied with interrupts disabled, so message buffers are meant for small records.  When
+*                 tasks wait for a record, the record is copied straight into the buffer of the highest priority one.
+*
+*              2) A record is not posted ahead of tasks already waiting for room, so records are stored in the order
+*                 of the priority of their posters.
+*
+*              3) Posts from ISRs are processed in the ISR, even when OS_CFG_ISR_POST_DEFERRED_EN defers the posts to
+*                 the other kernel objects, since the record is only valid during the call.
+************************************************************************************************************************
+*/
+
+void  OSMsgBufPost (OS_MSG_BUF   *p_buf,
+                    const  void  *p_data,
+                    OS_MSG_SIZE   msg_size,
+                    OS_TICK       timeout,
+                    OS_OPT        opt,
+                    OS_ERR       *p_err)
+{
+    OS_OBJ_QTY  nbr_tasks;
+    CPU_TS      ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to wait for room from an ISR             */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return;
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_buf == (OS_MSG_BUF *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_data == (const void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_buf->Type != OS_OBJ_TYPE_MSG_BUF) {                   /* Make sure message buffer was created                 */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if ((msg_size == 0u) ||                                     /* Would the record ever fit?                           */
+        (msg_size > (p_buf->BufSize - OS_MSG_BUF_HDR_SIZE))) {
+       *p_err = OS_ERR_MSG_BUF_SIZE;
+        return;
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if ((OS_PEND_LIST_HEAD_GET(&p_buf->PostPendObj.PendList) == (OS_TCB *)0) &&   /* See Note #2                        */
+        ((p_buf->BufSize - p_buf->NbrUsed) >= (OS_MSG_BUF_HDR_SIZE + msg_size))) {
+        OS_MsgBufWrite(p_buf, p_data, msg_size);                /* Room for the record                                  */
+        nbr_tasks = OS_MsgBufRdyPend(p_buf, ts);                /* Hand it to a waiting task, see Note #1               */
+        CPU_CRITICAL_EXIT();
+        if (nbr_tasks > 0u) {
+            OSSched();                                          /* Find the next highest priority task ready to run     */
+        }
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if no room?                    */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return;
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+    }
+
+    OSTCBCurPtr->MsgPtr  = (void *)p_data;                      /* Tell OSMsgBufPend() where to copy the record from    */
+    OSTCBCurPtr->MsgSize = msg_size;
+    OS_Pend(&p_buf->PostPendObj,                                /* Block task waiting for room                          */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_MSG_BUF,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Record copied by OSMsgBufPend()                      */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that there was no room within TO            */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                   ADD/REMOVE MESSAGE BUFFER TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a message buffer to/from the message buffer
+*              debug list.
+*
+* Arguments  : p_buf     is a pointer to the message buffer to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_MsgBufDbgListAdd (OS_MSG_BUF  *p_buf)
+{
+    p_buf->DbgNamePtr                  = (CPU_CHAR *)((void *)" ");
+    p_buf->DbgPrevPtr                  = (OS_MSG_BUF *)0;
+    if (OSMsgBufDbgListPtr == (OS_MSG_BUF *)0) {
+        p_buf->DbgNextPtr              = (OS_MSG_BUF *)0;
+    } else {
+        p_buf->DbgNextPtr              =  OSMsgBufDbgListPtr;
+        OSMsgBufDbgListPtr->DbgPrevPtr =  p_buf;
+    }
+    OSMsgBufDbgListPtr                 =  p_buf;
+}
+
+
+void  OS_MsgBufDbgListRemove (OS_MSG_BUF  *p_buf)
+{
+    OS_MSG_BUF  *p_buf_next;
+    OS_MSG_BUF  *p_buf_prev;
+
+
+    p_buf_prev = p_buf->DbgPrevPtr;
+    p_buf_next = p_buf->DbgNextPtr;
+
+    if (p_buf_prev == (OS_MSG_BUF *)0) {
+        OSMsgBufDbgListPtr = p_buf_next;
+        if (p_buf_next != (OS_MSG_BUF *)0) {
+            p_buf_next->DbgPrevPtr = (OS_MSG_BUF *)0;
+        }
+        p_buf->DbgNextPtr = (OS_MSG_BUF *)0;
+
+    } else if (p_buf_next == (OS_MSG_BUF *)0) {
+        p_buf_prev->DbgNextPtr = (OS_MSG_BUF *)0;
+        p_buf->DbgPrevPtr      = (OS_MSG_BUF *)0;
+
+    } else {
+        p_buf_prev->DbgNextPtr =  p_buf_next;
+        p_buf_next->DbgPrevPtr =  p_buf_prev;
+        p_buf->DbgNextPtr      = (OS_MSG_BUF *)0;
+        p_buf->DbgPrevPtr      = (OS_MSG_BUF *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        COPY BYTES INTO/OUT OF A MESSAGE BUFFER
+*
+* Description: These functions copy 'len' bytes into or out of the storage of a message buffer, starting at index 'ix'
+*              and wrapping around the end of the storage.
+*
+* Arguments  : p_buf     is a pointer to the message buffer
+*
+*              ix        is the index of the first byte of the storage to write or read
+*
+*              p_src     is a pointer to the bytes to copy into the storage
+*              p_dst     is a pointer to where the bytes of the storage are copied
+*
+*              len       is the number of bytes to copy
+*
+* Returns    : The index following the last byte written or read.
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) The bytes are copied in at most two contiguous spans, one up to the end of the storage and one from its
+*                 start, so that the wrap around is not tested for each byte.
+************************************************************************************************************************
+*/
+
+static  OS_MSG_SIZE  OS_MsgBufCopyIn (OS_MSG_BUF        *p_buf,
+                                      OS_MSG_SIZE        ix,
+                                      const  CPU_INT08U *p_src,
+                                      OS_MSG_SIZE        len)
+{
+    CPU_INT08U   *p_dst;
+    OS_MSG_SIZE   span;
+
+
+    while (len > 0u) {                                          /* At most two contiguous spans, see Note #2            */
+        span = p_buf->BufSize - ix;
+        if (span > len) {
+            span = len;
+        }
+        len  -= span;
+        p_dst = &p_buf->BufPtr[ix];
+        ix   += span;
+        while (span > 0u) {
+           *p_dst = *p_src;
+            p_dst++;
+            p_src++;
+            span--;
+        }
+        if (ix == p_buf->BufSize) {                             /* Wrap around                                          */
+            ix = 0u;
+        }
+    }
+    return (ix);
+}
+
+
+static  OS_MSG_SIZE  OS_MsgBufCopyOut (OS_MSG_BUF   *p_buf,
+                                       OS_MSG_SIZE   ix,
+                                       CPU_INT08U   *p_dst,
+                                       OS_MSG_SIZE   len)
+{
+    CPU_INT08U   *p_src;
+    OS_MSG_SIZE   span;
+
+
+    while (len > 0u) {
+        span = p_buf->BufSize - ix;
+        if (span > len) {
+            span = len;
+        }
+        len  -= span;
+        p_src = &p_buf->BufPtr[ix];
+        ix   += span;
+        while (span > 0u) {
+           *p_dst = *p_src;
+            p_dst++;
+            p_src++;
+            span--;
+        }
+        if (ix == p_buf->BufSize) {                             /* Wrap around                                          */
+            ix = 0u;
+        }
+    }
+    return (ix);
+}
+
+
+/*
+************************************************************************************************************************
+*                                      READ/WRITE A RECORD OF A MESSAGE BUFFER
+*
+* Description: OS_MsgBufLenGet() returns the length of the oldest record, which OS_MsgBufRead() then removes and copies
+*              to 'p_dst'.  OS_MsgBufWrite() appends a record, which MUST fit.
+*
+* Arguments  : p_buf     is a pointer to the message buffer
+*
+*              p_dst     is a pointer to where the record is copied
+*              p_src     is a pointer to the record to append
+*
+*              len       is the length of the record
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) These functions are called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  OS_MSG_SIZE  OS_MsgBufLenGet (OS_MSG_BUF  *p_buf)
+{
+    OS_MSG_SIZE  len;
+
+
+    (void)OS_MsgBufCopyOut(p_buf,
+                           p_buf->OutIx,
+                           (CPU_INT08U *)&len,
+                           OS_MSG_BUF_HDR_SIZE);
+    return (len);
+}
+
+
+static  void  OS_MsgBufRead (OS_MSG_BUF   *p_buf,
+                             void         *p_dst,
+                             OS_MSG_SIZE   len)
+{
+    OS_MSG_SIZE  hdr;
+    OS_MSG_SIZE  ix;
+
+
+    ix                 = OS_MsgBufCopyOut(p_buf,                /* Skip the length                                      */
+                                          p_buf->OutIx,
+                                          (CPU_INT08U *)&hdr,
+                                          OS_MSG_BUF_HDR_SIZE);
+    p_buf->OutIx       = OS_MsgBufCopyOut(p_buf,
+                                          ix,
+                                          (CPU_INT08U *)p_dst,
+                                          len);
+    p_buf->NbrUsed    -= OS_MSG_BUF_HDR_SIZE + len;
+    p_buf->NbrEntries--;
+}
+
+
+static  void  OS_MsgBufWrite (OS_MSG_BUF   *p_buf,
+                              const  void  *p_src,
+                              OS_MSG_SIZE   len)
+{
+    OS_MSG_SIZE  ix;
+
+
+    ix                 = OS_MsgBufCopyIn(p_buf,                 /* Length first, see MESSAGE BUFFERS Note #3            */
+                                         p_buf->InIx,
+                                         (const CPU_INT08U *)&len,
+                                         OS_MSG_BUF_HDR_SIZE);
+    p_buf->InIx        = OS_MsgBufCopyIn(p_buf,
+                                         ix,
+                                         (const CPU_INT08U *)p_src,
+                                         len);
+    p_buf->NbrUsed    += OS_MSG_BUF_HDR_SIZE + len;
+    p_buf->NbrEntries++;
+#if (OS_CFG_DBG_EN > 0u)
+    if (p_buf->NbrUsedMax < p_buf->NbrUsed) {
+        p_buf->NbrUsedMax = p_buf->NbrUsed;
+    }
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                         READY TASKS WAITING ON A MESSAGE BUFFER
+*
+* Description: OS_MsgBufRdyPend() hands the records of a message buffer to the tasks waiting for a record, in priority
+*              order.  OS_MsgBufRdyPost() appends the records of the tasks waiting for room, in priority order, until
+*              the record of the highest priority one does not fit.
+*
+* Arguments  : p_buf     is a pointer to the message buffer
+*
+*              ts        is the timestamp given to the readied tasks
+*
+* Returns    : The number of tasks readied.
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) These functions are called with interrupts disabled.
+*
+*              3) A task waits for a record with .MsgPtr/.MsgSize pointing to its buffer, and for room with .MsgPtr/
+*                 .MsgSize pointing to its record.  A task whose buffer is too small for the record is readied with a
+*                 NULL .MsgPtr and the record is offered to the next task, see OSMsgBufPend() Note #1.
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_MsgBufRdyPend (OS_MSG_BUF  *p_buf,
+                                      CPU_TS       ts)
+{
+    OS_TCB       *p_tcb;
+    OS_MSG_SIZE   len;
+    OS_OBJ_QTY    nbr_tasks;
+
+
+    nbr_tasks = 0u;
+    p_tcb     = OS_PEND_LIST_HEAD_GET(&p_buf->PendList);
+    while ((p_tcb != (OS_TCB *)0) && (p_buf->NbrEntries > 0u)) {
+        len = OS_MsgBufLenGet(p_buf);
+        if (len <= p_tcb->MsgSize) {                            /* See Note #3                                          */
+            OS_MsgBufRead(p_buf, p_tcb->MsgPtr, len);
+            OS_Post((OS_PEND_OBJ *)((void *)p_buf),
+                    p_tcb,
+                    p_tcb->MsgPtr,
+                    len,
+                    ts);
+        } else {
+            OS_Post((OS_PEND_OBJ *)((void *)p_buf),
+                    p_tcb,
+                    (void *)0,
+                    len,
+                    ts);
+        }
+        nbr_tasks++;
+        p_tcb = OS_PEND_LIST_HEAD_GET(&p_buf->PendList);
+    }
+    return (nbr_tasks);
+}
+
+
+static  OS_OBJ_QTY  OS_MsgBufRdyPost (OS_MSG_BUF  *p_buf,
+                                      CPU_TS       ts)
+{
+    OS_TCB       *p_tcb;
+    OS_OBJ_QTY    nbr_tasks;
+
+
+    nbr_tasks = 0u;
+    p_tcb     = OS_PEND_LIST_HEAD_GET(&p_buf->PostPendObj.PendList);
+    while (p_tcb != (OS_TCB *)0) {
+        if ((p_buf->BufSize - p_buf->NbrUsed) < (OS_MSG_BUF_HDR_SIZE + p_tcb->MsgSize)) {
+            break;                                              /* No room yet for the highest priority task            */
+        }
+        OS_MsgBufWrite(p_buf, p_tcb->MsgPtr, p_tcb->MsgSize);
+        OS_Post(&p_buf->PostPendObj,
+                p_tcb,
+                (void *)0,
+                0u,
+                ts);
+        nbr_tasks++;
+        p_tcb = OS_PEND_LIST_HEAD_GET(&p_buf->PostPendObj.PendList);
+    }
+    return (nbr_tasks);
+}
+#endif
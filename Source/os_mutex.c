@@ -112,6 +112,9 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
     p_mutex->MutexGrpNextPtr   = (OS_MUTEX *)0;
     p_mutex->OwnerTCBPtr       = (OS_TCB   *)0;
     p_mutex->OwnerNestingCtr   =             0u;                /* Mutex is available                                   */
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+    p_mutex->CeilPrio          =  OS_PRIO_INIT;                 /* Priority inheritance mutex                           */
+#endif
 #if (OS_CFG_TS_EN > 0u)
     p_mutex->TS                =             0u;
 #endif
@@ -128,6 +131,86 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
 }
 
 
+/*
+************************************************************************************************************************
+*                                          CREATE A PRIORITY CEILING MUTEX
+*
+* Description: This function creates a mutex following the immediate priority ceiling protocol: a task locking the
+*              mutex is raised at once to the mutex's ceiling priority, until it releases the mutex.
+*
+* Arguments  : p_mutex       is a pointer to the mutex to initialize.  Your application is responsible for allocating
+*                            storage for the mutex.
+*
+*              p_name        is a pointer to the name you would like to give the mutex.
+*
+*              prio_ceil     is the ceiling priority, which must be the priority of the highest priority task that
+*                            locks the mutex, or higher.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the mutex after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_mutex' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the mutex was already created
+*                                OS_ERR_PRIO_INVALID            If 'prio_ceil' is the idle task priority or beyond, or
+*                                                               is 0 when posts from ISRs are deferred
+*
+* Returns    : none
+*
+* Note(s)    : 1) The mutex is used with OSMutexPend()/OSMutexPost() like any other mutex.  Since the owner already
+*                 runs at the ceiling, no task using the mutex can preempt it while it holds the mutex, on a single
+*                 core.  The mutex is thus never contended as long as the owner doesn't block while holding it, and
+*                 neither pending nor posting walks the chain of owners.  Locking ceiling mutexes can't deadlock either,
+*                 as long as tasks don't block while holding them.
+*
+*              2) OSMutexPend() returns OS_ERR_MUTEX_CEILING to a task whose base priority is higher than the ceiling.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+void  OSMutexCreateCeiling (OS_MUTEX  *p_mutex,
+                            CPU_CHAR  *p_name,
+                            OS_PRIO    prio_ceil,
+                            OS_ERR    *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (prio_ceil >= (OS_CFG_PRIO_MAX - 1u)) {                  /* Can't use the idle task priority as a ceiling        */
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (prio_ceil == 0u) {                                      /* Priority 0 is reserved for the ISR handler task      */
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+
+    OSMutexCreate(p_mutex, p_name, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_mutex->CeilPrio = prio_ceil;
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                   DELETE A MUTEX
@@ -241,11 +324,23 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
                  OSMutexQty--;
 #endif
                  OS_TRACE_MUTEX_DEL(p_mutex);
-                 if (p_mutex->OwnerTCBPtr != (OS_TCB *)0) {     /* Does the mutex belong to a task?                     */
-                     OS_MutexGrpRemove(p_mutex->OwnerTCBPtr, p_mutex); /* yes, remove it from the task group.           */
+                 p_tcb_owner = p_mutex->OwnerTCBPtr;
+                 if (p_tcb_owner != (OS_TCB *)0) {              /* Does the mutex belong to a task?                     */
+                     OS_MutexGrpRemove(p_tcb_owner, p_mutex);   /* yes, remove it from the task group.                  */
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+                     if ((p_mutex->CeilPrio != OS_PRIO_INIT) && /* Drop the owner's ceiling priority               */
+                         (p_tcb_owner->Prio != p_tcb_owner->BasePrio)) {
+                         prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+                         prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+                         OS_TaskChangePrio(p_tcb_owner, prio_new);
+                     }
+#endif
                  }
                  OS_MutexClr(p_mutex);
                  CPU_CRITICAL_EXIT();
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+                 OSSched();                                     /* Run the tasks the ceiling held back                  */
+#endif
                 *p_err = OS_ERR_NONE;
              } else {
                  CPU_CRITICAL_EXIT();
@@ -329,6 +424,7 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 *              p_err         is a pointer to a variable that will contain an error code returned by this function.
 *
 *                                OS_ERR_NONE               The call was successful and your task owns the resource
+*                                OS_ERR_MUTEX_CEILING      If the caller's priority is above the mutex's ceiling
 *                                OS_ERR_MUTEX_OWNER        If calling task already owns the mutex
 *                                OS_ERR_MUTEX_OVF          Mutex nesting counter overflowed
 *                                OS_ERR_OBJ_DEL            If 'p_mutex' was deleted
@@ -431,6 +527,17 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
 #endif
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+    if ((p_mutex->CeilPrio     != OS_PRIO_INIT) &&              /* Is the caller above the mutex ceiling?               */
+        (OSTCBCurPtr->BasePrio <  p_mutex->CeilPrio)) {
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_MUTEX_PEND_FAILED(p_mutex);
+        OS_TRACE_MUTEX_PEND_EXIT(OS_ERR_MUTEX_CEILING);
+       *p_err = OS_ERR_MUTEX_CEILING;
+        return;
+    }
+#endif
+
     if (p_mutex->OwnerNestingCtr == 0u) {                       /* Resource available?                                  */
         p_mutex->OwnerTCBPtr     = OSTCBCurPtr;                 /* Yes, caller may proceed                              */
         p_mutex->OwnerNestingCtr = 1u;
@@ -440,6 +547,11 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
         }
 #endif
         OS_MutexGrpAdd(OSTCBCurPtr, p_mutex);                   /* Add mutex to owner's group                           */
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+        if (OSTCBCurPtr->Prio > p_mutex->CeilPrio) {            /* Raise the owner to the ceiling at once               */
+            OS_TaskChangePrio(OSTCBCurPtr, p_mutex->CeilPrio);
+        }
+#endif
         CPU_CRITICAL_EXIT();
         OS_TRACE_MUTEX_PEND(p_mutex);
         OS_TRACE_MUTEX_PEND_EXIT(OS_ERR_NONE);
@@ -731,7 +843,8 @@ OS_OBJ_QTY  OSMutexPendAbort (OS_MUTEX  *p_mutex,
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) Releasing a priority ceiling mutex lowers the owner back to its base priority in constant time when it
+*                 holds no other mutex.  Otherwise, only the mutexes the owner still holds are looked at.
 ************************************************************************************************************************
 */
 
@@ -828,11 +941,36 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
 
     OS_MutexGrpRemove(OSTCBCurPtr, p_mutex);                    /* Remove mutex from owner's group                      */
 
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+    if ((p_mutex->CeilPrio  != OS_PRIO_INIT) &&                 /* Drop the ceiling priority, see Note #1               */
+        (OSTCBCurPtr->Prio  != OSTCBCurPtr->BasePrio)) {
+        if (OSTCBCurPtr->MutexGrpHeadPtr == (OS_MUTEX *)0) {
+            prio_new = OSTCBCurPtr->BasePrio;
+        } else {
+            prio_new = OS_MutexGrpPrioFindHighest(OSTCBCurPtr);
+            prio_new = (prio_new > OSTCBCurPtr->BasePrio) ? OSTCBCurPtr->BasePrio : prio_new;
+        }
+        if (prio_new > OSTCBCurPtr->Prio) {
+            OS_RdyListRemove(OSTCBCurPtr);
+            OSTCBCurPtr->Prio = prio_new;                       /* Lower owner's priority back to its original one      */
+            OS_PrioInsert(prio_new);
+            OS_RdyListInsertTail(OSTCBCurPtr);                  /* Insert owner in ready list at new priority           */
+            OSPrioCur         = prio_new;
+        }
+    }
+#endif
+
     p_pend_list = &p_mutex->PendList;
     if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on mutex?                           */
         p_mutex->OwnerTCBPtr     = (OS_TCB *)0;                 /* No                                                   */
         p_mutex->OwnerNestingCtr =           0u;
         CPU_CRITICAL_EXIT();
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+        if ((p_mutex->CeilPrio != OS_PRIO_INIT) &&
+            ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+            OSSched();                                          /* Run the tasks the ceiling held back                  */
+        }
+#endif
         OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
        *p_err = OS_ERR_NONE;
         return;
@@ -861,6 +999,11 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
                            (void *)0,
                            0u,
                            ts);
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+    if (p_tcb->Prio > p_mutex->CeilPrio) {                      /* Raise the new owner to the ceiling                   */
+        OS_TaskChangePrio(p_tcb, p_mutex->CeilPrio);
+    }
+#endif
 
     CPU_CRITICAL_EXIT();
 
@@ -899,6 +1042,9 @@ void  OS_MutexClr (OS_MUTEX  *p_mutex)
     p_mutex->MutexGrpNextPtr   = (OS_MUTEX *)0;
     p_mutex->OwnerTCBPtr       = (OS_TCB   *)0;
     p_mutex->OwnerNestingCtr   =             0u;
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+    p_mutex->CeilPrio          =  OS_PRIO_INIT;
+#endif
 #if (OS_CFG_TS_EN > 0u)
     p_mutex->TS                =             0u;
 #endif
@@ -1026,7 +1172,8 @@ void  OS_MutexGrpRemove (OS_TCB  *p_tcb, OS_MUTEX  *p_mutex)
 ************************************************************************************************************************
 *                                              MUTEX FIND HIGHEST PENDING
 *
-* Description: This function is called by the kernel to find the highest task pending on any mutex from a group.
+* Description: This function is called by the kernel to find the highest task pending on any mutex from a group, or
+*              the highest ceiling of the priority ceiling mutexes of the group.
 *
 
 * Argument(s): p_tcb        is a pointer to the tcb of the task to process.
@@ -1050,6 +1197,11 @@ OS_PRIO  OS_MutexGrpPrioFindHighest (OS_TCB  *p_tcb)
     pp_mutex = &p_tcb->MutexGrpHeadPtr;
 
     while(*pp_mutex != (OS_MUTEX *)0) {
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+        if ((*pp_mutex)->CeilPrio < highest_prio) {             /* A ceiling mutex keeps its owner at the ceiling       */
+            highest_prio = (*pp_mutex)->CeilPrio;
+        }
+#endif
         p_head = (*pp_mutex)->PendList.HeadPtr;
         if (p_head != (OS_TCB *)0) {
             prio = p_head->Prio;
@@ -1112,7 +1264,7 @@ void  OS_MutexGrpPostAll (OS_TCB  *p_tcb)
         } else {
                                                                 /* Get TCB from head of pend list                       */
             p_tcb_new                = p_pend_list->HeadPtr;
-            p_mutex->OwnerTCBPtr     = p_tcb;                   /* Give mutex to new owner                              */
+            p_mutex->OwnerTCBPtr     = p_tcb_new;               /* Give mutex to new owner                              */
             p_mutex->OwnerNestingCtr = 1u;
             OS_MutexGrpAdd(p_tcb_new, p_mutex);
                                                                 /* Post to mutex                                        */
@@ -1121,6 +1273,11 @@ void  OS_MutexGrpPostAll (OS_TCB  *p_tcb)
                                    (void *)0,
                                    0u,
                                    ts);
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+            if (p_tcb_new->Prio > p_mutex->CeilPrio) {          /* Raise the new owner to the ceiling                   */
+                OS_TaskChangePrio(p_tcb_new, p_mutex->CeilPrio);
+            }
+#endif
         }
 
         p_mutex = p_mutex_next;
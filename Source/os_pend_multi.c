@@ -0,0 +1,659 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       PEND ON MULTIPLE OBJECTS
+*
+* File    : os_pend_multi.c
+* Version : V3.08.02
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_pend_multi__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_PendMultiGetRdy   (OS_PEND_DATA  *p_pend_data_tbl,
+                                          OS_OBJ_QTY     tbl_size,
+                                          CPU_BOOLEAN   *p_sched);
+
+static  void        OS_PendMultiWait     (OS_PEND_DATA  *p_pend_data_tbl,
+                                          OS_OBJ_QTY     tbl_size,
+                                          OS_TICK        timeout);
+
+static  void        OS_PendMultiInsert   (OS_PEND_DATA  *p_pend_data);
+
+static  void        OS_PendMultiUnlink   (OS_PEND_DATA  *p_pend_data);
+
+
+/*
+************************************************************************************************************************
+*                                             PEND ON MULTIPLE OBJECTS
+*
+* Description: This function pends on multiple objects.  The objects pended on MUST be either semaphores or message
+*              queues.  If multiple objects are ready at the start of the pend call, then all available objects that are
+*              ready will be indicated to the caller.  If the task must pend on the multiple events then, as soon as one
+*              of the object is either posted, aborted or deleted, the task will be readied.
+*
+* Arguments  : p_pend_data_tbl   is a pointer to an array of type OS_PEND_DATA which contains a list of all the
+*                                objects we will be waiting on.  The caller must declare an array of OS_PEND_DATA
+*                                and initialize the .PendObjPtr (see below) with a pointer to the object (semaphore
+*                                or message queue) to pend on.
+*
+*                                    OS_PEND_DATA  MyPendArray[?];
+*
+*                                The OS_PEND_DATA field are as follows:
+*
+*                                    OS_PEND_DATA  *PrevPtr;      Used to link OS_PEND_DATA objects
+*                                    OS_PEND_DATA  *NextPtr;      Used to link OS_PEND_DATA objects
+*                                    OS_TCB        *TCBPtr;       Pointer to the TCB that is pending on multiple objects
+*                                    OS_PEND_OBJ   *PendObjPtr;   USER supplied field which is a pointer to the
+*                                                                 semaphore or message queue you want to pend on.  When
+*                                                                 you call OSPendMulti() you MUST fill this field for
+*                                                                 each of the entries you want to pend on.
+*                                    OS_PEND_OBJ   *RdyObjPtr;    Pointer to the object that is ready (posted, aborted
+*                                                                 or deleted), NULL if this object is not ready.
+*                                    void          *RdyMsgPtr;    Pointer to the message received, if the object is
+*                                                                 a message queue.
+*                                    OS_MSG_SIZE    RdyMsgSize;   Size of the message received.
+*                                    CPU_TS         RdyTS;        The time stamp of when the object was posted, aborted
+*                                                                 or deleted.
+*
+*              tbl_size          is the number of entries in the OS_PEND_DATA array.
+*
+*              timeout           is an optional timeout period (in clock ticks).  If non-zero, your task will wait any
+*                                of the objects up to the amount of time specified by this argument. If you specify
+*                                0, however, your task will wait forever for the specified objects or, until an
+*                                object is posted, aborted or deleted.
+*
+*              opt               determines whether the user wants to block if none of the objects are available.
+*
+*                                    OS_OPT_PEND_BLOCKING
+*                                    OS_OPT_PEND_NON_BLOCKING
+*
+*              p_err             is a pointer to where an error message will be deposited.  Possible error messages
+*                                are:
+*
+*                                    OS_ERR_NONE              The call was successful and your task owns the resources
+*                                                             or, the objects you are waiting for occurred.  Check
+*                                                             the .RdyObjPtr fields to know WHICH objects are ready.
+*                                    OS_ERR_OBJ_DEL           If an object pended on was deleted
+*                                    OS_ERR_OBJ_PTR_NULL      If the .PendObjPtr of an entry is a NULL pointer
+*                                    OS_ERR_OBJ_TYPE          If you are not pointing to a semaphore or a queue
+*                                    OS_ERR_OPT_INVALID       If you specified an invalid option for 'opt'
+*                                    OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                    OS_ERR_PEND_ABORT        The wait on an object was aborted
+*                                    OS_ERR_PEND_ISR          If you called this function from an ISR
+*                                    OS_ERR_PEND_WOULD_BLOCK  If the caller didn't want to block and no object ready
+*                                    OS_ERR_PTR_INVALID       If you passed a NULL pointer for 'p_pend_data_tbl' or
+*                                                             a 'tbl_size' of 0
+*                                    OS_ERR_SCHED_LOCKED      If you called this function when the scheduler is locked
+*                                    OS_ERR_STATUS_INVALID    If the pend status has an invalid value
+*                                    OS_ERR_TIMEOUT           The objects were not posted within the specified 'timeout'
+*                                    OS_ERR_TICK_DISABLED     If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : >  0          the number of objects returned as ready, aborted or deleted
+*              == 0          if no object was posted, aborted or deleted, or upon error.
+*
+* Note(s)    : 1) This API 'MUST NOT' be called from a timer callback function.
+*
+*              2) The OS_PEND_DATA array is linked in the lists of the objects while the task waits, so it MUST remain
+*                 valid until OSPendMulti() returns, e.g. by declaring it on the stack of the calling task.
+*
+*              3) A task pending on multiple objects competes, in priority order, with the tasks pending on a single
+*                 one of these objects.  When readied, the task has received the semaphore or the message of the
+*                 object pointed to by the .RdyObjPtr field of one entry and the other entries are cleared.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSPendMulti (OS_PEND_DATA  *p_pend_data_tbl,
+                         OS_OBJ_QTY     tbl_size,
+                         OS_TICK        timeout,
+                         OS_OPT         opt,
+                         OS_ERR        *p_err)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     nbr_obj_rdy;
+    OS_OBJ_QTY     i;
+    CPU_BOOLEAN    sched;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_pend_data_tbl == (OS_PEND_DATA *)0) {                 /* Validate 'p_pend_data_tbl'                           */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (tbl_size == 0u) {                                       /* Array size must be > 0                               */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+    p_pend_data = p_pend_data_tbl;
+    for (i = 0u; i < tbl_size; i++) {                           /* Validate the objects and clear what the kernel fills */
+#if (OS_CFG_ARG_CHK_EN > 0u)
+        if (p_pend_data->PendObjPtr == (OS_PEND_OBJ *)0) {
+           *p_err = OS_ERR_OBJ_PTR_NULL;
+            return (0u);
+        }
+#endif
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+        switch (p_pend_data->PendObjPtr->Type) {                /* Only semaphores and queues can be pended on          */
+#if (OS_CFG_SEM_EN > 0u)
+            case OS_OBJ_TYPE_SEM:
+#endif
+#if (OS_CFG_Q_EN > 0u)
+            case OS_OBJ_TYPE_Q:
+#endif
+                 break;
+
+            default:
+                *p_err = OS_ERR_OBJ_TYPE;
+                 return (0u);
+        }
+#endif
+        p_pend_data->PrevPtr    = (OS_PEND_DATA *)0;
+        p_pend_data->NextPtr    = (OS_PEND_DATA *)0;
+        p_pend_data->TCBPtr     = (OS_TCB       *)0;
+        p_pend_data->RdyObjPtr  = (OS_PEND_OBJ  *)0;
+        p_pend_data->RdyMsgPtr  = (void         *)0;
+        p_pend_data->RdyMsgSize =                 0u;
+        p_pend_data->RdyTS      =                 0u;
+        p_pend_data++;
+    }
+
+    CPU_CRITICAL_ENTER();
+    nbr_obj_rdy = OS_PendMultiGetRdy(p_pend_data_tbl,           /* Get the objects that are already ready               */
+                                     tbl_size,
+                                    &sched);
+    if (nbr_obj_rdy > 0u) {
+        CPU_CRITICAL_EXIT();
+        if (sched == OS_TRUE) {                                 /* A task waiting in OSQPostWait() was readied          */
+            OSSched();
+        }
+       *p_err = OS_ERR_NONE;
+        return (nbr_obj_rdy);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return (0u);
+    }
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't pend when the scheduler is locked              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return (0u);
+    }
+
+    OS_PendMultiWait(p_pend_data_tbl,                           /* Suspend task until object posted or timeout occurs   */
+                     tbl_size,
+                     timeout);
+    CPU_CRITICAL_EXIT();
+
+    OSSched();                                                  /* Find next highest priority task ready                */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* We got one of the objects posted to                  */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that the multi-pend was aborted             */
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get semaphore within timeout */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that an object pended on has been deleted   */
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+
+    nbr_obj_rdy = 0u;
+    p_pend_data = p_pend_data_tbl;
+    for (i = 0u; i < tbl_size; i++) {                           /* Count the object that readied the task, see Note #3  */
+        if (p_pend_data->RdyObjPtr != (OS_PEND_OBJ *)0) {
+            nbr_obj_rdy++;
+        }
+        p_pend_data++;
+    }
+
+    return (nbr_obj_rdy);
+}
+
+
+/*
+************************************************************************************************************************
+*                                 GET HIGHEST PRIORITY TASK WAITING ON AN OBJECT
+*
+* Description: This function returns the highest priority task waiting on an object, whether it waits on this object
+*              alone (.HeadPtr list) or on multiple objects (.MultiHeadPtr list).  Used through OS_PEND_LIST_HEAD_GET().
+*
+* Arguments  : p_pend_list   is a pointer to the pend list of the object
+*              -----------
+*
+* Returns    : A pointer to the OS_TCB of the task, or a NULL pointer if no task is waiting on the object.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Of two tasks of equal priority, the one waiting on the object alone is returned first.
+************************************************************************************************************************
+*/
+
+OS_TCB  *OS_PendMultiHeadGet (OS_PEND_LIST  *p_pend_list)
+{
+    OS_TCB        *p_tcb;
+    OS_PEND_DATA  *p_pend_data;
+
+
+    p_tcb       = p_pend_list->HeadPtr;
+    p_pend_data = p_pend_list->MultiHeadPtr;
+    if (p_pend_data != (OS_PEND_DATA *)0) {
+        if ((p_tcb == (OS_TCB *)0) ||
+            (p_pend_data->TCBPtr->Prio < p_tcb->Prio)) {        /* See Note #2                                          */
+            p_tcb = p_pend_data->TCBPtr;
+        }
+    }
+    return (p_tcb);
+}
+
+
+/*
+************************************************************************************************************************
+*                                      INDICATE WHICH OBJECT READIED A TASK
+*
+* Description: This function is called when an object is posted to, aborted or deleted, before the task waiting on it
+*              is readied.  If the task waits in OSPendMulti(), the entry of its OS_PEND_DATA table for that object
+*              records the object, the message and the timestamp.
+*
+* Arguments  : p_tcb         is a pointer to the OS_TCB of the task about to be readied
+*              -----
+*
+*              p_obj         is a pointer to the object posted to, aborted or deleted
+*
+*              p_void        is a pointer to the message posted, if any
+*
+*              msg_size      is the size of the message posted
+*
+*              ts            is the timestamp of the post, abort or delete
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function does nothing for a task that is not waiting in OSPendMulti().
+************************************************************************************************************************
+*/
+
+void  OS_PendMultiRdy (OS_TCB       *p_tcb,
+                       OS_PEND_OBJ  *p_obj,
+                       void         *p_void,
+                       OS_MSG_SIZE   msg_size,
+                       CPU_TS        ts)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     i;
+
+
+    if (p_tcb->PendOn != OS_TASK_PEND_ON_MULTI) {               /* See Note #2                                          */
+        return;
+    }
+
+    p_pend_data = p_tcb->PendDataTblPtr;
+    for (i = 0u; i < p_tcb->PendDataTblEntries; i++) {
+        if (p_pend_data->PendObjPtr == p_obj) {                 /* Find the entry of the object                         */
+            p_pend_data->RdyObjPtr  = p_obj;
+            p_pend_data->RdyMsgPtr  = p_void;
+            p_pend_data->RdyMsgSize = msg_size;
+            p_pend_data->RdyTS      = ts;
+            break;
+        }
+        p_pend_data++;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                 REMOVE A TASK FROM THE LISTS OF THE OBJECTS PENDED ON
+*
+* Description: This function is called by OS_PendListRemove() to remove a task waiting in OSPendMulti() from the lists
+*              of all the objects it waits on, whether it is readied, timed out, aborted or deleted.
+*
+* Arguments  : p_tcb         is a pointer to the OS_TCB of the task
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_PendMultiRemove (OS_TCB  *p_tcb)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     i;
+
+
+    p_pend_data = p_tcb->PendDataTblPtr;
+    for (i = 0u; i < p_tcb->PendDataTblEntries; i++) {
+        OS_PendMultiUnlink(p_pend_data);
+        p_pend_data++;
+    }
+    p_tcb->PendDataTblPtr     = (OS_PEND_DATA *)0;
+    p_tcb->PendDataTblEntries =                 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                             CHANGE THE PRIORITY OF A TASK PENDING ON MULTIPLE OBJECTS
+*
+* Description: This function is called to move a task waiting in OSPendMulti() to the position of its new priority in
+*              the lists of all the objects it waits on.
+*
+* Arguments  : p_tcb         is a pointer to the OS_TCB of the task, which holds the NEW priority in its .Prio field
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_PendMultiChangePrio (OS_TCB  *p_tcb)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     i;
+
+
+    p_pend_data = p_tcb->PendDataTblPtr;
+    for (i = 0u; i < p_tcb->PendDataTblEntries; i++) {
+        OS_PendMultiUnlink(p_pend_data);                        /* Remove entry from current position                   */
+        OS_PendMultiInsert(p_pend_data);                        /* INSERT it back in the list                           */
+        p_pend_data++;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                      GET THE OBJECTS THAT ARE ALREADY READY
+*
+* Description: This function is called by OSPendMulti() to take all the objects that are ready: a semaphore with a
+*              non-zero count is decremented and the oldest message of a queue is removed.
+*
+* Arguments  : p_pend_data_tbl   is a pointer to the OS_PEND_DATA table
+*
+*              tbl_size          is the number of entries in the table
+*
+*              p_sched           is a pointer to where OS_TRUE is returned if a task was readied, see Note #3
+*
+* Returns    : The number of objects that were ready.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.
+*
+*              3) Taking a message makes room in the queue, which is handed to the tasks waiting in OSQPostWait() as
+*                 OSQPend() does.  The caller must then call the scheduler.
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_PendMultiGetRdy (OS_PEND_DATA  *p_pend_data_tbl,
+                                        OS_OBJ_QTY     tbl_size,
+                                        CPU_BOOLEAN   *p_sched)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_PEND_OBJ   *p_obj;
+    OS_OBJ_QTY     nbr_obj_rdy;
+    OS_OBJ_QTY     i;
+#if (OS_CFG_SEM_EN > 0u)
+    OS_SEM        *p_sem;
+#endif
+#if (OS_CFG_Q_EN > 0u)
+    OS_Q          *p_q;
+    void          *p_msg;
+    OS_MSG_SIZE    msg_size;
+    CPU_TS         ts;
+    OS_ERR         err;
+#endif
+
+
+   *p_sched     = OS_FALSE;
+    nbr_obj_rdy = 0u;
+    p_pend_data = p_pend_data_tbl;
+    for (i = 0u; i < tbl_size; i++) {
+        p_obj = p_pend_data->PendObjPtr;
+        switch (p_obj->Type) {
+#if (OS_CFG_SEM_EN > 0u)
+            case OS_OBJ_TYPE_SEM:
+                 p_sem = (OS_SEM *)((void *)p_obj);
+                 if (p_sem->Ctr > 0u) {                         /* Resource available?                                  */
+                     p_sem->Ctr--;                              /* Yes, caller may proceed                              */
+                     p_pend_data->RdyObjPtr = p_obj;
+#if (OS_CFG_TS_EN > 0u)
+                     p_pend_data->RdyTS     = p_sem->TS;
+#endif
+                     nbr_obj_rdy++;
+                 }
+                 break;
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+            case OS_OBJ_TYPE_Q:
+                 p_q   = (OS_Q *)((void *)p_obj);
+                 p_msg = OS_MsgQGet(&p_q->MsgQ,                 /* Any message waiting in the message queue?            */
+                                    &msg_size,
+                                    &ts,
+                                    &err);
+                 if (err == OS_ERR_NONE) {
+                     p_pend_data->RdyObjPtr  = p_obj;           /* Yes, the caller gets the message                     */
+                     p_pend_data->RdyMsgPtr  = p_msg;
+                     p_pend_data->RdyMsgSize = msg_size;
+                     p_pend_data->RdyTS      = ts;
+                     nbr_obj_rdy++;
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+                     if (OS_QPostWaitRdy(p_q) == OS_TRUE) {     /* Hand the room to the tasks in OSQPostWait()          */
+                        *p_sched = OS_TRUE;
+                     }
+#endif
+                 }
+                 break;
+#endif
+
+            default:
+                 break;
+        }
+        p_pend_data++;
+    }
+    return (nbr_obj_rdy);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          BLOCK THE TASK ON MULTIPLE OBJECTS
+*
+* Description: This function is called by OSPendMulti() to block the current task and to link each entry of its
+*              OS_PEND_DATA table in the list of the object it refers to.
+*
+* Arguments  : p_pend_data_tbl   is a pointer to the OS_PEND_DATA table
+*
+*              tbl_size          is the number of entries in the table
+*
+*              timeout           is the timeout, in ticks, or 0 to wait forever
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  void  OS_PendMultiWait (OS_PEND_DATA  *p_pend_data_tbl,
+                                OS_OBJ_QTY     tbl_size,
+                                OS_TICK        timeout)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     i;
+
+
+    OS_Pend((OS_PEND_OBJ *)0,                                   /* Block the task, no single object pended on           */
+             OSTCBCurPtr,
+             OS_TASK_PEND_ON_MULTI,
+             timeout);
+
+    OSTCBCurPtr->PendDataTblPtr     = p_pend_data_tbl;
+    OSTCBCurPtr->PendDataTblEntries = tbl_size;
+
+    p_pend_data = p_pend_data_tbl;
+    for (i = 0u; i < tbl_size; i++) {
+        p_pend_data->TCBPtr = OSTCBCurPtr;                      /* Every entry points to the TCB of the task pending    */
+        OS_PendMultiInsert(p_pend_data);
+        p_pend_data++;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                    LINK/UNLINK AN ENTRY IN THE MULTI-PEND LIST
+*
+* Description: OS_PendMultiInsert() links an OS_PEND_DATA entry in the multi-pend list of its object, in priority order
+*              of the task waiting.  OS_PendMultiUnlink() removes it from that list.
+*
+* Arguments  : p_pend_data   is a pointer to the entry, with .TCBPtr and .PendObjPtr set
+*              -----------
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) Tasks of equal priority are kept in FIFO order.
+************************************************************************************************************************
+*/
+
+static  void  OS_PendMultiInsert (OS_PEND_DATA  *p_pend_data)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_PEND_DATA  *p_pend_data_prev;
+    OS_PEND_DATA  *p_pend_data_next;
+    OS_PRIO        prio;
+
+
+    p_pend_list      = &p_pend_data->PendObjPtr->PendList;
+    prio             =  p_pend_data->TCBPtr->Prio;
+    p_pend_data_prev = (OS_PEND_DATA *)0;
+    p_pend_data_next =  p_pend_list->MultiHeadPtr;
+    while (p_pend_data_next != (OS_PEND_DATA *)0) {             /* Find the first entry of a lower priority task        */
+        if (p_pend_data_next->TCBPtr->Prio > prio) {            /* See Note #2                                          */
+            break;
+        }
+        p_pend_data_prev = p_pend_data_next;
+        p_pend_data_next = p_pend_data_next->NextPtr;
+    }
+
+    p_pend_data->PrevPtr = p_pend_data_prev;                    /* Insert BEFORE it                                     */
+    p_pend_data->NextPtr = p_pend_data_next;
+    if (p_pend_data_prev == (OS_PEND_DATA *)0) {
+        p_pend_list->MultiHeadPtr = p_pend_data;
+    } else {
+        p_pend_data_prev->NextPtr = p_pend_data;
+    }
+    if (p_pend_data_next != (OS_PEND_DATA *)0) {
+        p_pend_data_next->PrevPtr = p_pend_data;
+    }
+}
+
+
+static  void  OS_PendMultiUnlink (OS_PEND_DATA  *p_pend_data)
+{
+    OS_PEND_LIST  *p_pend_list;
+
+
+    p_pend_list = &p_pend_data->PendObjPtr->PendList;
+    if (p_pend_data->PrevPtr == (OS_PEND_DATA *)0) {
+        p_pend_list->MultiHeadPtr      = p_pend_data->NextPtr;
+    } else {
+        p_pend_data->PrevPtr->NextPtr  = p_pend_data->NextPtr;
+    }
+    if (p_pend_data->NextPtr != (OS_PEND_DATA *)0) {
+        p_pend_data->NextPtr->PrevPtr  = p_pend_data->PrevPtr;
+    }
+    p_pend_data->PrevPtr = (OS_PEND_DATA *)0;
+    p_pend_data->NextPtr = (OS_PEND_DATA *)0;
+}
+#endif
@@ -54,6 +54,11 @@ void  OS_PrioInit (void)
     for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
          OSPrioTbl[i] = 0u;
     }
+#if (OS_CFG_PRIO_MAX > (2u * (CPU_CFG_DATA_SIZE * 8u)))
+    for (i = 0u; i < OS_PRIO_GRP_TBL_SIZE; i++) {
+         OSPrioGrpTbl[i] = 0u;
+    }
+#endif
 
 #if (OS_CFG_TASK_IDLE_EN == 0u)
     OS_PrioInsert ((OS_PRIO)(OS_CFG_PRIO_MAX - 1u));            /* Insert what would be the idle task                   */
@@ -72,6 +77,10 @@ void  OS_PrioInit (void)
 * Returns    : The priority of the Highest Priority Task (HPT) waiting for the event
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) When the bitmap table spans more than two CPU_DATA entries, OSPrioGrpTbl[] holds one bit per non-empty
+*                 entry of OSPrioTbl[] so that the highest priority is found with two leading zero counts, as long as
+*                 OS_CFG_PRIO_MAX does not exceed the square of the number of bits in CPU_DATA.
 ************************************************************************************************************************
 */
 
@@ -90,19 +99,19 @@ OS_PRIO  OS_PrioGetHighest (void)
 
 
 #else
-    CPU_DATA  *p_tbl;
-    OS_PRIO    prio;
+    CPU_DATA  *p_grp;
+    OS_PRIO    ix;
 
 
-    prio  = 0u;
-    p_tbl = &OSPrioTbl[0];
-    while (*p_tbl == 0u) {                                      /* Search the bitmap table for the highest priority     */
-        prio = (OS_PRIO)(prio + (CPU_CFG_DATA_SIZE * 8u));      /* Compute the step of each CPU_DATA entry              */
-        p_tbl++;
+    ix    = 0u;
+    p_grp = &OSPrioGrpTbl[0];
+    while (*p_grp == 0u) {                                      /* Search the group table for the highest priority      */
+        ix = (OS_PRIO)(ix + (CPU_CFG_DATA_SIZE * 8u));          /* Compute the step of each CPU_DATA entry              */
+        p_grp++;
     }
-    prio += (OS_PRIO)CPU_CntLeadZeros(*p_tbl);                  /* Find the position of the first bit set at the entry  */
+    ix += (OS_PRIO)CPU_CntLeadZeros(*p_grp);                    /* Find the first non-empty entry of the bitmap table   */
 
-    return (prio);
+    return ((OS_PRIO)((ix * (CPU_CFG_DATA_SIZE * 8u)) + (OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[ix])));
 #endif
 }
 
@@ -141,6 +150,10 @@ void  OS_PrioInsert (OS_PRIO  prio)
     ix             = (OS_PRIO)(prio /  (CPU_CFG_DATA_SIZE * 8u));
     bit_nbr        = (CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
     OSPrioTbl[ix] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr);
+
+    bit_nbr        = (CPU_DATA)ix   & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
+    ix             = (OS_PRIO)(ix   /  (CPU_CFG_DATA_SIZE * 8u));
+    OSPrioGrpTbl[ix] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr);
 #endif
 }
 
@@ -179,5 +192,11 @@ void  OS_PrioRemove (OS_PRIO  prio)
     ix             =   (OS_PRIO)(prio  /   (CPU_CFG_DATA_SIZE * 8u));
     bit_nbr        =   (CPU_DATA)prio  &  ((CPU_CFG_DATA_SIZE * 8u) - 1u);
     OSPrioTbl[ix] &= ~((CPU_DATA)  1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr));
+
+    if (OSPrioTbl[ix] == 0u) {                                  /* Last priority of this entry? Update the group table  */
+        bit_nbr           =   (CPU_DATA)ix    &  ((CPU_CFG_DATA_SIZE * 8u) - 1u);
+        ix                =   (OS_PRIO)(ix    /   (CPU_CFG_DATA_SIZE * 8u));
+        OSPrioGrpTbl[ix] &= ~((CPU_DATA)  1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr));
+    }
 #endif
 }
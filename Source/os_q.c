@@ -32,6 +32,19 @@ const  CPU_CHAR  *os_q__c = "$Id: $";
 
 
 #if (OS_CFG_Q_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_QCreate (OS_Q        *p_q,
+                          CPU_CHAR    *p_name,
+                          OS_MSG      *p_ring,
+                          OS_MSG_QTY   max_qty,
+                          OS_ERR      *p_err);
+
+
 /*
 ************************************************************************************************************************
 *                                               CREATE A MESSAGE QUEUE
@@ -68,9 +81,59 @@ void  OSQCreate (OS_Q        *p_q,
                  OS_ERR      *p_err)
 
 {
-    CPU_SR_ALLOC();
+    OS_QCreate(p_q,
+               p_name,
+               (OS_MSG *)0,                                     /* Take the messages from OSMsgPool                     */
+               max_qty,
+               p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            CREATE A RING MESSAGE QUEUE
+*
+* Description: This function is called by your application to create a message queue which stores its messages in a
+*              ring of OS_MSGs that you supply, instead of taking them from the OS_MSG pool.  Posting to and pending on
+*              the queue only moves its in and out pointers through the ring, and the queue never competes with other
+*              queues for OS_MSGs.
+*
+* Arguments  : p_q         is a pointer to the message queue
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the message queue
+*
+*              p_ring      is a pointer to an array of 'max_qty' OS_MSGs which holds the messages of the queue.  The
+*                          array belongs to the queue until the queue is deleted.
+*
+*              max_qty     indicates the maximum size of the message queue (must be non-zero)
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the Queue after you called
+*                                                               OSSafetyCriticalStart()
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_q'
+*                              OS_ERR_PTR_INVALID             If you passed a NULL pointer for 'p_ring'
+*                              OS_ERR_Q_SIZE                  If the size you specified is 0
+*                              OS_ERR_OBJ_CREATED             If the message queue was already created
+*
+* Returns    : none
+*
+* Note(s)    : 1) The queue is used with the same OSQ...() services as a queue created by OSQCreate().
+*
+*              2) The other arguments are checked, and the queue initialized, as by OSQCreate().
+************************************************************************************************************************
+*/
 
+#if (OS_CFG_Q_RING_EN > 0u)
+void  OSQCreateRing (OS_Q        *p_q,
+                     CPU_CHAR    *p_name,
+                     OS_MSG      *p_ring,
+                     OS_MSG_QTY   max_qty,
+                     OS_ERR      *p_err)
 
+{
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -78,59 +141,20 @@ void  OSQCreate (OS_Q        *p_q,
     }
 #endif
 
-#ifdef OS_SAFETY_CRITICAL_IEC61508
-    if (OSSafetyCriticalStartFlag == OS_TRUE) {
-       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
-        return;
-    }
-#endif
-
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
-    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
-       *p_err = OS_ERR_CREATE_ISR;
-        return;
-    }
-#endif
-
 #if (OS_CFG_ARG_CHK_EN > 0u)
-    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
-       *p_err = OS_ERR_OBJ_PTR_NULL;
-        return;
-    }
-    if (max_qty == 0u) {                                        /* Cannot specify a zero size queue                     */
-       *p_err = OS_ERR_Q_SIZE;
-        return;
-    }
-#endif
-
-    CPU_CRITICAL_ENTER();
-#if (OS_OBJ_TYPE_REQ > 0u)
-#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
-    if (p_q->Type == OS_OBJ_TYPE_Q) {
-        CPU_CRITICAL_EXIT();
-        *p_err = OS_ERR_OBJ_CREATED;
+    if (p_ring == (OS_MSG *)0) {                                /* Must supply the storage of the ring                  */
+       *p_err = OS_ERR_PTR_INVALID;
         return;
     }
 #endif
-    p_q->Type    = OS_OBJ_TYPE_Q;                               /* Mark the data structure as a message queue           */
-#endif
-#if (OS_CFG_DBG_EN > 0u)
-    p_q->NamePtr = p_name;
-#else
-    (void)p_name;
-#endif
-    OS_MsgQInit(&p_q->MsgQ,                                     /* Initialize the queue                                 */
-                max_qty);
-    OS_PendListInit(&p_q->PendList);                            /* Initialize the waiting list                          */
 
-#if (OS_CFG_DBG_EN > 0u)
-    OS_QDbgListAdd(p_q);
-    OSQQty++;                                                   /* One more queue created                               */
-#endif
-    OS_TRACE_Q_CREATE(p_q, p_name);
-    CPU_CRITICAL_EXIT();
-   *p_err = OS_ERR_NONE;
+    OS_QCreate(p_q,
+               p_name,
+               p_ring,
+               max_qty,
+               p_err);
 }
+#endif
 
 
 /*
@@ -167,6 +191,8 @@ void  OSQCreate (OS_Q        *p_q,
 *
 *              2) Because ALL tasks pending on the queue will be readied, you MUST be careful in applications where the
 *                 queue is used for mutual exclusion because the resource(s) will no longer be guarded by the queue.
+*
+*              3) Tasks blocked in OSQPostWait() on the queue are waiting tasks too, and are readied with OS_ERR_OBJ_DEL.
 ************************************************************************************************************************
 */
 
@@ -236,7 +262,12 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
     nbr_tasks   = 0u;
     switch (opt) {
         case OS_OPT_DEL_NO_PEND:                                /* Delete message queue only if no task waiting         */
-             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+             if ((OS_PEND_LIST_HEAD_GET(p_pend_list)                == (OS_TCB *)0) &&
+                 (OS_PEND_LIST_HEAD_GET(&p_q->PostPendObj.PendList) == (OS_TCB *)0)) {
+#else
+             if (OS_PEND_LIST_HEAD_GET(p_pend_list) == (OS_TCB *)0) {
+#endif
 #if (OS_CFG_DBG_EN > 0u)
                  OS_QDbgListRemove(p_q);
                  OSQQty--;
@@ -257,13 +288,30 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
 #else
              ts = 0u;
 #endif
-             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks from the pend list                  */
-                 p_tcb = p_pend_list->HeadPtr;
+             while (OS_PEND_LIST_HEAD_GET(p_pend_list) != (OS_TCB *)0) { /* Remove all tasks from the pend list         */
+                 p_tcb = OS_PEND_LIST_HEAD_GET(p_pend_list);
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+                 OS_PendMultiRdy(p_tcb,
+                                 (OS_PEND_OBJ *)((void *)p_q),
+                                 (void *)0,
+                                 0u,
+                                 ts);
+#endif
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+             p_pend_list = &p_q->PostPendObj.PendList;          /* Also ready the tasks waiting for room, see Note #3   */
+             while (OS_PEND_LIST_HEAD_GET(p_pend_list) != (OS_TCB *)0) {
+                 p_tcb = OS_PEND_LIST_HEAD_GET(p_pend_list);
                  OS_PendAbort(p_tcb,
                               ts,
                               OS_STATUS_PEND_DEL);
                  nbr_tasks++;
              }
+#endif
 #if (OS_CFG_DBG_EN > 0u)
              OS_QDbgListRemove(p_q);
              OSQQty--;
@@ -309,6 +357,9 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
 *                  references to what the queue entries are pointing to and thus, you could cause 'memory leaks'.  In
 *                  other words, the data you are pointing to that's being referenced by the queue entries should, most
 *                  likely, need to be de-allocated (i.e. freed).
+*
+*               2) Tasks blocked in OSQPostWait() on the queue then get the room freed, so the queue can hold their
+*                  messages again when this function returns.
 ************************************************************************************************************************
 */
 
@@ -316,7 +367,10 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
 OS_MSG_QTY  OSQFlush (OS_Q    *p_q,
                       OS_ERR  *p_err)
 {
-    OS_MSG_QTY  entries;
+    OS_MSG_QTY   entries;
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    CPU_BOOLEAN  sched;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -358,7 +412,15 @@ OS_MSG_QTY  OSQFlush (OS_Q    *p_q,
 
     CPU_CRITICAL_ENTER();
     entries = OS_MsgQFreeAll(&p_q->MsgQ);                       /* Return all OS_MSGs to the OS_MSG pool                */
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    sched   = OS_QPostWaitRdy(p_q);                             /* Hand the room to the tasks waiting, see Note #2      */
+    CPU_CRITICAL_EXIT();
+    if (sched == OS_TRUE) {
+        OSSched();
+    }
+#else
     CPU_CRITICAL_EXIT();
+#endif
    *p_err   = OS_ERR_NONE;
     return (entries);
 }
@@ -512,7 +574,16 @@ void  *OSQPend (OS_Q         *p_q,
                         p_err);
     if (*p_err == OS_ERR_NONE) {
         OS_TRACE_Q_PEND(p_q);
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+        if (OS_QPostWaitRdy(p_q) == OS_TRUE) {                  /* Hand the room to a task waiting in OSQPostWait()     */
+            CPU_CRITICAL_EXIT();
+            OSSched();
+        } else {
+            CPU_CRITICAL_EXIT();
+        }
+#else
         CPU_CRITICAL_EXIT();
+#endif
         OS_TRACE_Q_PEND_EXIT(OS_ERR_NONE);
         return (p_void);                                        /* Yes, Return message received                         */
     }
@@ -693,7 +764,7 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
 
     CPU_CRITICAL_ENTER();
     p_pend_list = &p_q->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on queue?                           */
+    if (OS_PEND_LIST_HEAD_GET(p_pend_list) == (OS_TCB *)0) {    /* Any task waiting on queue?                           */
         CPU_CRITICAL_EXIT();                                    /* No                                                   */
        *p_err =  OS_ERR_PEND_ABORT_NONE;
         return (0u);
@@ -705,8 +776,15 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
 #else
     ts        = 0u;
 #endif
-    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
-        p_tcb = p_pend_list->HeadPtr;
+    while (OS_PEND_LIST_HEAD_GET(p_pend_list) != (OS_TCB *)0) {
+        p_tcb = OS_PEND_LIST_HEAD_GET(p_pend_list);
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+        OS_PendMultiRdy(p_tcb,
+                        (OS_PEND_OBJ *)((void *)p_q),
+                        (void *)0,
+                        0u,
+                        ts);
+#endif
         OS_PendAbort(p_tcb,
                      ts,
                      OS_STATUS_PEND_ABORT);
@@ -729,171 +807,908 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
 
 /*
 ************************************************************************************************************************
-*                                               POST MESSAGE TO A QUEUE
+*                                       PEND ON A QUEUE FOR A BATCH OF MESSAGES
 *
-* Description: This function sends a message to a queue.  With the 'opt' argument, you can specify whether the message
-*              is broadcast to all waiting tasks and/or whether you post the message to the front of the queue (LIFO)
-*              or normally (FIFO) at the end of the queue.
+* Description: This function receives up to 'nbr_msgs' messages from a queue in a single call, waiting for the first
+*              one if the queue is empty.
 *
-* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+* Arguments  : p_q             is a pointer to the message queue
 *
-*              p_void        is a pointer to the message to send.
+*              p_void_tbl      is a pointer to a table of 'nbr_msgs' entries that will receive the messages, oldest
+*                              first (or as placed in the queue with OS_OPT_POST_LIFO)
 *
-*              msg_size      specifies the size of the message (in bytes)
+*              p_msg_size_tbl  is a pointer to a table of 'nbr_msgs' entries that will receive the size of each message
 *
-*              opt           determines the type of POST performed:
+*              nbr_msgs        is the maximum number of messages to receive
 *
-*                                OS_OPT_POST_ALL          POST to ALL tasks that are waiting on the queue.  This option
-*                                                         can be added to either OS_OPT_POST_FIFO or OS_OPT_POST_LIFO
-*                                OS_OPT_POST_FIFO         POST message to end of queue (FIFO) and wake up a single
-*                                                         waiting task.
-*                                OS_OPT_POST_LIFO         POST message to the front of the queue (LIFO) and wake up
-*                                                         a single waiting task.
-*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*              timeout         is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                              message to arrive at the queue up to the amount of time specified by this argument.  If
+*                              you specify 0, however, your task will wait forever at the specified queue or, until a
+*                              message arrives.
 *
-*                            Note(s): 1) OS_OPT_POST_NO_SCHED can be added (or OR'd) with one of the other options.
-*                                     2) OS_OPT_POST_ALL      can be added (or OR'd) with one of the other options.
-*                                     3) Possible combination of options are:
+*              opt             determines whether the user wants to block if the queue is empty or not:
 *
-*                                        OS_OPT_POST_FIFO
-*                                        OS_OPT_POST_LIFO
-*                                        OS_OPT_POST_FIFO + OS_OPT_POST_ALL
-*                                        OS_OPT_POST_LIFO + OS_OPT_POST_ALL
-*                                        OS_OPT_POST_FIFO + OS_OPT_POST_NO_SCHED
-*                                        OS_OPT_POST_LIFO + OS_OPT_POST_NO_SCHED
-*                                        OS_OPT_POST_FIFO + OS_OPT_POST_ALL + OS_OPT_POST_NO_SCHED
-*                                        OS_OPT_POST_LIFO + OS_OPT_POST_ALL + OS_OPT_POST_NO_SCHED
+*                                  OS_OPT_PEND_BLOCKING
+*                                  OS_OPT_PEND_NON_BLOCKING
 *
-*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*              p_ts            is a pointer to a variable that will receive the timestamp of when the last message was
+*                              received, pend aborted or the message queue deleted.  If you pass a NULL pointer (i.e.
+*                              (CPU_TS *)0) then you will not get the timestamp.
 *
-*                                OS_ERR_NONE              The call was successful and the message was sent
-*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place the message into
-*                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
-*                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
-*                                OS_ERR_OPT_INVALID       You specified an invalid option
-*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
-*                                OS_ERR_Q_MAX             If the queue is full
+*              p_err           is a pointer to a variable that will contain an error code returned by this function.
 *
-* Returns    : None
+*                                  OS_ERR_NONE               The call was successful and your task received at least
+*                                                            one message, or 'nbr_msgs' is 0
+*                                  OS_ERR_OBJ_DEL            If 'p_q' was deleted
+*                                  OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_q'
+*                                  OS_ERR_OBJ_TYPE           If the message queue was not created
+*                                  OS_ERR_OPT_INVALID        You specified an invalid option
+*                                  OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                  OS_ERR_PEND_ABORT         The pend was aborted
+*                                  OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                  OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was empty
+*                                  OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_void_tbl' or
+*                                                            'p_msg_size_tbl'
+*                                  OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                  OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                  OS_ERR_TIMEOUT            A message was not received within the specified timeout
+*                                  OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
 *
-* Note(s)    : none
+* Returns    : The number of messages received.
+*
+* Note(s)    : 1) The messages are taken from the queue in a single critical section.  When the task had to wait, it
+*                 receives the message that readied it, followed by the messages queued before it got to run.
+*
+*              2) This API 'MUST NOT' be called from a timer callback function.
 ************************************************************************************************************************
 */
 
-void  OSQPost (OS_Q         *p_q,
-               void         *p_void,
-               OS_MSG_SIZE   msg_size,
-               OS_OPT        opt,
-               OS_ERR       *p_err)
+#if (OS_CFG_Q_MULTI_EN > 0u)
+OS_MSG_QTY  OSQPendMulti (OS_Q          *p_q,
+                          void         **p_void_tbl,
+                          OS_MSG_SIZE   *p_msg_size_tbl,
+                          OS_MSG_QTY     nbr_msgs,
+                          OS_TICK        timeout,
+                          OS_OPT         opt,
+                          CPU_TS        *p_ts,
+                          OS_ERR        *p_err)
 {
-    OS_OPT         post_type;
-    OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    OS_TCB        *p_tcb_next;
-    CPU_TS         ts;
+    OS_MSG_QTY   nbr_rxd;
+    OS_ERR       err;
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    CPU_BOOLEAN  sched;
+#endif
     CPU_SR_ALLOC();
 
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return;
+        return (0u);
     }
 #endif
 
-    OS_TRACE_Q_POST_ENTER(p_q, p_void, msg_size, opt);
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return (0u);
+        }
+    }
+#endif
 
 #if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
     if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
-        OS_TRACE_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
        *p_err = OS_ERR_OS_NOT_RUNNING;
-        return;
+        return (0u);
     }
 #endif
 
 #if (OS_CFG_ARG_CHK_EN > 0u)
-    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
-        OS_TRACE_Q_POST_FAILED(p_q);
-        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
        *p_err = OS_ERR_OBJ_PTR_NULL;
-        return;
+        return (0u);
     }
-    switch (opt) {                                              /* Validate 'opt'                                       */
-        case OS_OPT_POST_FIFO:
-        case OS_OPT_POST_LIFO:
-        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
-        case OS_OPT_POST_LIFO | OS_OPT_POST_ALL:
-        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
-        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
-        case OS_OPT_POST_FIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
-        case OS_OPT_POST_LIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+    if ((p_void_tbl     == (void      **)0) ||
+        (p_msg_size_tbl == (OS_MSG_SIZE *)0)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
              break;
 
         default:
-             OS_TRACE_Q_POST_FAILED(p_q);
-             OS_TRACE_Q_POST_EXIT(OS_ERR_OPT_INVALID);
-            *p_err =  OS_ERR_OPT_INVALID;
-             return;
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
     }
 #endif
 
 #if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
     if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
-        OS_TRACE_Q_POST_FAILED(p_q);
-        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_TYPE);
        *p_err = OS_ERR_OBJ_TYPE;
-        return;
+        return (0u);
     }
 #endif
-#if (OS_CFG_TS_EN > 0u)
-    ts = OS_TS_GET();                                           /* Get timestamp                                        */
-#else
-    ts = 0u;
-#endif
 
-    OS_TRACE_Q_POST(p_q);
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
+    }
 
+    if (nbr_msgs == 0u) {                                       /* Nothing to receive                                   */
+       *p_err = OS_ERR_NONE;
+        return (0u);
+    }
+
+    nbr_rxd = 0u;
     CPU_CRITICAL_ENTER();
-    p_pend_list = &p_q->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on message queue?                   */
-        if ((opt & OS_OPT_POST_LIFO) == 0u) {                   /* Determine whether we post FIFO or LIFO               */
-            post_type = OS_OPT_POST_FIFO;
-        } else {
-            post_type = OS_OPT_POST_LIFO;
+    while (nbr_rxd < nbr_msgs) {                                /* Take the messages waiting in the message queue       */
+        p_void_tbl[nbr_rxd] = OS_MsgQGet(&p_q->MsgQ,
+                                         &p_msg_size_tbl[nbr_rxd],
+                                         p_ts,
+                                         &err);
+        if (err != OS_ERR_NONE) {
+            break;
         }
-        OS_MsgQPut(&p_q->MsgQ,                                  /* Place message in the message queue                   */
-                   p_void,
-                   msg_size,
-                   post_type,
-                   ts,
-                   p_err);
+        nbr_rxd++;
+    }
+    if (nbr_rxd > 0u) {
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+        sched = OS_QPostWaitRdy(p_q);                           /* Hand the room to the tasks in OSQPostWait()          */
         CPU_CRITICAL_EXIT();
-        OS_TRACE_Q_POST_EXIT(*p_err);
-        return;
+        if (sched == OS_TRUE) {
+            OSSched();
+        }
+#else
+        CPU_CRITICAL_EXIT();
+#endif
+       *p_err = OS_ERR_NONE;
+        return (nbr_rxd);
     }
 
-    p_tcb = p_pend_list->HeadPtr;
-    while (p_tcb != (OS_TCB *)0) {
-        p_tcb_next = p_tcb->PendNextPtr;
-        OS_Post((OS_PEND_OBJ *)((void *)p_q),
-                p_tcb,
-                p_void,
-                msg_size,
-                ts);
-        if ((opt & OS_OPT_POST_ALL) == 0u)  {                   /* Post message to all tasks waiting?                   */
-            break;                                              /* No                                                   */
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return (0u);
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
         }
-        p_tcb = p_tcb_next;
     }
 
-    CPU_CRITICAL_EXIT();
-
-    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+    OS_Pend((OS_PEND_OBJ *)((void *)p_q),                       /* Block task pending on Message Queue                  */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_Q,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    sched = OS_FALSE;
+#endif
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Extract message from TCB (Put there by Post)         */
+             p_void_tbl[0]     = OSTCBCurPtr->MsgPtr;
+             p_msg_size_tbl[0] = OSTCBCurPtr->MsgSize;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+             nbr_rxd = 1u;
+             while (nbr_rxd < nbr_msgs) {                       /* Also take the messages queued since, see Note #1     */
+                 p_void_tbl[nbr_rxd] = OS_MsgQGet(&p_q->MsgQ,
+                                                  &p_msg_size_tbl[nbr_rxd],
+                                                  p_ts,
+                                                  &err);
+                 if (err != OS_ERR_NONE) {
+                     break;
+                 }
+                 nbr_rxd++;
+             }
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+             sched  = OS_QPostWaitRdy(p_q);
+#endif
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get event within TO          */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    if (sched == OS_TRUE) {
+        OSSched();
+    }
+#endif
+    return (nbr_rxd);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               POST MESSAGE TO A QUEUE
+*
+* Description: This function sends a message to a queue.  With the 'opt' argument, you can specify whether the message
+*              is broadcast to all waiting tasks and/or whether you post the message to the front of the queue (LIFO)
+*              or normally (FIFO) at the end of the queue.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_void        is a pointer to the message to send.
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_ALL          POST to ALL tasks that are waiting on the queue.  This option
+*                                                         can be added to either OS_OPT_POST_FIFO or OS_OPT_POST_LIFO
+*                                OS_OPT_POST_FIFO         POST message to end of queue (FIFO) and wake up a single
+*                                                         waiting task.
+*                                OS_OPT_POST_LIFO         POST message to the front of the queue (LIFO) and wake up
+*                                                         a single waiting task.
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*                            Note(s): 1) OS_OPT_POST_NO_SCHED can be added (or OR'd) with one of the other options.
+*                                     2) OS_OPT_POST_ALL      can be added (or OR'd) with one of the other options.
+*                                     3) Possible combination of options are:
+*
+*                                        OS_OPT_POST_FIFO
+*                                        OS_OPT_POST_LIFO
+*                                        OS_OPT_POST_FIFO + OS_OPT_POST_ALL
+*                                        OS_OPT_POST_LIFO + OS_OPT_POST_ALL
+*                                        OS_OPT_POST_FIFO + OS_OPT_POST_NO_SCHED
+*                                        OS_OPT_POST_LIFO + OS_OPT_POST_NO_SCHED
+*                                        OS_OPT_POST_FIFO + OS_OPT_POST_ALL + OS_OPT_POST_NO_SCHED
+*                                        OS_OPT_POST_LIFO + OS_OPT_POST_ALL + OS_OPT_POST_NO_SCHED
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the message was sent
+*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place the message into
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_Q_MAX             If the queue (or the queue set of the queue) is full
+*                                OS_ERR_INT_Q_FULL        If the ISR queue is full, when posts from ISRs are deferred
+*
+* Returns    : None
+*
+* Note(s)    : 1) When the queue is a member of a queue set and no task waits on it, the message is announced to the
+*                 queue set.  The message is not queued when the queue set cannot take the announcement.
+************************************************************************************************************************
+*/
+
+void  OSQPost (OS_Q         *p_q,
+               void         *p_void,
+               OS_MSG_SIZE   msg_size,
+               OS_OPT        opt,
+               OS_ERR       *p_err)
+{
+    CPU_BOOLEAN    sched;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_TRACE_Q_POST_ENTER(p_q, p_void, msg_size, opt);
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_FIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+        case OS_OPT_POST_LIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+             break;
+
+        default:
+             OS_TRACE_Q_POST_FAILED(p_q);
+             OS_TRACE_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Defer posts made from ISRs to the ISR handler task   */
+        OS_IntQPost(OS_OBJ_TYPE_Q,
+                    (void *)p_q,
+                    p_void,
+                    msg_size,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_Q_POST_EXIT(*p_err);
+        return;
+    }
+#if (OS_CFG_TS_EN > 0u)
+    if (OSTCBCurPtr == &OSIntQTaskTCB) {                        /* Keep the time stamp of a replayed ISR post           */
+        ts = OSIntQTaskTS;
+    }
+#endif
+#endif
+
+    OS_TRACE_Q_POST(p_q);
+
+    OS_CRITICAL_ENTER();
+    sched = OS_QPost(p_q,                                       /* Post to a waiting task or into the queue             */
+                     p_void,
+                     msg_size,
+                     opt,
+                     ts,
+                     p_err);
+    OS_CRITICAL_EXIT();
+
+    if ((sched == OS_TRUE) &&
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
         OSSched();                                              /* Run the scheduler                                    */
     }
 
+    OS_TRACE_Q_POST_EXIT(*p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                         POST A BATCH OF MESSAGES TO A QUEUE
+*
+* Description: This function sends up to 'nbr_msgs' messages to a queue in a single call.  Each message goes, in table
+*              order, to the highest priority task waiting on the queue or, once no task waits, into the queue.
+*
+* Arguments  : p_q             is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_void_tbl      is a pointer to a table of the 'nbr_msgs' messages to send.
+*
+*              p_msg_size_tbl  is a pointer to a table of the sizes (in bytes) of the messages.  If you pass a NULL
+*                              pointer (i.e. (OS_MSG_SIZE *)0), the messages are sent with a size of 0.
+*
+*              nbr_msgs        is the number of messages to send.
+*
+*              opt             determines the type of POST performed:
+*
+*                                  OS_OPT_POST_FIFO         POST messages to end of queue (FIFO)
+*                                  OS_OPT_POST_LIFO         POST messages to the front of the queue (LIFO), so that the
+*                                                           last message of the table is received first
+*                                  OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*                              Note(s): 1) OS_OPT_POST_NO_SCHED can be added (or OR'd) with one of the other options.
+*                                       2) OS_OPT_POST_ALL is not allowed.
+*
+*              p_err           is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                  OS_ERR_NONE              The call was successful and all the messages were sent
+*                                  OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place a message into
+*                                  OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
+*                                  OS_ERR_OBJ_TYPE          If the message queue was not initialized
+*                                  OS_ERR_OPT_INVALID       You specified an invalid option
+*                                  OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                  OS_ERR_PTR_INVALID       If you passed a NULL pointer for 'p_void_tbl'
+*                                  OS_ERR_Q_MAX             If the queue (or the queue set of the queue) is full
+*                                  OS_ERR_INT_Q_FULL        If the ISR queue is full, when posts from ISRs are deferred
+*
+* Returns    : The number of messages sent.  On an error, the messages that follow in the table are not sent.
+*
+* Note(s)    : 1) All the messages are sent in a single critical section and the scheduler runs at most once, after
+*                 the last message.  Interrupts stay disabled for the whole batch, so 'nbr_msgs' should be kept small
+*                 enough for the interrupt latency of the application.
+*
+*              2) When the queue is a member of a queue set and no task waits on it, each message is announced to the
+*                 queue set, as with OSQPost().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_MULTI_EN > 0u)
+OS_MSG_QTY  OSQPostMulti (OS_Q          *p_q,
+                          void         **p_void_tbl,
+                          OS_MSG_SIZE   *p_msg_size_tbl,
+                          OS_MSG_QTY     nbr_msgs,
+                          OS_OPT         opt,
+                          OS_ERR        *p_err)
+{
+    OS_MSG_QTY   nbr_posted;
+    OS_MSG_SIZE  msg_size;
+    CPU_BOOLEAN  sched;
+    CPU_TS       ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_void_tbl == (void **)0) {                             /* Validate 'p_void_tbl'                                */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    nbr_posted = 0u;
+   *p_err      = OS_ERR_NONE;
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Defer posts made from ISRs to the ISR handler task   */
+        while (nbr_posted < nbr_msgs) {
+            if (p_msg_size_tbl != (OS_MSG_SIZE *)0) {
+                msg_size = p_msg_size_tbl[nbr_posted];
+            } else {
+                msg_size = 0u;
+            }
+            OS_IntQPost(OS_OBJ_TYPE_Q,
+                        (void *)p_q,
+                        p_void_tbl[nbr_posted],
+                        msg_size,
+                        0u,
+                        opt,
+                        ts,
+                        p_err);
+            if (*p_err != OS_ERR_NONE) {
+                break;
+            }
+            nbr_posted++;
+        }
+        return (nbr_posted);
+    }
+#if (OS_CFG_TS_EN > 0u)
+    if (OSTCBCurPtr == &OSIntQTaskTCB) {                        /* Keep the time stamp of a replayed ISR post           */
+        ts = OSIntQTaskTS;
+    }
+#endif
+#endif
+
+    sched = OS_FALSE;
+    OS_CRITICAL_ENTER();
+    while (nbr_posted < nbr_msgs) {
+        if (p_msg_size_tbl != (OS_MSG_SIZE *)0) {
+            msg_size = p_msg_size_tbl[nbr_posted];
+        } else {
+            msg_size = 0u;
+        }
+        if (OS_QPost(p_q,                                       /* Post to a waiting task or into the queue             */
+                     p_void_tbl[nbr_posted],
+                     msg_size,
+                     opt,
+                     ts,
+                     p_err) == OS_TRUE) {
+            sched = OS_TRUE;
+        }
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+        nbr_posted++;
+    }
+    OS_CRITICAL_EXIT();
+
+    if ((sched == OS_TRUE) &&
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();                                              /* Run the scheduler once for the batch                 */
+    }
+
+    return (nbr_posted);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                   POST MESSAGE TO A QUEUE, WAITING FOR ROOM IF FULL
+*
+* Description: This function sends a message to a queue as OSQPost() does but, when the queue is full, the calling task
+*              waits for room instead of getting OS_ERR_Q_MAX.  This lets a consumer slow its producers down
+*              (back-pressure) without them polling the queue.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_void        is a pointer to the message to send.
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for room
+*                            in the queue up to the amount of time specified by this argument.  If you specify 0,
+*                            however, your task will wait forever or, until there is room in the queue.
+*
+*              opt           determines the type of POST performed, as with OSQPost():
+*
+*                                OS_OPT_POST_ALL          POST to ALL tasks that are waiting on the queue
+*                                OS_OPT_POST_FIFO         POST message to end of queue (FIFO)
+*                                OS_OPT_POST_LIFO         POST message to the front of the queue (LIFO)
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the message was sent
+*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place the message into
+*                                OS_ERR_OBJ_DEL           If 'p_q' was deleted while the task waited
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT        If the wait for room was aborted
+*                                OS_ERR_PEND_ISR          If you called this function from an ISR
+*                                OS_ERR_Q_MAX             If the queue set of the queue is full
+*                                OS_ERR_SCHED_LOCKED      If the queue is full and the scheduler is locked
+*                                OS_ERR_STATUS_INVALID    If the pend status has an invalid value
+*                                OS_ERR_TICK_DISABLED     If kernel ticks are disabled and a timeout is specified
+*                                OS_ERR_TIMEOUT           If there was no room in the queue within the timeout
+*
+* Returns    : None
+*
+* Note(s)    : 1) The tasks waiting for room are kept in priority order.  Each time a message leaves the queue, through
+*                 OSQPend(), OSQPendMulti() or OSQFlush(), the message of the highest priority task waiting is placed
+*                 in the queue and that task is readied.  A task does not get ahead of the tasks already waiting, even
+*                 when there is room when it posts.
+*
+*              2) When the OS_MSG pool or the queue set of the queue cannot take the message of a waiting task, the
+*                 task keeps waiting, until a later message leaves the queue or its timeout expires.
+*
+*              3) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+void  OSQPostWait (OS_Q         *p_q,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_TICK       timeout,
+                   OS_OPT        opt,
+                   OS_ERR       *p_err)
+{
+    CPU_BOOLEAN    sched;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_FIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+        case OS_OPT_POST_LIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if ((OS_PEND_LIST_HEAD_GET(&p_q->PendList) != (OS_TCB *)0) ||
+        ((p_q->MsgQ.NbrEntries < p_q->MsgQ.NbrEntriesSize) &&
+         (OS_PEND_LIST_HEAD_GET(&p_q->PostPendObj.PendList) == (OS_TCB *)0))) {
+        sched = OS_QPost(p_q,                                   /* Post to a waiting task or into the room left         */
+                         p_void,
+                         msg_size,
+                         opt,
+                         ts,
+                         p_err);
+        CPU_CRITICAL_EXIT();
+        if ((sched == OS_TRUE) &&
+            ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+            OSSched();                                          /* Run the scheduler                                    */
+        }
+        return;
+    }
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't wait when the scheduler is locked              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    OSTCBCurPtr->MsgPtr  = p_void;                              /* Keep the message until there is room, see Note #1    */
+    OSTCBCurPtr->MsgSize = msg_size;
+    OSTCBCurPtr->PostOpt = opt;
+    OS_Pend(&p_q->PostPendObj,                                  /* Block task waiting for room in the queue             */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_Q_POST,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* The message was placed in the queue                  */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that there was no room within TO            */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          CREATE A MESSAGE QUEUE ON ITS STORAGE
+*
+* Description: This function is called by OSQCreate() and OSQCreateRing() to check their arguments and to initialize the
+*              message queue.
+*
+* Arguments  : p_q         is a pointer to the message queue
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the message queue
+*
+*              p_ring      is a pointer to the ring of OS_MSGs of the queue, or a NULL pointer to use OSMsgPool
+*
+*              max_qty     indicates the maximum size of the message queue
+*
+*              p_err       is a pointer to a variable that will contain an error code, see OSQCreate()
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_QCreate (OS_Q        *p_q,
+                          CPU_CHAR    *p_name,
+                          OS_MSG      *p_ring,
+                          OS_MSG_QTY   max_qty,
+                          OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (max_qty == 0u) {                                        /* Cannot specify a zero size queue                     */
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_q->Type == OS_OBJ_TYPE_Q) {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_q->Type    = OS_OBJ_TYPE_Q;                               /* Mark the data structure as a message queue           */
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    p_q->PostPendObj.Type       = OS_OBJ_TYPE_Q;
+#endif
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_q->NamePtr = p_name;
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    p_q->PostPendObj.NamePtr    = p_name;
+    p_q->PostPendObj.DbgNamePtr = (CPU_CHAR *)((void *)" ");
+#endif
+#else
+    (void)p_name;
+#endif
+#if (OS_CFG_Q_RING_EN > 0u)
+    if (p_ring != (OS_MSG *)0) {
+        OS_MsgQRingInit(&p_q->MsgQ,                             /* Initialize the queue on the ring                     */
+                         p_ring,
+                         max_qty);
+    } else {
+        OS_MsgQInit(&p_q->MsgQ,                                 /* Initialize the queue on OSMsgPool                    */
+                    max_qty);
+    }
+#else
+    (void)p_ring;
+    OS_MsgQInit(&p_q->MsgQ,                                     /* Initialize the queue                                 */
+                max_qty);
+#endif
+    OS_PendListInit(&p_q->PendList);                            /* Initialize the waiting list                          */
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    OS_PendListInit(&p_q->PostPendObj.PendList);                /* ... and the list of tasks waiting for room           */
+#endif
+#if (OS_CFG_Q_SET_EN > 0u)
+    p_q->SetPtr  = (OS_Q_SET *)0;                               /* Not a member of a queue set                          */
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_QDbgListAdd(p_q);
+    OSQQty++;                                                   /* One more queue created                               */
+#endif
+    OS_TRACE_Q_CREATE(p_q, p_name);
+    CPU_CRITICAL_EXIT();
    *p_err = OS_ERR_NONE;
-    OS_TRACE_Q_POST_EXIT(*p_err);
 }
 
 
@@ -918,13 +1733,25 @@ void  OS_QClr (OS_Q  *p_q)
     (void)OS_MsgQFreeAll(&p_q->MsgQ);                           /* Return all OS_MSGs to the free list                  */
 #if (OS_OBJ_TYPE_REQ > 0u)
     p_q->Type    =  OS_OBJ_TYPE_NONE;                           /* Mark the data structure as a NONE                    */
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    p_q->PostPendObj.Type    =  OS_OBJ_TYPE_NONE;
+#endif
 #endif
 #if (OS_CFG_DBG_EN > 0u)
     p_q->NamePtr = (CPU_CHAR *)((void *)"?Q");
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    p_q->PostPendObj.NamePtr = (CPU_CHAR *)((void *)"?Q");
+#endif
 #endif
     OS_MsgQInit(&p_q->MsgQ,                                     /* Initialize the list of OS_MSGs                       */
                 0u);
     OS_PendListInit(&p_q->PendList);                            /* Initialize the waiting list                          */
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    OS_PendListInit(&p_q->PostPendObj.PendList);
+#endif
+#if (OS_CFG_Q_SET_EN > 0u)
+    p_q->SetPtr  = (OS_Q_SET *)0;                               /* Leave the queue set, see OSQSetAdd() Note #2         */
+#endif
 }
 
 
@@ -986,4 +1813,185 @@ void  OS_QDbgListRemove (OS_Q  *p_q)
     }
 }
 #endif
+
+
+/*
+************************************************************************************************************************
+*                                               POST MESSAGE TO A QUEUE
+*
+* Description: This function is called by the post functions of this file to give a message to the highest priority
+*              task waiting on a queue or, if no task waits, to place it in the queue.
+*
+* Arguments  : p_q           is a pointer to the message queue
+*
+*              p_void        is a pointer to the message to send
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              opt           is the option passed to OSQPost(), OSQPostMulti() or OSQPostWait()
+*
+*              ts            is the timestamp of the post
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The message was given to a task or placed in the queue
+*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place the message into
+*                                OS_ERR_Q_MAX             If the queue (or the queue set of the queue) is full
+*
+* Returns    : OS_TRUE       if a task may have been readied, and the scheduler should run
+*              OS_FALSE      otherwise
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled, or with the scheduler locked by OSQPost() and
+*                 OSQPostMulti() when posts from ISRs are deferred.
+*
+*              3) When the queue is a member of a queue set and no task waits on it, the message is announced to the
+*                 queue set.  The message is not queued when the queue set cannot take the announcement.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_QPost (OS_Q         *p_q,
+                       void         *p_void,
+                       OS_MSG_SIZE   msg_size,
+                       OS_OPT        opt,
+                       CPU_TS        ts,
+                       OS_ERR       *p_err)
+{
+    OS_OPT         post_type;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+#if (OS_CFG_Q_SET_EN > 0u)
+    OS_MSG_QTY     msg_qty;
+#endif
+
+
+    p_pend_list = &p_q->PendList;
+    if (OS_PEND_LIST_HEAD_GET(p_pend_list) == (OS_TCB *)0) {    /* Any task waiting on message queue?                   */
+        if ((opt & OS_OPT_POST_LIFO) == 0u) {                   /* Determine whether we post FIFO or LIFO               */
+            post_type = OS_OPT_POST_FIFO;
+        } else {
+            post_type = OS_OPT_POST_LIFO;
+        }
+#if (OS_CFG_Q_SET_EN > 0u)
+        if (p_q->SetPtr != (OS_Q_SET *)0) {                     /* Announce the message to the queue set, see Note #3   */
+            if (p_q->MsgQ.NbrEntries >= p_q->MsgQ.NbrEntriesSize) {
+               *p_err = OS_ERR_Q_MAX;
+            } else {
+#if (OS_CFG_Q_RING_EN > 0u)
+                if (p_q->MsgQ.RingPtr != (OS_MSG *)0) {         /* A ring needs no OS_MSG for the message itself        */
+                    msg_qty = 0u;
+                } else {
+                    msg_qty = 1u;
+                }
+#else
+                msg_qty = 1u;                                   /* Keep an OS_MSG for the message itself                */
+#endif
+                OS_QSetPost(p_q->SetPtr,
+                            (OS_PEND_OBJ *)((void *)p_q),
+                            msg_qty,
+                            ts,
+                            p_err);
+            }
+            if (*p_err != OS_ERR_NONE) {
+                return (OS_FALSE);
+            }
+        }
+#endif
+        OS_MsgQPut(&p_q->MsgQ,                                  /* Place message in the message queue                   */
+                   p_void,
+                   msg_size,
+                   post_type,
+                   ts,
+                   p_err);
+#if (OS_CFG_Q_SET_EN > 0u)
+        if (p_q->SetPtr != (OS_Q_SET *)0) {
+            return (OS_TRUE);                                   /* A task waiting on the queue set may be ready         */
+        }
+#endif
+        return (OS_FALSE);
+    }
+
+    p_tcb = OS_PEND_LIST_HEAD_GET(p_pend_list);
+    while (p_tcb != (OS_TCB *)0) {
+        OS_Post((OS_PEND_OBJ *)((void *)p_q),
+                p_tcb,
+                p_void,
+                msg_size,
+                ts);
+        if ((opt & OS_OPT_POST_ALL) == 0u)  {                   /* Post message to all tasks waiting?                   */
+            break;                                              /* No                                                   */
+        }
+        p_tcb = OS_PEND_LIST_HEAD_GET(p_pend_list);             /* The task posted to left the list                     */
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (OS_TRUE);
+}
+
+
+/*
+************************************************************************************************************************
+*                                     READY THE TASKS WAITING FOR ROOM IN A QUEUE
+*
+* Description: This function is called when messages left a queue, to place the messages of the tasks waiting in
+*              OSQPostWait() into the room freed and ready those tasks, highest priority first.
+*
+* Arguments  : p_q           is a pointer to the message queue
+*
+* Returns    : OS_TRUE       if a task was readied, and the scheduler should run
+*              OS_FALSE      otherwise
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.
+*
+*              3) A task stays waiting when its message cannot be posted, see OSQPostWait() Note #2.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+CPU_BOOLEAN  OS_QPostWaitRdy (OS_Q  *p_q)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_BOOLEAN    rdy;
+    CPU_TS         ts;
+    OS_ERR         err;
+
+
+    p_pend_list = &p_q->PostPendObj.PendList;
+    p_tcb       =  OS_PEND_LIST_HEAD_GET(p_pend_list);
+    if (p_tcb == (OS_TCB *)0) {                                 /* Any task waiting for room?                           */
+        return (OS_FALSE);                                      /* No                                                   */
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    ts  = OS_TS_GET();                                          /* Get timestamp                                        */
+#else
+    ts  = 0u;
+#endif
+    rdy = OS_FALSE;
+    while ((p_tcb != (OS_TCB *)0) &&
+           (p_q->MsgQ.NbrEntries < p_q->MsgQ.NbrEntriesSize)) {
+        (void)OS_QPost(p_q,                                     /* Place the message of the task in the queue           */
+                       p_tcb->MsgPtr,
+                       p_tcb->MsgSize,
+                       p_tcb->PostOpt,
+                       ts,
+                       &err);
+        if (err != OS_ERR_NONE) {                               /* See Note #3                                          */
+            break;
+        }
+        OS_Post(&p_q->PostPendObj,                              /* Ready the task                                       */
+                p_tcb,
+                (void *)0,
+                0u,
+                ts);
+        rdy   = OS_TRUE;
+        p_tcb = OS_PEND_LIST_HEAD_GET(p_pend_list);             /* The task readied left the list                       */
+    }
+    return (rdy);
+}
+#endif
 #endif
@@ -0,0 +1,642 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2022 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          QUEUE SET MANAGEMENT
+*
+* File    : os_q_set.c
+* Version : V3.08.02
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_q_set__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_Q_SET_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               ADD AN OBJECT TO A QUEUE SET
+*
+* Description: This function makes a message queue or a semaphore a member of a queue set.  From then on, every message
+*              or count posted to the member while no task waits on the member is announced to the queue set, see
+*              OSQSetPend().
+*
+* Arguments  : p_set     is a pointer to the queue set
+*
+*              p_obj     is a pointer to the message queue or semaphore to add, e.g. (OS_PEND_OBJ *)&MyQ
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE              The object is now a member of the queue set
+*                            OS_ERR_OBJ_PTR_NULL      If 'p_set' or 'p_obj' is a NULL pointer
+*                            OS_ERR_OBJ_TYPE          If 'p_set' is not pointing at a queue set or, 'p_obj' is not
+*                                                     pointing at a message queue or a semaphore
+*                            OS_ERR_Q_SET_MEMBER      If the object is already a member of a queue set
+*                            OS_ERR_Q_SET_NOT_EMPTY   If the object holds messages or has a non-zero count
+*                            OS_ERR_SET_ISR           If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The object MUST be empty so that each entry of the queue set matches a message or count of a member.
+*
+*              2) A member is expected to be read only by the task(s) that pend on its queue set, and only with the
+*                 OS_OPT_PEND_NON_BLOCKING option.  Pending on the member directly, flushing it, setting its count or
+*                 deleting it leaves stale entries in the queue set, which are then returned by OSQSetPend() while the
+*                 member is empty.
+************************************************************************************************************************
+*/
+
+void  OSQSetAdd (OS_Q_SET     *p_set,
+                 OS_PEND_OBJ  *p_obj,
+                 OS_ERR       *p_err)
+{
+#if (OS_CFG_Q_EN > 0u)
+    OS_Q    *p_q;
+#endif
+#if (OS_CFG_SEM_EN > 0u)
+    OS_SEM  *p_sem;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_set == (OS_Q_SET *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_obj == (OS_PEND_OBJ *)0) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_set->Type != OS_OBJ_TYPE_Q_SET) {                     /* Make sure queue set was created                      */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    switch (p_obj->Type) {
+#if (OS_CFG_Q_EN > 0u)
+        case OS_OBJ_TYPE_Q:
+             p_q = (OS_Q *)((void *)p_obj);
+             if (p_q->SetPtr != (OS_Q_SET *)0) {
+                *p_err = OS_ERR_Q_SET_MEMBER;
+             } else if (p_q->MsgQ.NbrEntries > 0u) {            /* See Note #1                                          */
+                *p_err = OS_ERR_Q_SET_NOT_EMPTY;
+             } else {
+                 p_q->SetPtr = p_set;
+                *p_err       = OS_ERR_NONE;
+             }
+             break;
+#endif
+
+#if (OS_CFG_SEM_EN > 0u)
+        case OS_OBJ_TYPE_SEM:
+             p_sem = (OS_SEM *)((void *)p_obj);
+             if (p_sem->SetPtr != (OS_Q_SET *)0) {
+                *p_err = OS_ERR_Q_SET_MEMBER;
+             } else if (p_sem->Ctr > 0u) {                      /* See Note #1                                          */
+                *p_err = OS_ERR_Q_SET_NOT_EMPTY;
+             } else {
+                 p_sem->SetPtr = p_set;
+                *p_err         = OS_ERR_NONE;
+             }
+             break;
+#endif
+
+        default:
+            *p_err = OS_ERR_OBJ_TYPE;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  CREATE A QUEUE SET
+*
+* Description: This function is called by your application to create a queue set.  A queue set MUST be created before
+*              it can be used.
+*
+* Arguments  : p_set         is a pointer to the queue set
+*
+*              p_name        is a pointer to an ASCII string that will be used to name the queue set
+*
+*              max_qty       indicates the maximum number of posts to its members that the queue set can hold before
+*                            one of its tasks reads them.  This value cannot be 0.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful
+*                                OS_ERR_CREATE_ISR              Can't create from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the queue set after you
+*                                                                 called OSSafetyCriticalStart().
+*                                OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_set'
+*                                OS_ERR_OBJ_CREATED             If the queue set was already created
+*                                OS_ERR_Q_SIZE                  If the size you specified is 0
+*
+* Returns    : none
+*
+* Note(s)    : 1) Like a message queue, a queue set takes its entries from the pool of OS_MSGs.
+************************************************************************************************************************
+*/
+
+void  OSQSetCreate (OS_Q_SET    *p_set,
+                    CPU_CHAR    *p_name,
+                    OS_MSG_QTY   max_qty,
+                    OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_set == (OS_Q_SET *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (max_qty == 0u) {                                        /* Cannot specify a zero size queue set                 */
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_set->Type == OS_OBJ_TYPE_Q_SET) {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_set->Type    = OS_OBJ_TYPE_Q_SET;                         /* Mark the data structure as a queue set               */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_set->NamePtr = p_name;
+#else
+    (void)p_name;
+#endif
+    OS_MsgQInit(&p_set->MsgQ,                                   /* Initialize the list of members posted to             */
+                max_qty);
+    OS_PendListInit(&p_set->PendList);                          /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_QSetDbgListAdd(p_set);
+    OSQSetQty++;                                                /* One more queue set created                           */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 PEND ON A QUEUE SET
+*
+* Description: This function waits until one of the members of a queue set is posted to and returns that member.  The
+*              caller then reads the member with OSQPend() or OSSemPend() and the OS_OPT_PEND_NON_BLOCKING option.
+*
+* Arguments  : p_set         is a pointer to the queue set
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            member to be posted to up to the amount of time specified by this argument.  If you
+*                            specify 0, however, your task will wait forever at the specified queue set or, until a
+*                            member is posted to.
+*
+*              opt           determines whether the user wants to block if no member was posted to:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the member was posted
+*                            to or, the pend aborted.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you will not
+*                            get the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and a member was returned
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_set'
+*                                OS_ERR_OBJ_TYPE           If the queue set was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but no member was posted to
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            No member was posted to within the specified timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : != (OS_PEND_OBJ *)0  is a pointer to the member posted to, in post order
+*              == (OS_PEND_OBJ *)0  if no member was posted to or, upon error.
+*
+* Note(s)    : 1) This API 'MUST NOT' be called from a timer callback function.
+*
+*              2) A queue set is pended on like a message queue (OS_TASK_PEND_ON_Q) whose messages are its members.
+************************************************************************************************************************
+*/
+
+OS_PEND_OBJ  *OSQSetPend (OS_Q_SET  *p_set,
+                          OS_TICK    timeout,
+                          OS_OPT     opt,
+                          CPU_TS    *p_ts,
+                          OS_ERR    *p_err)
+{
+    OS_PEND_OBJ  *p_obj;
+    OS_MSG_SIZE   msg_size;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_PEND_OBJ *)0);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return ((OS_PEND_OBJ *)0);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return ((OS_PEND_OBJ *)0);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return ((OS_PEND_OBJ *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_set == (OS_Q_SET *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((OS_PEND_OBJ *)0);
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((OS_PEND_OBJ *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_set->Type != OS_OBJ_TYPE_Q_SET) {                     /* Make sure queue set was created                      */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((OS_PEND_OBJ *)0);
+    }
+#endif
+
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_obj = (OS_PEND_OBJ *)OS_MsgQGet(&p_set->MsgQ,             /* Any member posted to?                                */
+                                      &msg_size,
+                                      p_ts,
+                                      p_err);
+    if (*p_err == OS_ERR_NONE) {
+        CPU_CRITICAL_EXIT();
+        return (p_obj);                                         /* Yes, Return the member                               */
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return ((OS_PEND_OBJ *)0);
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return ((OS_PEND_OBJ *)0);
+        }
+    }
+
+    OS_Pend((OS_PEND_OBJ *)((void *)p_set),                     /* Block task pending on Queue Set, see Note #2         */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_Q,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Extract member from TCB (Put there by Post)          */
+             p_obj  = (OS_PEND_OBJ *)OSTCBCurPtr->MsgPtr;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err  = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+             p_obj  = (OS_PEND_OBJ *)0;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err  = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that no member was posted to within TO      */
+             p_obj  = (OS_PEND_OBJ *)0;
+            *p_err  = OS_ERR_TIMEOUT;
+             break;
+
+        default:
+             p_obj  = (OS_PEND_OBJ *)0;
+            *p_err  = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (p_obj);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            REMOVE AN OBJECT FROM A QUEUE SET
+*
+* Description: This function removes a message queue or a semaphore from the queue set it is a member of.
+*
+* Arguments  : p_set     is a pointer to the queue set
+*
+*              p_obj     is a pointer to the message queue or semaphore to remove
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE              The object is no longer a member of the queue set
+*                            OS_ERR_OBJ_PTR_NULL      If 'p_set' or 'p_obj' is a NULL pointer
+*                            OS_ERR_OBJ_TYPE          If 'p_set' is not pointing at a queue set or, 'p_obj' is not
+*                                                     pointing at a message queue or a semaphore
+*                            OS_ERR_Q_SET_MEMBER      If the object is not a member of this queue set
+*                            OS_ERR_Q_SET_NOT_EMPTY   If the object holds messages or has a non-zero count
+*                            OS_ERR_SET_ISR           If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The object MUST be empty, its posts would otherwise remain announced by the queue set.
+************************************************************************************************************************
+*/
+
+void  OSQSetRemove (OS_Q_SET     *p_set,
+                    OS_PEND_OBJ  *p_obj,
+                    OS_ERR       *p_err)
+{
+#if (OS_CFG_Q_EN > 0u)
+    OS_Q    *p_q;
+#endif
+#if (OS_CFG_SEM_EN > 0u)
+    OS_SEM  *p_sem;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_set == (OS_Q_SET *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_obj == (OS_PEND_OBJ *)0) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_set->Type != OS_OBJ_TYPE_Q_SET) {                     /* Make sure queue set was created                      */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    switch (p_obj->Type) {
+#if (OS_CFG_Q_EN > 0u)
+        case OS_OBJ_TYPE_Q:
+             p_q = (OS_Q *)((void *)p_obj);
+             if (p_q->SetPtr != p_set) {
+                *p_err = OS_ERR_Q_SET_MEMBER;
+             } else if (p_q->MsgQ.NbrEntries > 0u) {            /* See Note #1                                          */
+                *p_err = OS_ERR_Q_SET_NOT_EMPTY;
+             } else {
+                 p_q->SetPtr = (OS_Q_SET *)0;
+                *p_err       = OS_ERR_NONE;
+             }
+             break;
+#endif
+
+#if (OS_CFG_SEM_EN > 0u)
+        case OS_OBJ_TYPE_SEM:
+             p_sem = (OS_SEM *)((void *)p_obj);
+             if (p_sem->SetPtr != p_set) {
+                *p_err = OS_ERR_Q_SET_MEMBER;
+             } else if (p_sem->Ctr > 0u) {                      /* See Note #1                                          */
+                *p_err = OS_ERR_Q_SET_NOT_EMPTY;
+             } else {
+                 p_sem->SetPtr = (OS_Q_SET *)0;
+                *p_err         = OS_ERR_NONE;
+             }
+             break;
+#endif
+
+        default:
+            *p_err = OS_ERR_OBJ_TYPE;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                         ANNOUNCE A POST TO A QUEUE SET MEMBER
+*
+* Description: This function is called by OSQPost() and OSSemPost() when a member of a queue set is posted to while no
+*              task waits on the member.  The member is handed to the highest priority task waiting on the queue set,
+*              if any, or else is appended to the queue set.
+*
+* Arguments  : p_set     is a pointer to the queue set
+*
+*              p_obj     is a pointer to the member posted to
+*
+*              msg_qty   is the number of OS_MSGs the caller still needs from the pool to store the post in the member
+*
+*              ts        is the timestamp of the post
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE             The post was announced
+*                            OS_ERR_MSG_POOL_EMPTY   If there are not enough OS_MSGs left in the pool
+*                            OS_ERR_Q_MAX            If the queue set is full
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled, or with the scheduler locked when posts from ISRs
+*                 are deferred, BEFORE the post is stored in the member, so that the caller fails the post when it
+*                 cannot be announced.  This function never fails once 'msg_qty' OS_MSGs are kept for the caller.
+*
+*              3) The caller MUST call the scheduler since a task waiting on the queue set may have been readied.
+************************************************************************************************************************
+*/
+
+void  OS_QSetPost (OS_Q_SET     *p_set,
+                   OS_PEND_OBJ  *p_obj,
+                   OS_MSG_QTY    msg_qty,
+                   CPU_TS        ts,
+                   OS_ERR       *p_err)
+{
+    OS_TCB  *p_tcb;
+
+
+    if (OSMsgPool.NbrFree < msg_qty) {                          /* See Note #2                                          */
+       *p_err = OS_ERR_MSG_POOL_EMPTY;
+        return;
+    }
+
+    p_tcb = OS_PEND_LIST_HEAD_GET(&p_set->PendList);
+    if (p_tcb != (OS_TCB *)0) {                                 /* Any task waiting on the queue set?                   */
+        OS_Post((OS_PEND_OBJ *)((void *)p_set),                 /* Yes, hand it the member                              */
+                p_tcb,
+                (void *)p_obj,
+                0u,
+                ts);
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if (OSMsgPool.NbrFree == msg_qty) {                         /* No, keep an OS_MSG for the member as well            */
+       *p_err = OS_ERR_MSG_POOL_EMPTY;
+        return;
+    }
+    OS_MsgQPut(&p_set->MsgQ,                                    /* Append the member, in post order                     */
+               (void *)p_obj,
+               0u,
+               OS_OPT_POST_FIFO,
+               ts,
+               p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                             ADD QUEUE SET TO DEBUG LIST
+*
+* Description: This function is called by uC/OS-III to add a queue set to the queue set debug list.
+*
+* Arguments  : p_set   is a pointer to the queue set to add
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) Queue sets are never deleted, so they are never removed from the debug list.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_QSetDbgListAdd (OS_Q_SET  *p_set)
+{
+    p_set->DbgNamePtr                = (CPU_CHAR *)((void *)" ");
+    p_set->DbgPrevPtr                = (OS_Q_SET *)0;
+    if (OSQSetDbgListPtr == (OS_Q_SET *)0) {
+        p_set->DbgNextPtr            = (OS_Q_SET *)0;
+    } else {
+        p_set->DbgNextPtr            =  OSQSetDbgListPtr;
+        OSQSetDbgListPtr->DbgPrevPtr =  p_set;
+    }
+    OSQSetDbgListPtr                 =  p_set;
+}
+#endif
+#endif
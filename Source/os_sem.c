@@ -113,6 +113,9 @@ void  OSSemCreate (OS_SEM      *p_sem,
 #if (OS_CFG_TS_EN > 0u)
     p_sem->TS      = 0u;
 #endif
+#if (OS_CFG_Q_SET_EN > 0u)
+    p_sem->SetPtr  = (OS_Q_SET *)0;                             /* Not a member of a queue set                          */
+#endif
 #if (OS_CFG_DBG_EN > 0u)
     p_sem->NamePtr = p_name;                                    /* Save the name of the semaphore                       */
 #else
@@ -235,7 +238,7 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
     nbr_tasks   = 0u;
     switch (opt) {
         case OS_OPT_DEL_NO_PEND:                                /* Delete semaphore only if no task waiting             */
-             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+             if (OS_PEND_LIST_HEAD_GET(p_pend_list) == (OS_TCB *)0) {
 #if (OS_CFG_DBG_EN > 0u)
                  OS_SemDbgListRemove(p_sem);
                  OSSemQty--;
@@ -256,8 +259,15 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
 #else
              ts = 0u;
 #endif
-             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks on the pend list                    */
-                 p_tcb = p_pend_list->HeadPtr;
+             while (OS_PEND_LIST_HEAD_GET(p_pend_list) != (OS_TCB *)0) { /* Remove all tasks on the pend list           */
+                 p_tcb = OS_PEND_LIST_HEAD_GET(p_pend_list);
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+                 OS_PendMultiRdy(p_tcb,
+                                 (OS_PEND_OBJ *)((void *)p_sem),
+                                 (void *)0,
+                                 0u,
+                                 ts);
+#endif
                  OS_PendAbort(p_tcb,
                               ts,
                               OS_STATUS_PEND_DEL);
@@ -618,7 +628,7 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
 
     CPU_CRITICAL_ENTER();
     p_pend_list = &p_sem->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on semaphore?                       */
+    if (OS_PEND_LIST_HEAD_GET(p_pend_list) == (OS_TCB *)0) {    /* Any task waiting on semaphore?                       */
         CPU_CRITICAL_EXIT();                                    /* No                                                   */
        *p_err =  OS_ERR_PEND_ABORT_NONE;
         return (0u);
@@ -630,8 +640,15 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
 #else
     ts        = 0u;
 #endif
-    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
-        p_tcb = p_pend_list->HeadPtr;
+    while (OS_PEND_LIST_HEAD_GET(p_pend_list) != (OS_TCB *)0) {
+        p_tcb = OS_PEND_LIST_HEAD_GET(p_pend_list);
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+        OS_PendMultiRdy(p_tcb,
+                        (OS_PEND_OBJ *)((void *)p_sem),
+                        (void *)0,
+                        0u,
+                        ts);
+#endif
         OS_PendAbort(p_tcb,
                      ts,
                      OS_STATUS_PEND_ABORT);
@@ -677,10 +694,19 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
 *                           OS_ERR_OPT_INVALID       If you specified an invalid option
 *                           OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
 *                           OS_ERR_SEM_OVF           If the post would cause the semaphore count to overflow
+*                           OS_ERR_INT_Q_FULL        If the ISR queue is full, when posts from ISRs are deferred
+*                           OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to announce the post to the queue set
+*                           OS_ERR_Q_MAX             If the queue set of the semaphore is full
 *
 * Returns    : The current value of the semaphore counter or 0 upon error.
 *
 * Note(s)    : 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
+*
+*              2) When posts from ISRs are deferred (OS_CFG_ISR_POST_DEFERRED_EN), a post made from an ISR is replayed
+*                 by the ISR handler task and this function returns 0.
+*
+*              3) When the semaphore is a member of a queue set and no task waits on it, the post is announced to the
+*                 queue set.  The count is not incremented when the queue set cannot take the announcement.
 ************************************************************************************************************************
 */
 
@@ -691,7 +717,6 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
     OS_SEM_CTR     ctr;
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
-    OS_TCB        *p_tcb_next;
     CPU_TS         ts;
     CPU_SR_ALLOC();
 
@@ -749,30 +774,69 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
     ts = 0u;
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Defer posts made from ISRs to the ISR handler task   */
+        OS_IntQPost(OS_OBJ_TYPE_SEM,
+                    (void *)p_sem,
+                    (void *)0,
+                    0u,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+#if (OS_CFG_TS_EN > 0u)
+    if (OSTCBCurPtr == &OSIntQTaskTCB) {                        /* Keep the time stamp of a replayed ISR post           */
+        ts = OSIntQTaskTS;
+    }
+#endif
+#endif
+
     OS_TRACE_SEM_POST(p_sem);
-    CPU_CRITICAL_ENTER();
+    OS_CRITICAL_ENTER();
     p_pend_list = &p_sem->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on semaphore?                       */
+    if (OS_PEND_LIST_HEAD_GET(p_pend_list) == (OS_TCB *)0) {    /* Any task waiting on semaphore?                       */
         if (p_sem->Ctr == (OS_SEM_CTR)-1) {
-           CPU_CRITICAL_EXIT();
+           OS_CRITICAL_EXIT();
           *p_err = OS_ERR_SEM_OVF;
            OS_TRACE_SEM_POST_EXIT(*p_err);
            return (0u);
         }
+#if (OS_CFG_Q_SET_EN > 0u)
+        if (p_sem->SetPtr != (OS_Q_SET *)0) {                   /* Announce the post to the queue set, see Note #3      */
+            OS_QSetPost(p_sem->SetPtr,
+                        (OS_PEND_OBJ *)((void *)p_sem),
+                        0u,
+                        ts,
+                        p_err);
+            if (*p_err != OS_ERR_NONE) {
+                OS_CRITICAL_EXIT();
+                OS_TRACE_SEM_POST_EXIT(*p_err);
+                return (0u);
+            }
+        }
+#endif
         p_sem->Ctr++;                                           /* No                                                   */
         ctr       = p_sem->Ctr;
 #if (OS_CFG_TS_EN > 0u)
         p_sem->TS = ts;                                         /* Save timestamp in semaphore control block            */
 #endif
-        CPU_CRITICAL_EXIT();
+        OS_CRITICAL_EXIT();
+#if (OS_CFG_Q_SET_EN > 0u)
+        if ((p_sem->SetPtr != (OS_Q_SET *)0) &&
+            ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+            OSSched();                                          /* A task waiting on the queue set may be ready         */
+        }
+#endif
        *p_err     = OS_ERR_NONE;
         OS_TRACE_SEM_POST_EXIT(*p_err);
         return (ctr);
     }
 
-    p_tcb = p_pend_list->HeadPtr;
+    p_tcb = OS_PEND_LIST_HEAD_GET(p_pend_list);
     while (p_tcb != (OS_TCB *)0) {
-        p_tcb_next = p_tcb->PendNextPtr;
         OS_Post((OS_PEND_OBJ *)((void *)p_sem),
                 p_tcb,
                 (void *)0,
@@ -781,9 +845,9 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
         if ((opt & OS_OPT_POST_ALL) == 0u) {                     /* Post to all tasks waiting?                           */
             break;                                              /* No                                                   */
         }
-        p_tcb = p_tcb_next;
+        p_tcb = OS_PEND_LIST_HEAD_GET(p_pend_list);             /* The task posted to left the list                     */
     }
-    CPU_CRITICAL_EXIT();
+    OS_CRITICAL_EXIT();
     if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
         OSSched();                                              /* Run the scheduler                                    */
     }
@@ -865,7 +929,7 @@ void  OSSemSet (OS_SEM      *p_sem,
         p_sem->Ctr = cnt;                                       /* Yes, set it to the new value specified.              */
     } else {
         p_pend_list = &p_sem->PendList;                         /* No                                                   */
-        if (p_pend_list->HeadPtr == (OS_TCB *)0) {              /* See if task(s) waiting?                              */
+        if (OS_PEND_LIST_HEAD_GET(p_pend_list) == (OS_TCB *)0) { /* See if task(s) waiting?                             */
             p_sem->Ctr = cnt;                                   /* No, OK to set the value                              */
         } else {
            *p_err      = OS_ERR_TASK_WAITING;
@@ -901,6 +965,9 @@ void  OS_SemClr (OS_SEM  *p_sem)
 #if (OS_CFG_TS_EN > 0u)
     p_sem->TS      = 0u;                                        /* Clear the time stamp                                 */
 #endif
+#if (OS_CFG_Q_SET_EN > 0u)
+    p_sem->SetPtr  = (OS_Q_SET *)0;                             /* Leave the queue set, see OSQSetAdd() Note #2         */
+#endif
 #if (OS_CFG_DBG_EN > 0u)
     p_sem->NamePtr = (CPU_CHAR *)((void *)"?SEM");
 #endif
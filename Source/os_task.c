@@ -31,6 +31,19 @@
 const  CPU_CHAR  *os_task__c = "$Id: $";
 #endif
 
+/*
+************************************************************************************************************************
+*                                                 FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+static  void  OS_TaskBudgetExhaust (OS_TCB  *p_tcb);
+static  void  OS_TaskBudgetRestore (OS_TCB  *p_tcb);
+static  void  OS_TaskBudgetUnlink  (OS_TCB  *p_tcb);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                CHANGE PRIORITY OF A TASK
@@ -95,6 +108,14 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
         return;
     }
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if ((prio_new == 0u) ||                                     /* Priority 0 is reserved for the ISR handler task      */
+        (p_tcb    == &OSIntQTaskTCB)) {
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
 
     if (p_tcb == (OS_TCB *)0) {                                 /* Are we changing the priority of 'self'?              */
@@ -106,6 +127,16 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
         p_tcb = OSTCBCurPtr;
     }
 
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    if ((p_tcb->BudgetExhausted == OS_TRUE) &&                  /* Demoted for lack of CPU budget?                      */
+        (p_tcb->BudgetOpt       == OS_OPT_TASK_BUDGET_DEMOTE)) {
+        p_tcb->BudgetPrioSave = prio_new;                       /* Yes, the new priority applies once replenished       */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
+
 #if (OS_CFG_MUTEX_EN > 0u)
     p_tcb->BasePrio = prio_new;                                 /* Update base priority                                 */
 
@@ -306,7 +337,13 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 
     if (prio == (OS_CFG_PRIO_MAX - 1u)) {
 #if (OS_CFG_TASK_IDLE_EN > 0u)
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+        if ((p_tcb != &OSIdleTaskTCB) &&                        /* Each core has its own idle task                      */
+            ((p_tcb <  &OSIdleTaskCoreTCB[0]) ||
+             (p_tcb >= &OSIdleTaskCoreTCB[OS_CFG_SMP_CORE_QTY - 1u]))) {
+#else
         if (p_tcb != &OSIdleTaskTCB) {
+#endif
             OS_TRACE_TASK_CREATE_FAILED(p_tcb);
            *p_err = OS_ERR_PRIO_INVALID;                        /* Not allowed to use same priority as idle task        */
             return;
@@ -318,6 +355,15 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 #endif
     }
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if ((prio  == 0u) &&
+        (p_tcb != &OSIntQTaskTCB)) {
+        OS_TRACE_TASK_CREATE_FAILED(p_tcb);
+       *p_err = OS_ERR_PRIO_INVALID;                            /* Priority 0 is reserved for the ISR handler task      */
+        return;
+    }
+#endif
+
     OS_TaskInitTCB(p_tcb);                                      /* Initialize the TCB to default values                 */
 
    *p_err = OS_ERR_NONE;
@@ -410,6 +456,9 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 #if (OS_CFG_TASK_Q_EN > 0u)
     OS_MsgQInit(&p_tcb->MsgQ,                                   /* Initialize the task's message queue                  */
                 q_size);
+#if (OS_CFG_Q_POST_WAIT_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+    p_tcb->MsgQPostPendObj.NamePtr = p_name;                    /* Name the tasks waiting for room after the task       */
+#endif
 #else
     (void)q_size;
 #endif
@@ -476,6 +525,10 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 * Note(s)    : 1) 'p_err' gets set to OS_ERR_NONE before OSSched() to allow the returned err or code to be monitored even
 *                 for a task that is deleting itself. In this case, 'p_err' MUST point to a global variable that can be
 *                 accessed by another task.
+*
+*              2) When more than one core is scheduled, a task running on another core is first switched out by that
+*                 core.  The task is not scheduled again and the caller waits, with the kernel lock released, until the
+*                 task has left its core.  Only then is the task removed and its TCB re-initialized.
 ************************************************************************************************************************
 */
 
@@ -486,6 +539,10 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 #if (OS_CFG_MUTEX_EN > 0u)
     OS_TCB   *p_tcb_owner;
     OS_PRIO   prio_new;
+#endif
+#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_Q_POST_WAIT_EN > 0u)
+    OS_TCB   *p_tcb_post;
+    CPU_TS    ts;
 #endif
     CPU_SR_ALLOC();
 
@@ -525,6 +582,13 @@ void  OSTaskDel (OS_TCB  *p_tcb,
     }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (p_tcb == &OSIntQTaskTCB) {                              /* Not allowed to delete the ISR handler task           */
+       *p_err = OS_ERR_TASK_DEL_INVALID;
+        return;
+    }
+#endif
+
     if (p_tcb == (OS_TCB *)0) {                                 /* Delete 'Self'?                                       */
         CPU_CRITICAL_ENTER();
         p_tcb  = OSTCBCurPtr;                                   /* Yes.                                                 */
@@ -532,6 +596,17 @@ void  OSTaskDel (OS_TCB  *p_tcb,
     }
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    if ((p_tcb->CoreId != OS_CORE_ID_NONE) &&                   /* Is the task running on another core?                 */
+        (p_tcb         != OSTCBCurPtr)) {
+        p_tcb->DelReq = OS_TRUE;                                /* Yes, have that core switch it out, see Note #2       */
+        OS_CPU_CoreSchedReq(p_tcb->CoreId);
+        while (p_tcb->CoreId != OS_CORE_ID_NONE) {
+            CPU_CRITICAL_EXIT();                                /* Let that core take the kernel lock                   */
+            CPU_CRITICAL_ENTER();
+        }
+    }
+#endif
     switch (p_tcb->TaskState) {
         case OS_TASK_STATE_RDY:
              OS_RdyListRemove(p_tcb);
@@ -560,6 +635,15 @@ void  OSTaskDel (OS_TCB  *p_tcb,
                  case OS_TASK_PEND_ON_FLAG:                     /* Remove from pend list                                */
                  case OS_TASK_PEND_ON_Q:
                  case OS_TASK_PEND_ON_SEM:
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+                 case OS_TASK_PEND_ON_MULTI:
+#endif
+#if (OS_CFG_MSG_BUF_EN > 0u)
+                 case OS_TASK_PEND_ON_MSG_BUF:
+#endif
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+                 case OS_TASK_PEND_ON_Q_POST:
+#endif
                       OS_PendListRemove(p_tcb);
                       break;
 
@@ -608,6 +692,20 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 
 #if (OS_CFG_TASK_Q_EN > 0u)
     (void)OS_MsgQFreeAll(&p_tcb->MsgQ);                         /* Free task's message queue messages                   */
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();
+#else
+    ts = 0u;
+#endif
+    p_tcb_post = OS_PEND_LIST_HEAD_GET(&p_tcb->MsgQPostPendObj.PendList);
+    while (p_tcb_post != (OS_TCB *)0) {                         /* Ready the tasks waiting to post to the task          */
+        OS_PendAbort(p_tcb_post,
+                     ts,
+                     OS_STATUS_PEND_DEL);
+        p_tcb_post = OS_PEND_LIST_HEAD_GET(&p_tcb->MsgQPostPendObj.PendList);
+    }
+#endif
 #endif
 
     OSTaskDelHook(p_tcb);                                       /* Call user defined hook                               */
@@ -620,6 +718,16 @@ void  OSTaskDel (OS_TCB  *p_tcb,
     OS_TaskDbgListRemove(p_tcb);
 #endif
 
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+    OS_SchedPreemptThresDel(p_tcb);                             /* Remove from the preemption threshold stack           */
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    if (p_tcb->Budget > 0u) {                                   /* Stop enforcing the task's CPU budget                 */
+        OS_TaskBudgetUnlink(p_tcb);
+    }
+#endif
+
     OSTaskQty--;                                                /* One less task being managed                          */
 
     OS_TRACE_TASK_DEL(p_tcb);
@@ -658,6 +766,9 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 *                  references to what the queue entries are pointing to and thus, you could cause 'memory leaks'.  In
 *                  other words, the data you are pointing to that's being referenced by the queue entries should, most
 *                  likely, need to be de-allocated (i.e. freed).
+*
+*               2) Tasks blocked in OSTaskQPostWait() on the queue then get the room freed, so the queue can hold
+*                  their messages again when this function returns.
 ************************************************************************************************************************
 */
 
@@ -665,7 +776,10 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 OS_MSG_QTY  OSTaskQFlush (OS_TCB  *p_tcb,
                           OS_ERR  *p_err)
 {
-    OS_MSG_QTY  entries;
+    OS_MSG_QTY   entries;
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    CPU_BOOLEAN  sched;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -698,7 +812,15 @@ OS_MSG_QTY  OSTaskQFlush (OS_TCB  *p_tcb,
 
     CPU_CRITICAL_ENTER();
     entries = OS_MsgQFreeAll(&p_tcb->MsgQ);                     /* Return all OS_MSGs to the OS_MSG pool                */
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    sched   = OS_TaskQPostWaitRdy(p_tcb);                       /* Hand the room to the tasks waiting, see Note #2      */
+    CPU_CRITICAL_EXIT();
+    if (sched == OS_TRUE) {
+        OSSched();
+    }
+#else
     CPU_CRITICAL_EXIT();
+#endif
    *p_err   = OS_ERR_NONE;
     return (entries);
 }
@@ -836,7 +958,16 @@ void  *OSTaskQPend (OS_TICK       timeout,
 #endif
 #endif
         OS_TRACE_TASK_MSG_Q_PEND(p_msg_q);
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+        if (OS_TaskQPostWaitRdy(OSTCBCurPtr) == OS_TRUE) {      /* Hand the room to a task waiting in OSTaskQPostWait() */
+            CPU_CRITICAL_EXIT();
+            OSSched();
+        } else {
+            CPU_CRITICAL_EXIT();
+        }
+#else
         CPU_CRITICAL_EXIT();
+#endif
         OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_NONE);
         return (p_void);                                        /* Yes, Return oldest message received                  */
     }
@@ -1056,6 +1187,7 @@ CPU_BOOLEAN  OSTaskQPendAbort (OS_TCB  *p_tcb,
 *                             OS_ERR_Q_MAX             If the queue is full
 *                             OS_ERR_STATE_INVALID     If the task is in an invalid state.  This should never happen
 *                                                      and if it does, would be considered a system failure
+*                             OS_ERR_INT_Q_FULL        If the ISR queue is full, when posts from ISRs are deferred
 *
 * Returns    : none
 *
@@ -1113,10 +1245,33 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
     ts = 0u;
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Defer posts made from ISRs to the ISR handler task   */
+        if (p_tcb == (OS_TCB *)0) {                             /* Resolve 'self' while still in the ISR                */
+            p_tcb = OSTCBCurPtr;
+        }
+        OS_IntQPost(OS_OBJ_TYPE_TASK_MSG,
+                    (void *)p_tcb,
+                    p_void,
+                    msg_size,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+        return;
+    }
+#if (OS_CFG_TS_EN > 0u)
+    if (OSTCBCurPtr == &OSIntQTaskTCB) {                        /* Keep the time stamp of a replayed ISR post           */
+        ts = OSIntQTaskTS;
+    }
+#endif
+#endif
+
     OS_TRACE_TASK_MSG_Q_POST(&p_tcb->MsgQ);
 
    *p_err = OS_ERR_NONE;                                        /* Assume we won't have any errors                      */
-    CPU_CRITICAL_ENTER();
+    OS_CRITICAL_ENTER();
     if (p_tcb == (OS_TCB *)0) {                                 /* Post msg to 'self'?                                  */
         p_tcb = OSTCBCurPtr;
     }
@@ -1131,7 +1286,7 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
                         opt,
                         ts,
                         p_err);
-             CPU_CRITICAL_EXIT();
+             OS_CRITICAL_EXIT();
              break;
 
         case OS_TASK_STATE_PEND:
@@ -1144,7 +1299,7 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
                           p_void,
                           msg_size,
                           ts);
-                 CPU_CRITICAL_EXIT();
+                 OS_CRITICAL_EXIT();
                  if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
                      OSSched();                                 /* Run the scheduler                                    */
                  }
@@ -1155,12 +1310,12 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
                             opt,
                             ts,
                             p_err);
-                 CPU_CRITICAL_EXIT();
+                 OS_CRITICAL_EXIT();
              }
              break;
 
         default:
-             CPU_CRITICAL_EXIT();
+             OS_CRITICAL_EXIT();
             *p_err = OS_ERR_STATE_INVALID;
              break;
     }
@@ -1169,6 +1324,213 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
 }
 #endif
 
+/*
+************************************************************************************************************************
+*                                 POST MESSAGE TO A TASK, WAITING FOR ROOM IF FULL
+*
+* Description: This function sends a message to a task as OSTaskQPost() does but, when the task's queue is full, the
+*              calling task waits for room instead of getting OS_ERR_Q_MAX.
+*
+* Arguments  : p_tcb      is a pointer to the TCB of the task receiving a message.  If you specify a NULL pointer then
+*                         the message will be posted to the task's queue of the calling task, see Note #2.
+*
+*              p_void     is a pointer to the message to send.
+*
+*              msg_size   is the size of the message sent (in bytes)
+*
+*              timeout    is an optional timeout period (in clock ticks).  If non-zero, your task will wait for room in
+*                         the task's queue up to the amount of time specified by this argument.  If you specify 0,
+*                         however, your task will wait forever or, until there is room in the task's queue.
+*
+*              opt        specifies whether the post will be FIFO or LIFO:
+*
+*                             OS_OPT_POST_FIFO       Post at the end   of the queue
+*                             OS_OPT_POST_LIFO       Post at the front of the queue
+*
+*                             OS_OPT_POST_NO_SCHED   Do not run the scheduler after the post
+*
+*                          Note(s): 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
+*
+*              p_err      is a pointer to a variable that will hold the error code associated
+*                         with the outcome of this call.  Errors can be:
+*
+*                             OS_ERR_NONE              The call was successful and the message was sent
+*                             OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs available from the pool
+*                             OS_ERR_OBJ_DEL           If the task was deleted while the calling task waited
+*                             OS_ERR_OPT_INVALID       If you specified an invalid option
+*                             OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                             OS_ERR_PEND_ABORT        If the wait for room was aborted
+*                             OS_ERR_PEND_ISR          If you called this function from an ISR
+*                             OS_ERR_Q_MAX             If the queue of the calling task is full, see Note #2
+*                             OS_ERR_SCHED_LOCKED      If the queue is full and the scheduler is locked
+*                             OS_ERR_STATE_INVALID     If the task is in an invalid state
+*                             OS_ERR_STATUS_INVALID    If the pend status has an invalid value
+*                             OS_ERR_TICK_DISABLED     If kernel ticks are disabled and a timeout is specified
+*                             OS_ERR_TIMEOUT           If there was no room in the queue within the timeout
+*
+* Returns    : none
+*
+* Note(s)    : 1) The tasks waiting for room are kept in priority order.  Each time the task takes a message with
+*                 OSTaskQPend(), or its queue is flushed, the message of the highest priority task waiting is placed
+*                 in the queue and that task is readied.
+*
+*              2) A task never waits for room in its own queue, since only the task itself could make some.
+*
+*              3) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_Q_POST_WAIT_EN > 0u)
+void  OSTaskQPostWait (OS_TCB       *p_tcb,
+                       void         *p_void,
+                       OS_MSG_SIZE   msg_size,
+                       OS_TICK       timeout,
+                       OS_OPT        opt,
+                       OS_ERR       *p_err)
+{
+    CPU_TS  ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)                                    /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    switch (opt) {                                              /* User must supply a valid option                      */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Post msg to 'self'?                                  */
+        p_tcb = OSTCBCurPtr;
+    }
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_RDY:
+        case OS_TASK_STATE_DLY:
+        case OS_TASK_STATE_SUSPENDED:
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             break;
+
+        case OS_TASK_STATE_PEND:
+        case OS_TASK_STATE_PEND_TIMEOUT:
+        case OS_TASK_STATE_PEND_SUSPENDED:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) {     /* Is task waiting for a message to be sent to it?      */
+                 OS_Post((OS_PEND_OBJ *)0,
+                          p_tcb,
+                          p_void,
+                          msg_size,
+                          ts);
+                 CPU_CRITICAL_EXIT();
+                 if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+                     OSSched();                                 /* Run the scheduler                                    */
+                 }
+                *p_err = OS_ERR_NONE;
+                 return;
+             }
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_STATE_INVALID;
+             return;
+    }
+
+    if ((p_tcb == OSTCBCurPtr) ||                               /* Deposit the message if the caller is the task, ...   */
+        ((p_tcb->MsgQ.NbrEntries < p_tcb->MsgQ.NbrEntriesSize) &&
+         (OS_PEND_LIST_HEAD_GET(&p_tcb->MsgQPostPendObj.PendList) == (OS_TCB *)0))) {
+        OS_MsgQPut(&p_tcb->MsgQ,                                /* ... or if there is room no other task waits for      */
+                   p_void,
+                   msg_size,
+                   opt,
+                   ts,
+                   p_err);
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't wait when the scheduler is locked              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    OSTCBCurPtr->MsgPtr  = p_void;                              /* Keep the message until there is room, see Note #1    */
+    OSTCBCurPtr->MsgSize = msg_size;
+    OSTCBCurPtr->PostOpt = opt;
+    OS_Pend(&p_tcb->MsgQPostPendObj,                            /* Block task waiting for room in the task's queue      */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_Q_POST,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* The message was placed in the task's queue           */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that there was no room within TO            */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that the task posted to has been deleted    */
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -1814,6 +2176,7 @@ CPU_BOOLEAN  OSTaskSemPendAbort (OS_TCB  *p_tcb,
 *                            OS_ERR_SEM_OVF           If the post would cause the semaphore count to overflow
 *                            OS_ERR_STATE_INVALID     If the task is in an invalid state.  This should never happen
 *                                                     and if it does, would be considered a system failure
+*                            OS_ERR_INT_Q_FULL        If the ISR queue is full, when posts from ISRs are deferred
 *
 * Returns    : The current value of the task's signal counter or 0 if called from an ISR
 *
@@ -1867,9 +2230,32 @@ OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
     ts = 0u;
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Defer posts made from ISRs to the ISR handler task   */
+        if (p_tcb == (OS_TCB *)0) {                             /* Resolve 'self' while still in the ISR                */
+            p_tcb = OSTCBCurPtr;
+        }
+        OS_IntQPost(OS_OBJ_TYPE_TASK_SIGNAL,
+                    (void *)p_tcb,
+                    (void *)0,
+                    0u,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_TASK_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+#if (OS_CFG_TS_EN > 0u)
+    if (OSTCBCurPtr == &OSIntQTaskTCB) {                        /* Keep the time stamp of a replayed ISR post           */
+        ts = OSIntQTaskTS;
+    }
+#endif
+#endif
+
     OS_TRACE_TASK_SEM_POST(p_tcb);
 
-    CPU_CRITICAL_ENTER();
+    OS_CRITICAL_ENTER();
     if (p_tcb == (OS_TCB *)0) {                                 /* Post signal to 'self'?                               */
         p_tcb = OSTCBCurPtr;
     }
@@ -1883,14 +2269,14 @@ OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
         case OS_TASK_STATE_SUSPENDED:
         case OS_TASK_STATE_DLY_SUSPENDED:
              if (p_tcb->SemCtr == (OS_SEM_CTR)-1) {
-                 CPU_CRITICAL_EXIT();
+                 OS_CRITICAL_EXIT();
                 *p_err = OS_ERR_SEM_OVF;
                  OS_TRACE_SEM_POST_EXIT(*p_err);
                  return (0u);
              }
              p_tcb->SemCtr++;                                   /* Task signaled is not pending on anything             */
              ctr = p_tcb->SemCtr;
-             CPU_CRITICAL_EXIT();
+             OS_CRITICAL_EXIT();
              break;
 
         case OS_TASK_STATE_PEND:
@@ -1904,25 +2290,25 @@ OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
                           0u,
                           ts);
                  ctr = p_tcb->SemCtr;
-                 CPU_CRITICAL_EXIT();
+                 OS_CRITICAL_EXIT();
                  if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
                      OSSched();                                 /* Run the scheduler                                    */
                  }
              } else {
                  if (p_tcb->SemCtr == (OS_SEM_CTR)-1) {
-                     CPU_CRITICAL_EXIT();
+                     OS_CRITICAL_EXIT();
                     *p_err = OS_ERR_SEM_OVF;
                      OS_TRACE_SEM_POST_EXIT(*p_err);
                      return (0u);
                  }
                  p_tcb->SemCtr++;                               /* No,  Task signaled is NOT pending on semaphore ...   */
                  ctr = p_tcb->SemCtr;                           /* ... it must be waiting on something else             */
-                 CPU_CRITICAL_EXIT();
+                 OS_CRITICAL_EXIT();
              }
              break;
 
         default:
-             CPU_CRITICAL_EXIT();
+             OS_CRITICAL_EXIT();
             *p_err = OS_ERR_STATE_INVALID;
              ctr   = 0u;
              break;
@@ -2225,6 +2611,14 @@ void   OSTaskSuspend (OS_TCB  *p_tcb,
     }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (p_tcb == &OSIntQTaskTCB) {                              /* Not allowed to suspend the ISR handler task          */
+       *p_err = OS_ERR_TASK_SUSPEND_INT_HANDLER;
+        OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_TASK_SUSPEND_INT_HANDLER);
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
     if (p_tcb == (OS_TCB *)0) {                                 /* See if specified to suspend self                     */
         if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Can't suspend self when the kernel isn't running     */
@@ -2368,16 +2762,546 @@ void  OSTaskTimeQuantaSet (OS_TCB   *p_tcb,
 
 /*
 ************************************************************************************************************************
-*                                            ADD/REMOVE TASK TO/FROM DEBUG LIST
+*                                                 SET A TASK'S DEADLINE
 *
-* Description: These functions are called by uC/OS-III to add or remove an OS_TCB from the debug list.
+* Description: This function is called to set the relative deadline of a task scheduled Earliest Deadline First (EDF).
+*              Tasks at the OS_CFG_SCHED_EDF_PRIO level run in the order of the absolute deadline of their current job.
 *
-* Arguments  : p_tcb     is a pointer to the OS_TCB to add/remove
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
 *
-* Returns    : none
+*              deadline     is the number of ticks within which each job of the task must complete, counted from its
+*                           release.  0 removes the deadline.
 *
-* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
-************************************************************************************************************************
+*              p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE       Upon success
+*                               OS_ERR_SET_ISR    If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The current job is considered released now.  Each OSTimeDly() with OS_OPT_TIME_PERIODIC then releases
+*                 the next job at the end of the delay, with an absolute deadline of its release time plus 'deadline'.
+*
+*              2) Tasks without a deadline run ahead of the tasks with a deadline at the EDF level, see
+*                 OS_RdyListInsertEDF().
+*
+*              3) The deadline only affects the order of the tasks at the OS_CFG_SCHED_EDF_PRIO level, tasks at other
+*                 priorities keep being scheduled by priority.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+void  OSTaskDeadlineSet (OS_TCB   *p_tcb,
+                         OS_TICK   deadline,
+                         OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+
+    p_tcb->DeadlineRel = deadline;
+#if (OS_CFG_DYN_TICK_EN > 0u)                                   /* See Note #1                                          */
+    p_tcb->DeadlineAbs = OSTickCtr + OS_DynTickGet() + deadline;
+#else
+    p_tcb->DeadlineAbs = OSTickCtr + deadline;
+#endif
+
+    if ((p_tcb->TaskState == OS_TASK_STATE_RDY) &&              /* Re-sort the task if it's ready at the EDF level      */
+        (p_tcb->Prio      == OS_CFG_SCHED_EDF_PRIO)) {
+        OS_RdyListRemove(p_tcb);
+        OS_PrioInsert(p_tcb->Prio);
+        OS_RdyListInsertEDF(p_tcb);
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* Only schedule when the kernel is running             */
+        OSSched();
+    }
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                         SET A TASK'S PREEMPTION THRESHOLD
+*
+* Description: This function is called to set the preemption threshold of a task.  While the task runs, only the tasks
+*              with a priority higher than its threshold preempt it, which saves the context switches between tasks
+*              that cooperate.
+*
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
+*
+*              prio_thres   is the preemption threshold.  Only the tasks with a priority strictly higher (i.e. lower
+*                           value) than 'prio_thres' preempt the task.  A threshold equal to or lower than the task's
+*                           priority removes the threshold.
+*
+*              p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE            Upon success
+*                               OS_ERR_PRIO_INVALID    If 'prio_thres' is beyond the lowest priority, or is 0 when
+*                                                      posts from ISRs are deferred
+*                               OS_ERR_SET_ISR         If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) A task preempted by a task above its threshold keeps its threshold: the tasks at or below the threshold
+*                 don't run before it, see OS_SchedPreemptThres().
+*
+*              2) The tasks at the task's own priority don't preempt it either, a task with a threshold is thus not time
+*                 sliced by round-robin scheduling and OSSchedRoundRobinYield() doesn't switch to another task.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+void  OSTaskPreemptThresSet (OS_TCB   *p_tcb,
+                             OS_PRIO   prio_thres,
+                             OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((prio_thres  > (OS_CFG_PRIO_MAX - 2u)) &&               /* Threshold must be within 0 and OS_CFG_PRIO_MAX-1     */
+        (prio_thres != (OS_CFG_PRIO_MAX - 1u))) {
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (prio_thres == 0u) {                                     /* The ISR handler task must always be able to preempt  */
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+
+    p_tcb->PreemptThres = prio_thres;
+    if (prio_thres >= p_tcb->Prio) {                            /* Threshold removed, stop applying it                  */
+        OS_SchedPreemptThresDel(p_tcb);
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* A lower threshold may let another task preempt       */
+        OSSched();
+    }
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               SET A TASK'S CPU BUDGET
+*
+* Description: This function is called to limit the CPU time a task can use per replenishment period.  A task that
+*              exhausts its budget is demoted to a lower priority or suspended until its budget is replenished, so
+*              that a runaway task can't starve the tasks below it.
+*
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
+*
+*              budget       is the number of ticks the task may run per period.  0 removes the budget.
+*
+*              period       is the replenishment period, in ticks.  It can't be shorter than 'budget'.
+*
+*              prio         is the priority the task runs at while out of budget, with OS_OPT_TASK_BUDGET_DEMOTE.
+*
+*              opt          is the action taken when the task exhausts its budget:
+*
+*                               OS_OPT_TASK_BUDGET_DEMOTE     Lower the task's priority to 'prio'
+*                               OS_OPT_TASK_BUDGET_SUSPEND    Suspend the task
+*
+*              p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE                   Upon success
+*                               OS_ERR_OPT_INVALID            If you specified an invalid option
+*                               OS_ERR_PRIO_INVALID           If 'prio' is the idle task priority or beyond
+*                               OS_ERR_SET_ISR                If you called this function from an ISR
+*                               OS_ERR_TASK_BUDGET_INVALID    If 'period' is 0 or shorter than 'budget'
+*                               OS_ERR_TASK_INVALID           If you tried to set a budget to the idle task
+*
+* Returns    : none
+*
+* Note(s)    : 1) The budget follows sporadic server rules: the task's period starts with the first tick it runs after a
+*                 replenishment, and the full budget is given back one period later.  Each tick is charged to the task
+*                 that was running when it occurred.  On multi-core configurations, only the task running on the core
+*                 taking the tick interrupt is charged.
+*
+*              2) A task out of budget is counted in its BudgetOverrunCtr.  A demoted task keeps any priority it
+*                 inherited through a mutex, and OSTaskChangePrio() on a demoted task takes effect on replenishment.
+*
+*              3) OS_OPT_TASK_BUDGET_SUSPEND requires OS_CFG_TASK_SUSPEND_EN.  The budget suspension counts as one
+*                 OSTaskSuspend() call: OSTaskResume() ends it early, and a task holding the scheduler lock is only
+*                 suspended once it unlocks it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+void  OSTaskBudgetSet (OS_TCB   *p_tcb,
+                       OS_TICK   budget,
+                       OS_TICK   period,
+                       OS_PRIO   prio,
+                       OS_OPT    opt,
+                       OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    switch (opt) {                                              /* Validate the action taken when out of budget         */
+        case OS_OPT_TASK_BUDGET_DEMOTE:
+             if (prio >= (OS_CFG_PRIO_MAX - 1u)) {              /* Can't demote to the idle task priority               */
+                *p_err = OS_ERR_PRIO_INVALID;
+                 return;
+             }
+             break;
+
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+        case OS_OPT_TASK_BUDGET_SUSPEND:
+             break;
+#endif
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+
+    if (budget > period) {                                      /* Also catches a period of 0 with a budget             */
+       *p_err = OS_ERR_TASK_BUDGET_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+
+#if (OS_CFG_TASK_IDLE_EN > 0u)
+    if (p_tcb == &OSIdleTaskTCB) {                              /* The idle task must always be able to run             */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_INVALID;
+        return;
+    }
+#endif
+
+    if (p_tcb->BudgetExhausted == OS_TRUE) {                    /* Undo the previous action before changing the budget  */
+        OS_TaskBudgetRestore(p_tcb);
+    }
+
+    if ((p_tcb->Budget == 0u) && (budget > 0u)) {              /* Add the task to the list of tasks with a budget      */
+        p_tcb->BudgetNextPtr = OSTaskBudgetListPtr;
+        OSTaskBudgetListPtr  = p_tcb;
+    } else if ((p_tcb->Budget > 0u) && (budget == 0u)) {
+        OS_TaskBudgetUnlink(p_tcb);
+    }
+
+    p_tcb->Budget       = budget;
+    p_tcb->BudgetRemain = budget;                               /* Start a fresh period                                 */
+    p_tcb->BudgetPeriod = period;
+    p_tcb->BudgetOpt    = opt;
+    p_tcb->BudgetPrio   = prio;
+    p_tcb->BudgetActive = OS_FALSE;
+    CPU_CRITICAL_EXIT();
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* Only schedule when the kernel is running             */
+        OSSched();
+    }
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              ENFORCE THE TASKS' CPU BUDGET
+*
+* Description: This function is called on every tick to charge the tick to the task which just ran and to replenish the
+*              budgets whose period ended.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task which was running when the tick occurred.  When posts
+*                        from ISRs are deferred, the tick is processed by the ISR handler task, not by that task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The charged tick belongs to the interval that ended at OSTickCtr, the period of a task therefore
+*                 starts at OSTickCtr - 1 when the task begins consuming its budget.  The tick is charged before the
+*                 budgets are replenished, so that it counts against the period it was used in.
+*
+*              3) A budget is replenished once OSTickCtr reached or passed its replenish tick, not only when both are
+*                 equal.  OSTimeSet() or a dynamic tick step may move OSTickCtr past the replenish tick, which must not
+*                 leave the task suspended.  The difference is taken modulo the range of OS_TICK so that the test still
+*                 holds when OSTickCtr wraps around.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+void  OS_TaskBudgetTick (OS_TCB  *p_tcb)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if ((p_tcb->Budget          >  0u) &&                       /* Charge the tick to the task which just ran           */
+        (p_tcb->BudgetExhausted == OS_FALSE)) {
+        if (p_tcb->BudgetActive == OS_FALSE) {                  /* First tick used since replenished? See Note #2       */
+            p_tcb->BudgetActive        = OS_TRUE;
+            p_tcb->BudgetReplenishTick = (OSTickCtr - 1u) + p_tcb->BudgetPeriod;
+        }
+        if (p_tcb->BudgetRemain > 0u) {
+            p_tcb->BudgetRemain--;
+        }
+        if (p_tcb->BudgetRemain == 0u) {
+            OS_TaskBudgetExhaust(p_tcb);
+        }
+    }
+
+    p_tcb = OSTaskBudgetListPtr;
+    while (p_tcb != (OS_TCB *)0) {                              /* Replenish the budgets whose period ended             */
+        if ((p_tcb->BudgetActive == OS_TRUE) &&                 /* Replenish tick reached or passed? See Note #3        */
+            ((OS_TICK)(OSTickCtr - p_tcb->BudgetReplenishTick) <= ((OS_TICK)~(OS_TICK)0u >> 1u))) {
+            p_tcb->BudgetRemain = p_tcb->Budget;
+            p_tcb->BudgetActive = OS_FALSE;
+            if (p_tcb->BudgetExhausted == OS_TRUE) {
+                OS_TaskBudgetRestore(p_tcb);
+            }
+        }
+        p_tcb = p_tcb->BudgetNextPtr;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                         DEMOTE/SUSPEND A TASK OUT OF CPU BUDGET
+*
+* Description: These functions apply the task's out of budget action when it exhausts its CPU budget and undo it when
+*              the budget is replenished.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) These functions are called with interrupts disabled, possibly from the tick ISR.
+*
+*              3) A task can't be suspended while it holds the scheduler lock, the suspension is retried on the next
+*                 tick with the budget left at 0.
+************************************************************************************************************************
+*/
+
+static  void  OS_TaskBudgetExhaust (OS_TCB  *p_tcb)
+{
+    OS_PRIO  prio_new;
+#if (OS_CFG_MUTEX_EN > 0u)
+    OS_PRIO  prio_high;
+#endif
+
+
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+    if (p_tcb->BudgetOpt == OS_OPT_TASK_BUDGET_SUSPEND) {
+        if ((OSSchedLockNestingCtr > 0u) ||                     /* See Note #3                                          */
+            (p_tcb->TaskState != OS_TASK_STATE_RDY)) {
+            return;
+        }
+        p_tcb->BudgetExhausted = OS_TRUE;
+        p_tcb->BudgetOverrunCtr++;
+        p_tcb->SuspendCtr      = 1u;
+        p_tcb->TaskState       = OS_TASK_STATE_SUSPENDED;
+        OS_RdyListRemove(p_tcb);
+        OS_TRACE_TASK_SUSPEND(p_tcb);
+        return;
+    }
+#endif
+
+    p_tcb->BudgetExhausted = OS_TRUE;
+    p_tcb->BudgetOverrunCtr++;
+    prio_new               = p_tcb->BudgetPrio;
+#if (OS_CFG_MUTEX_EN > 0u)
+    p_tcb->BudgetPrioSave  = p_tcb->BasePrio;
+    p_tcb->BasePrio        = prio_new;
+    if (p_tcb->MutexGrpHeadPtr != (OS_MUTEX *)0) {              /* Keep any priority inherited through a mutex          */
+        prio_high = OS_MutexGrpPrioFindHighest(p_tcb);
+        if (prio_new > prio_high) {
+            prio_new = prio_high;
+        }
+    }
+#else
+    p_tcb->BudgetPrioSave  = p_tcb->Prio;
+#endif
+
+    if (prio_new != p_tcb->Prio) {
+        OS_TaskChangePrio(p_tcb, prio_new);
+    }
+}
+
+
+static  void  OS_TaskBudgetRestore (OS_TCB  *p_tcb)
+{
+    OS_PRIO  prio_new;
+#if (OS_CFG_MUTEX_EN > 0u)
+    OS_PRIO  prio_high;
+#endif
+
+
+    p_tcb->BudgetExhausted = OS_FALSE;
+
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+    if (p_tcb->BudgetOpt == OS_OPT_TASK_BUDGET_SUSPEND) {
+        if (p_tcb->SuspendCtr == 0u) {                          /* Already resumed by OSTaskResume()                    */
+            return;
+        }
+        p_tcb->SuspendCtr--;
+        if (p_tcb->SuspendCtr == 0u) {
+            switch (p_tcb->TaskState) {
+                case OS_TASK_STATE_SUSPENDED:
+                     p_tcb->TaskState = OS_TASK_STATE_RDY;
+                     OS_RdyListInsert(p_tcb);
+                     OS_TRACE_TASK_RESUME(p_tcb);
+                     break;
+
+                case OS_TASK_STATE_DLY_SUSPENDED:
+                     p_tcb->TaskState = OS_TASK_STATE_DLY;
+                     break;
+
+                case OS_TASK_STATE_PEND_SUSPENDED:
+                     p_tcb->TaskState = OS_TASK_STATE_PEND;
+                     break;
+
+                case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+                     p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT;
+                     break;
+
+                default:
+                     break;
+            }
+        }
+        return;
+    }
+#endif
+
+    prio_new               = p_tcb->BudgetPrioSave;
+#if (OS_CFG_MUTEX_EN > 0u)
+    p_tcb->BasePrio        = prio_new;
+    if (p_tcb->MutexGrpHeadPtr != (OS_MUTEX *)0) {              /* Keep any priority inherited through a mutex          */
+        prio_high = OS_MutexGrpPrioFindHighest(p_tcb);
+        if (prio_new > prio_high) {
+            prio_new = prio_high;
+        }
+    }
+#endif
+
+    if (prio_new != p_tcb->Prio) {
+        OS_TaskChangePrio(p_tcb, prio_new);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                      REMOVE A TASK FROM THE LIST OF TASKS WITH A BUDGET
+*
+* Description: This function is called to stop enforcing the CPU budget of a task.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB to remove
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  void  OS_TaskBudgetUnlink (OS_TCB  *p_tcb)
+{
+    OS_TCB  **pp_tcb;
+
+
+    pp_tcb = &OSTaskBudgetListPtr;
+    while (*pp_tcb != (OS_TCB *)0) {
+        if (*pp_tcb == p_tcb) {
+           *pp_tcb               = p_tcb->BudgetNextPtr;
+            p_tcb->BudgetNextPtr = (OS_TCB *)0;
+            break;
+        }
+        pp_tcb = &(*pp_tcb)->BudgetNextPtr;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            ADD/REMOVE TASK TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove an OS_TCB from the debug list.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
 */
 
 #if (OS_CFG_DBG_EN > 0u)
@@ -2448,6 +3372,10 @@ void  OS_TaskInit (OS_ERR  *p_err)
     OSTaskDbgListPtr = (OS_TCB *)0;
 #endif
 
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    OSTaskBudgetListPtr = (OS_TCB *)0;
+#endif
+
     OSTaskQty        = 0u;                                      /* Clear the number of tasks                            */
 
 #if ((OS_CFG_TASK_PROFILE_EN > 0u) || (OS_CFG_DBG_EN > 0u))
@@ -2516,10 +3444,23 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->MsgPtr               = (void             *)0;
     p_tcb->MsgSize              =                     0u;
 #endif
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    p_tcb->PostOpt              =                     0u;
+#endif
 
 #if (OS_CFG_TASK_Q_EN > 0u)
     OS_MsgQInit(&p_tcb->MsgQ,
                  0u);
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_tcb->MsgQPostPendObj.Type       = OS_OBJ_TYPE_TASK_MSG;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_tcb->MsgQPostPendObj.NamePtr    = (CPU_CHAR *)((void *)"?Task");
+    p_tcb->MsgQPostPendObj.DbgNamePtr = (CPU_CHAR *)((void *)" ");
+#endif
+    OS_PendListInit(&p_tcb->MsgQPostPendObj.PendList);
+#endif
 #if (OS_CFG_TASK_PROFILE_EN > 0u)
     p_tcb->MsgQPendTime         =                     0u;
     p_tcb->MsgQPendTimeMax      =                     0u;
@@ -2530,6 +3471,15 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->FlagsPend            =                     0u;
     p_tcb->FlagsOpt             =                     0u;
     p_tcb->FlagsRdy             =                     0u;
+#if (OS_CFG_FLAG_WAIT_LIST_EN > 0u)
+    p_tcb->FlagWaitNextPtr      = (OS_TCB           *)0;
+    p_tcb->FlagWaitPrevPtr      = (OS_TCB           *)0;
+    p_tcb->FlagWaitBit          =  OS_FLAG_WAIT_NONE;
+#endif
+#if (OS_CFG_FLAG_WIDE_EN > 0u)
+    p_tcb->FlagsWidePendPtr     = (OS_FLAGS_WIDE    *)0;
+    p_tcb->FlagsWideRdyPtr      = (OS_FLAGS_WIDE    *)0;
+#endif
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -2569,6 +3519,10 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if (OS_CFG_TICK_EN > 0u)
     p_tcb->TickRemain           =                     0u;
     p_tcb->TickCtrPrev          =                     0u;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    p_tcb->TickCtrMatch         =                     0u;
+    p_tcb->TickSpokePtr         = (OS_TICK_SPOKE    *)0;
+#endif
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
@@ -2576,6 +3530,31 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->TimeQuantaCtr        =                     0u;
 #endif
 
+#if (OS_CFG_SCHED_PREEMPT_THRES_EN > 0u)
+    p_tcb->PreemptThres         =  OS_PRIO_INIT;
+    p_tcb->PreemptThresActive   =  OS_FALSE;
+    p_tcb->PreemptThresNextPtr  = (OS_TCB           *)0;
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    p_tcb->Budget               =                     0u;
+    p_tcb->BudgetRemain         =                     0u;
+    p_tcb->BudgetPeriod         =                     0u;
+    p_tcb->BudgetReplenishTick  =                     0u;
+    p_tcb->BudgetOpt            =  OS_OPT_TASK_BUDGET_DEMOTE;
+    p_tcb->BudgetPrio           =  OS_PRIO_INIT;
+    p_tcb->BudgetPrioSave       =  OS_PRIO_INIT;
+    p_tcb->BudgetActive         =  OS_FALSE;
+    p_tcb->BudgetExhausted      =  OS_FALSE;
+    p_tcb->BudgetOverrunCtr     =                     0u;
+    p_tcb->BudgetNextPtr        = (OS_TCB           *)0;
+#endif
+
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+    p_tcb->DeadlineRel          =                     0u;
+    p_tcb->DeadlineAbs          =                     0u;
+#endif
+
 #if (OS_CFG_TASK_PROFILE_EN > 0u)
     p_tcb->CPUUsage             =                     0u;
     p_tcb->CPUUsageMax          =                     0u;
@@ -2601,9 +3580,20 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->PendObjPtr           = (OS_PEND_OBJ      *)0;
     p_tcb->PendOn               =  OS_TASK_PEND_ON_NOTHING;
     p_tcb->PendStatus           =  OS_STATUS_PEND_OK;
+#if (OS_CFG_PEND_LIST_BUCKET_EN > 0u)
+    p_tcb->PendListPrio         =  OS_PRIO_INIT;
+#endif
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    p_tcb->PendDataTblPtr       = (OS_PEND_DATA     *)0;
+    p_tcb->PendDataTblEntries   =                     0u;
+#endif
     p_tcb->TaskState            =  OS_TASK_STATE_RDY;
 
     p_tcb->Prio                 =  OS_PRIO_INIT;
+#if (OS_CFG_SMP_CORE_QTY > 1u)
+    p_tcb->CoreId               =  OS_CORE_ID_NONE;
+    p_tcb->DelReq               =  OS_FALSE;
+#endif
 #if (OS_CFG_MUTEX_EN > 0u)
     p_tcb->BasePrio             =  OS_PRIO_INIT;
     p_tcb->MutexGrpHeadPtr      = (OS_MUTEX         *)0;
@@ -2617,6 +3607,73 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 }
 
 
+/*
+************************************************************************************************************************
+*                                  READY THE TASKS WAITING FOR ROOM IN A TASK'S QUEUE
+*
+* Description: This function is called when messages left a task's queue, to place the messages of the tasks waiting in
+*              OSTaskQPostWait() into the room freed and ready those tasks, highest priority first.
+*
+* Arguments  : p_tcb      is a pointer to the TCB of the task owning the queue
+*
+* Returns    : OS_TRUE    if a task was readied, and the scheduler should run
+*              OS_FALSE   otherwise
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) This function is called with interrupts disabled.
+*
+*              3) A task stays waiting when the OS_MSG pool is empty, until a later message leaves the queue or its
+*                 timeout expires.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_Q_POST_WAIT_EN > 0u)
+CPU_BOOLEAN  OS_TaskQPostWaitRdy (OS_TCB  *p_tcb)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb_post;
+    CPU_BOOLEAN    rdy;
+    CPU_TS         ts;
+    OS_ERR         err;
+
+
+    p_pend_list = &p_tcb->MsgQPostPendObj.PendList;
+    p_tcb_post  =  OS_PEND_LIST_HEAD_GET(p_pend_list);
+    if (p_tcb_post == (OS_TCB *)0) {                            /* Any task waiting for room?                           */
+        return (OS_FALSE);                                      /* No                                                   */
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    ts  = OS_TS_GET();                                          /* Get timestamp                                        */
+#else
+    ts  = 0u;
+#endif
+    rdy = OS_FALSE;
+    while ((p_tcb_post != (OS_TCB *)0) &&
+           (p_tcb->MsgQ.NbrEntries < p_tcb->MsgQ.NbrEntriesSize)) {
+        OS_MsgQPut(&p_tcb->MsgQ,                                /* Deposit the message of the task in the queue         */
+                   p_tcb_post->MsgPtr,
+                   p_tcb_post->MsgSize,
+                   p_tcb_post->PostOpt,
+                   ts,
+                   &err);
+        if (err != OS_ERR_NONE) {                               /* See Note #3                                          */
+            break;
+        }
+        OS_Post(&p_tcb->MsgQPostPendObj,                        /* Ready the task                                       */
+                p_tcb_post,
+                (void *)0,
+                0u,
+                ts);
+        rdy        = OS_TRUE;
+        p_tcb_post = OS_PEND_LIST_HEAD_GET(p_pend_list);        /* The task readied left the list                       */
+    }
+    return (rdy);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                              CATCH ACCIDENTAL TASK RETURN
@@ -2798,9 +3855,21 @@ void  OS_TaskChangePrio(OS_TCB  *p_tcb,
                      case OS_TASK_PEND_ON_FLAG:
                      case OS_TASK_PEND_ON_Q:
                      case OS_TASK_PEND_ON_SEM:
+#if (OS_CFG_MSG_BUF_EN > 0u)
+                     case OS_TASK_PEND_ON_MSG_BUF:
+#endif
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+                     case OS_TASK_PEND_ON_Q_POST:
+#endif
                           OS_PendListChangePrio(p_tcb);
                           break;
 
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+                     case OS_TASK_PEND_ON_MULTI:
+                          OS_PendMultiChangePrio(p_tcb);
+                          break;
+#endif
+
                      case OS_TASK_PEND_ON_MUTEX:
 #if (OS_CFG_MUTEX_EN > 0u)
                           OS_PendListChangePrio(p_tcb);
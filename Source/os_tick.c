@@ -37,7 +37,15 @@ const  CPU_CHAR  *os_tick__c = "$Id: $";
 ************************************************************************************************************************
 */
 
-static  void  OS_TickListUpdate (OS_TICK  ticks);
+static  void     OS_TickListUpdate   (OS_TICK      ticks);
+static  void     OS_TickListExpire   (OS_TCB      *p_tcb);
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+static  void     OS_TickWheelLink    (OS_TCB      *p_tcb);
+static  void     OS_TickWheelUnlink  (OS_TCB      *p_tcb);
+static  void     OS_TickWheelCascade (CPU_INT08U   lvl);
+static  OS_TICK  OS_TickWheelNext    (void);
+#endif
 
 
 /*
@@ -59,6 +67,12 @@ static  void  OS_TickListUpdate (OS_TICK  ticks);
 
 void  OS_TickInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    CPU_INT08U  lvl;
+    CPU_INT08U  ix;
+
+
+#endif
     *p_err                = OS_ERR_NONE;
 
     OSTickCtr             = 0u;                               /* Clear the tick counter                               */
@@ -67,7 +81,20 @@ void  OS_TickInit (OS_ERR  *p_err)
     OSTickCtrStep         = 0u;
 #endif
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    for (lvl = 0u; lvl < OS_TICK_WHEEL_LVL_QTY; lvl++) {      /* Empty every spoke of the tick wheel                  */
+        for (ix = 0u; ix < OS_TICK_WHEEL_SPOKE_QTY; ix++) {
+            OSTickList.Spokes[lvl][ix].FirstPtr   = (OS_TCB *)0;
+#if (OS_CFG_DBG_EN > 0u)
+            OSTickList.Spokes[lvl][ix].NbrEntries = 0u;
+#endif
+        }
+        OSTickList.LvlNbrEntries[lvl] = 0u;
+    }
+    OSTickList.WheelCtr   = 0u;
+#else
     OSTickList.TCB_Ptr    = (OS_TCB *)0;
+#endif
 
 #if (OS_CFG_DBG_EN > 0u)
     OSTickList.NbrEntries = 0u;
@@ -117,17 +144,122 @@ void  OS_TickUpdate (OS_TICK  ticks)
 #endif
 
 #if (OS_CFG_DYN_TICK_EN > 0u)
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OSTickCtrStep = OS_TickWheelNext();                         /* Interrupt when the next spoke comes due              */
+#else
     if (OSTickList.TCB_Ptr != (OS_TCB *)0) {
         OSTickCtrStep = OSTickList.TCB_Ptr->TickRemain;
     } else {
         OSTickCtrStep = 0u;
     }
+#endif
 
-    OS_DynTickSet(OSTickCtrStep);
+    OS_TickStepSet();
 #endif
     CPU_CRITICAL_EXIT();
 }
 
+/*
+************************************************************************************************************************
+*                                               PROGRAM THE NEXT TICK EVENT
+*
+* Description: This function programs the tick timer for the next tick event in Dynamic Tick Mode (DTM).  The event is
+*              the earlier of the tick list step (OSTickCtrStep) and, when round-robin scheduling has to time slice the
+*              tasks at the running priority, the end of the running task's time quanta.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) This function is assumed to be called with interrupts disabled and OSTickCtr up to date.
+*
+*              3) OSTickCtrStep keeps tracking the tick list only, so that an earlier round-robin event doesn't hide the
+*                 tick list step from the insertion and removal code.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+void  OS_TickStepSet (void)
+{
+    OS_TICK       step;
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+    OS_RDY_LIST  *p_rdy_list;
+    OS_TICK       quanta;
+    OS_TICK       used;
+#endif
+
+
+    step = OSTickCtrStep;
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+    p_rdy_list = &OSRdyList[OSPrioHighRdy];
+    if ((OSSchedRoundRobinEn   == OS_TRUE) &&                   /* Time slicing the tasks at the running priority?      */
+        (OSSchedLockNestingCtr ==      0u) &&
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+        (OSPrioHighRdy         != OS_CFG_SCHED_EDF_PRIO) &&     /* Tasks at the EDF level are not time sliced           */
+#endif
+        (p_rdy_list->HeadPtr   != p_rdy_list->TailPtr)) {
+        quanta = p_rdy_list->HeadPtr->TimeQuantaCtr;
+        used   = OSTickCtr - OSSchedRoundRobinTickCtrPrev;      /* Ticks not yet charged to the running task            */
+        if (quanta > used) {
+            quanta -= used;
+        } else {
+            quanta  = 1u;                                       /* Quanta is over, time slice on the next tick          */
+        }
+        if ((step   ==   0u) ||                                 /* Interrupt at the end of the quanta if it comes first */
+            (quanta <  step)) {
+            step = quanta;
+        }
+    }
+#endif
+
+    OS_DynTickSet(step);
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                         ADVANCE TIME WITHOUT EXPIRING THE LIST
+*
+* Description: This function adds the ticks elapsed since the last tick event to OSTickCtr in Dynamic Tick Mode (DTM),
+*              so that the tick timer can be re-armed, without walking the tick list.
+*
+* Arguments  : ticks          the number of ticks which have elapsed, less than OSTickCtrStep (see Note #3)
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) No entry of the tick list comes due before OSTickCtrStep, so nothing expires nor cascades in 'ticks'
+*                 and only the position of the list relative to OSTickCtr has to move.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+void  OS_TickCtrAdvance (OS_TICK  ticks)
+{
+    OSTickCtr += ticks;                                         /* Keep track of the number of ticks                    */
+
+    OS_TRACE_TICK_INCREMENT(OSTickCtr);
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OSTickList.WheelCtr += ticks;                               /* Spokes are indexed from the wheel time               */
+#else
+    if (OSTickList.TCB_Ptr != (OS_TCB *)0) {
+        OSTickList.TCB_Ptr->TickRemain -= ticks;                /* The head's delta is relative to OSTickCtr            */
+    }
+#endif
+    if (OSTickCtrStep != 0u) {
+        OSTickCtrStep -= ticks;
+    }
+}
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                      INSERT
@@ -151,9 +283,54 @@ void  OS_TickUpdate (OS_TICK  ticks)
 *              2) This function supports both Periodic Tick Mode (PTM) and Dynamic Tick Mode (DTM).
 *
 *              3) PTM should always call this function with elapsed == 0u.
+*
+*              4) When the tick wheel is enabled, the task is linked in O(1) in the spoke matching its expiry time.  In
+*                 DTM, the tick timer is only re-armed when the new entry expires before the programmed tick step.
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
+                                OS_TICK   elapsed,
+                                OS_TICK   tick_base,
+                                OS_TICK   time)
+{
+    OS_TICK  delta;
+
+
+    delta = (time + tick_base) - (OSTickCtr + elapsed);         /* How many ticks until our delay expires?              */
+
+    if (delta == 0u) {
+        p_tcb->TickRemain = 0u;
+        return (OS_FALSE);
+    }
+
+    OS_TRACE_TASK_DLY(delta);
+
+    p_tcb->TickRemain   = delta;                                /* Delay as seen at insertion time                      */
+    p_tcb->TickCtrMatch = OSTickList.WheelCtr + elapsed + delta;
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    if ((OSTickCtrStep     ==            0u) ||                 /* If our entry expires before the programmed step  ... */
+        ((elapsed + delta) <  OSTickCtrStep)) {
+        if (elapsed != 0u) {
+            OSTickCtr += elapsed;                               /* ... bring the wheel up to date                   ... */
+            OS_TRACE_TICK_INCREMENT(OSTickCtr);
+            OS_TickListUpdate(elapsed);
+        }
+        OS_TickWheelLink(p_tcb);
+        OSTickCtrStep = OS_TickWheelNext();                     /* ... and re-arm the tick timer for the new step.      */
+        OS_TickStepSet();
+        return (OS_TRUE);
+    }
+#endif
+
+    OS_TickWheelLink(p_tcb);
+
+    return (OS_TRUE);
+}
+
+#else
 CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
                                 OS_TICK   elapsed,
                                 OS_TICK   tick_base,
@@ -188,7 +365,7 @@ CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
         }
 
         OSTickCtrStep       = delta;
-        OS_DynTickSet(OSTickCtrStep);
+        OS_TickStepSet();
 #endif
 #if (OS_CFG_DBG_EN > 0u)
         p_list->NbrEntries  = 1u;                               /* List contains 1 entry                                */
@@ -220,7 +397,7 @@ CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
         }
                                                                 /* In DTM, a new list head must update the tick     ... */
         OSTickCtrStep        =  delta;                          /* ... timer to interrupt at the new delay value.       */
-        OS_DynTickSet(OSTickCtrStep);
+        OS_TickStepSet();
 #endif
 
         return (OS_TRUE);
@@ -256,6 +433,7 @@ CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
 
     return (OS_TRUE);
 }
+#endif
 
 /*
 ************************************************************************************************************************
@@ -338,6 +516,10 @@ void  OS_TickListInsertDly (OS_TCB   *p_tcb,
         }
 
         p_tcb->TickCtrPrev += time;                             /* Update for the next time we perform a periodic dly.  */
+#if (OS_CFG_SCHED_EDF_EN > 0u)
+        p_tcb->DeadlineAbs  = p_tcb->TickCtrPrev                /* Next job is released at the end of the delay     ... */
+                            + p_tcb->DeadlineRel;               /* ... and must complete within its relative deadline.  */
+#endif
 
     } else {                                                    /* RELATIVE time delay mode                             */
 #if (OS_CFG_DYN_TICK_EN > 0u)                                   /* Our base is always the current system time.          */
@@ -374,6 +556,33 @@ void  OS_TickListInsertDly (OS_TCB   *p_tcb,
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+void  OS_TickListRemove (OS_TCB  *p_tcb)
+{
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK  elapsed;
+
+
+    elapsed = OS_DynTickGet();
+#endif
+
+    OS_TickWheelUnlink(p_tcb);
+    p_tcb->TickRemain = 0u;
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    if (OS_TickWheelNext() == 0u) {                             /* Stop the tick timer once the wheel is empty.         */
+        if (elapsed != 0u) {
+            OSTickCtr += elapsed;                               /* Keep track of time.                                  */
+            OS_TRACE_TICK_INCREMENT(OSTickCtr);
+            OS_TickListUpdate(elapsed);
+        }
+        OSTickCtrStep = 0u;
+        OS_TickStepSet();
+    }
+#endif
+}
+
+#else
 void  OS_TickListRemove (OS_TCB  *p_tcb)
 {
     OS_TCB        *p_tcb1;
@@ -403,7 +612,7 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)
                 OS_TRACE_TICK_INCREMENT(OSTickCtr);
             }
             OSTickCtrStep        =           0u;
-            OS_DynTickSet(OSTickCtrStep);
+            OS_TickStepSet();
 #endif
         } else {
             p_tcb2->TickPrevPtr  = (OS_TCB *)0;
@@ -421,7 +630,7 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)
                     p_tcb2->TickRemain -= elapsed;              /* We must account for any time which has passed.       */
                 }
                 OSTickCtrStep           = p_tcb2->TickRemain;
-                OS_DynTickSet(OSTickCtrStep);
+                OS_TickStepSet();
             }
 #endif
             p_tcb->TickNextPtr          = (OS_TCB *)0;
@@ -441,6 +650,7 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)
         p_tcb->TickRemain        =           0u;
     }
 }
+#endif
 
 /*
 ************************************************************************************************************************
@@ -453,9 +663,65 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) When the tick wheel is enabled, the wheel is advanced directly to each spoke holding entries so the
+*                 work done is bounded by the number of entries that cascade or expire, not by 'ticks'.
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+static  void  OS_TickListUpdate (OS_TICK  ticks)
+{
+    OS_TCB         *p_tcb;
+    OS_TICK_LIST   *p_list;
+    OS_TICK_SPOKE  *p_spoke;
+    OS_TICK         step;
+    CPU_INT08U      lvl;
+#if (OS_CFG_DBG_EN > 0u)
+    OS_OBJ_QTY      nbr_updated;
+#endif
+
+
+
+#if (OS_CFG_DBG_EN > 0u)
+    nbr_updated = 0u;
+#endif
+    p_list      = &OSTickList;
+    while (ticks > 0u) {
+        step = 1u;
+        if (ticks > 1u) {                                       /* Skip over spokes which are known to be empty         */
+            step = OS_TickWheelNext();
+            if ((step == 0u) || (step > ticks)) {
+                step = ticks;
+            }
+        }
+        p_list->WheelCtr += step;
+        ticks            -= step;
+
+        lvl = 1u;                                               /* Cascade higher levels reaching a spoke boundary      */
+        while ((lvl < OS_TICK_WHEEL_LVL_QTY) &&
+               ((p_list->WheelCtr & (((OS_TICK)1u << (lvl * OS_TICK_WHEEL_SPOKE_BITS)) - 1u)) == 0u)) {
+            OS_TickWheelCascade(lvl);
+            lvl++;
+        }
+
+        p_spoke = &p_list->Spokes[0u][p_list->WheelCtr & OS_TICK_WHEEL_SPOKE_MASK];
+        while (p_spoke->FirstPtr != (OS_TCB *)0) {              /* Expire every task in the current spoke               */
+            p_tcb = p_spoke->FirstPtr;
+            OS_TickWheelUnlink(p_tcb);
+            p_tcb->TickRemain = 0u;
+#if (OS_CFG_DBG_EN > 0u)
+            nbr_updated++;
+#endif
+            OS_TickListExpire(p_tcb);
+        }
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    p_list->NbrUpdated = nbr_updated;
+#endif
+}
+
+#else
 static  void  OS_TickListUpdate (OS_TICK  ticks)
 {
     OS_TCB        *p_tcb;
@@ -463,10 +729,6 @@ static  void  OS_TickListUpdate (OS_TICK  ticks)
 #if (OS_CFG_DBG_EN > 0u)
     OS_OBJ_QTY     nbr_updated;
 #endif
-#if (OS_CFG_MUTEX_EN > 0u)
-    OS_TCB        *p_tcb_owner;
-    OS_PRIO        prio_new;
-#endif
 
 
 
@@ -488,64 +750,7 @@ static  void  OS_TickListUpdate (OS_TICK  ticks)
             nbr_updated++;
 #endif
 
-            switch (p_tcb->TaskState) {
-                case OS_TASK_STATE_DLY:
-                     p_tcb->TaskState = OS_TASK_STATE_RDY;
-                     OS_RdyListInsert(p_tcb);                            /* Insert the task in the ready list                    */
-                     break;
-
-                case OS_TASK_STATE_DLY_SUSPENDED:
-                     p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
-                     break;
-
-                default:
-#if (OS_CFG_MUTEX_EN > 0u)
-                     p_tcb_owner = (OS_TCB *)0;
-                     if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
-                         p_tcb_owner = (OS_TCB *)((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
-                     }
-#endif
-
-#if (OS_MSG_EN > 0u)
-                     p_tcb->MsgPtr  = (void *)0;
-                     p_tcb->MsgSize = 0u;
-#endif
-#if (OS_CFG_TS_EN > 0u)
-                     p_tcb->TS      = OS_TS_GET();
-#endif
-                     OS_PendListRemove(p_tcb);                           /* Remove task from pend list                           */
-
-                     switch (p_tcb->TaskState) {
-                         case OS_TASK_STATE_PEND_TIMEOUT:
-                              OS_RdyListInsert(p_tcb);                   /* Insert the task in the ready list                    */
-                              p_tcb->TaskState  = OS_TASK_STATE_RDY;
-                              break;
-
-                         case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-                              p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
-                              break;
-
-                         default:
-                              break;
-                     }
-                     p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;         /* Indicate pend timed out                              */
-                     p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;        /* Indicate no longer pending                           */
-
-#if (OS_CFG_MUTEX_EN > 0u)
-                     if (p_tcb_owner != (OS_TCB *)0) {
-                         if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
-                             (p_tcb_owner->Prio == p_tcb->Prio)) {       /* Has the owner inherited a priority?                  */
-                             prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
-                             prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
-                             if (prio_new != p_tcb_owner->Prio) {
-                                 OS_TaskChangePrio(p_tcb_owner, prio_new);
-                                 OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
-                             }
-                         }
-                     }
-#endif
-                     break;
-            }
+            OS_TickListExpire(p_tcb);
 
             p_list->TCB_Ptr = p_tcb->TickNextPtr;
             p_tcb           = p_list->TCB_Ptr;                           /* Get 'p_tcb' again for loop                           */
@@ -572,5 +777,261 @@ static  void  OS_TickListUpdate (OS_TICK  ticks)
     p_list->NbrUpdated = nbr_updated;
 #endif
 }
+#endif
+
+/*
+************************************************************************************************************************
+*                                        READY A TASK WHOSE DELAY OR TIMEOUT EXPIRED
+*
+* Description: This function moves a task whose delay or pend timeout has expired out of the delayed/pending state.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task which was just removed from the tick list.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickListExpire (OS_TCB  *p_tcb)
+{
+#if (OS_CFG_MUTEX_EN > 0u)
+    OS_TCB   *p_tcb_owner;
+    OS_PRIO   prio_new;
+#endif
+
+
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_DLY:
+             p_tcb->TaskState = OS_TASK_STATE_RDY;
+             OS_RdyListInsert(p_tcb);                                    /* Insert the task in the ready list                    */
+             break;
+
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
+             break;
+
+        default:
+#if (OS_CFG_MUTEX_EN > 0u)
+             p_tcb_owner = (OS_TCB *)0;
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
+                 p_tcb_owner = (OS_TCB *)((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
+             }
+#endif
+
+#if (OS_MSG_EN > 0u)
+             p_tcb->MsgPtr  = (void *)0;
+             p_tcb->MsgSize = 0u;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+             p_tcb->TS      = OS_TS_GET();
+#endif
+             OS_PendListRemove(p_tcb);                                   /* Remove task from pend list                           */
+
+             switch (p_tcb->TaskState) {
+                 case OS_TASK_STATE_PEND_TIMEOUT:
+                      OS_RdyListInsert(p_tcb);                           /* Insert the task in the ready list                    */
+                      p_tcb->TaskState  = OS_TASK_STATE_RDY;
+                      break;
+
+                 case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+                      p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
+                      break;
+
+                 default:
+                      break;
+             }
+             p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;                 /* Indicate pend timed out                              */
+             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;                /* Indicate no longer pending                           */
+
+#if (OS_CFG_MUTEX_EN > 0u)
+             if (p_tcb_owner != (OS_TCB *)0) {
+                 if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
+                     (p_tcb_owner->Prio == p_tcb->Prio)) {               /* Has the owner inherited a priority?                  */
+                     prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+                     prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+                     if (prio_new != p_tcb_owner->Prio) {
+                         OS_TaskChangePrio(p_tcb_owner, prio_new);
+                         OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
+                     }
+                 }
+             }
+#endif
+             break;
+    }
+}
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+/*
+************************************************************************************************************************
+*                                             LINK A TASK IN THE TICK WHEEL
+*
+* Description: This function links a task in the tick wheel spoke matching its 'TickCtrMatch' value.  The level used is
+*              that of the most significant spoke digit in which the match value differs from the current wheel time.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task to link.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A task whose match value equals the current wheel time is linked in the current level 0 spoke.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickWheelLink (OS_TCB  *p_tcb)
+{
+    OS_TICK_LIST   *p_list;
+    OS_TICK_SPOKE  *p_spoke;
+    OS_TICK         diff;
+    CPU_INT08U      lvl;
+
+
+    p_list = &OSTickList;
+    diff   = (p_tcb->TickCtrMatch ^ p_list->WheelCtr) >> OS_TICK_WHEEL_SPOKE_BITS;
+    lvl    = 0u;
+    while (diff != 0u) {                                        /* Find the most significant digit which differs        */
+        diff >>= OS_TICK_WHEEL_SPOKE_BITS;
+        lvl++;
+    }
+
+    p_spoke             = &p_list->Spokes[lvl][(p_tcb->TickCtrMatch >> (lvl * OS_TICK_WHEEL_SPOKE_BITS)) & OS_TICK_WHEEL_SPOKE_MASK];
+    p_tcb->TickSpokePtr =  p_spoke;
+    p_tcb->TickPrevPtr  = (OS_TCB *)0;                          /* Insert at the beginning of the spoke                 */
+    p_tcb->TickNextPtr  =  p_spoke->FirstPtr;
+    if (p_spoke->FirstPtr != (OS_TCB *)0) {
+        p_spoke->FirstPtr->TickPrevPtr = p_tcb;
+    }
+    p_spoke->FirstPtr   =  p_tcb;
+
+    p_list->LvlNbrEntries[lvl]++;
+#if (OS_CFG_DBG_EN > 0u)
+    p_spoke->NbrEntries++;
+    p_list->NbrEntries++;
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                           UNLINK A TASK FROM THE TICK WHEEL
+*
+* Description: This function unlinks a task from the tick wheel spoke it was linked in.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task to unlink.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickWheelUnlink (OS_TCB  *p_tcb)
+{
+    OS_TICK_SPOKE  *p_spoke;
+    OS_TCB         *p_tcb1;
+    OS_TCB         *p_tcb2;
+    CPU_INT08U      lvl;
+
+
+    p_spoke = p_tcb->TickSpokePtr;
+    lvl     = (CPU_INT08U)((CPU_ADDR)(p_spoke - &OSTickList.Spokes[0u][0u]) / OS_TICK_WHEEL_SPOKE_QTY);
+    p_tcb1  = p_tcb->TickPrevPtr;
+    p_tcb2  = p_tcb->TickNextPtr;
+    if (p_tcb1 == (OS_TCB *)0) {
+        p_spoke->FirstPtr   = p_tcb2;
+    } else {
+        p_tcb1->TickNextPtr = p_tcb2;
+    }
+    if (p_tcb2 != (OS_TCB *)0) {
+        p_tcb2->TickPrevPtr = p_tcb1;
+    }
+    p_tcb->TickNextPtr  = (OS_TCB        *)0;
+    p_tcb->TickPrevPtr  = (OS_TCB        *)0;
+    p_tcb->TickSpokePtr = (OS_TICK_SPOKE *)0;
+
+    OSTickList.LvlNbrEntries[lvl]--;
+#if (OS_CFG_DBG_EN > 0u)
+    p_spoke->NbrEntries--;
+    OSTickList.NbrEntries--;
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                         CASCADE A SPOKE TO THE LOWER LEVELS
+*
+* Description: This function re-links every task of the current spoke of a level once the wheel time reaches it.  Each
+*              task moves to a lower level since its match value now only differs from the wheel time in lower digits.
+*
+* Arguments  : lvl            is the level of the spoke to cascade (1 or higher).
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickWheelCascade (CPU_INT08U  lvl)
+{
+    OS_TICK_SPOKE  *p_spoke;
+    OS_TCB         *p_tcb;
+
+
+    p_spoke = &OSTickList.Spokes[lvl][(OSTickList.WheelCtr >> (lvl * OS_TICK_WHEEL_SPOKE_BITS)) & OS_TICK_WHEEL_SPOKE_MASK];
+    while (p_spoke->FirstPtr != (OS_TCB *)0) {
+        p_tcb = p_spoke->FirstPtr;
+        OS_TickWheelUnlink(p_tcb);
+        OS_TickWheelLink(p_tcb);
+    }
+}
+
+/*
+************************************************************************************************************************
+*                                       NUMBER OF TICKS TO THE NEXT TICK WHEEL EVENT
+*
+* Description: This function returns the number of ticks until the wheel time reaches the next spoke holding entries,
+*              at which point the spoke either expires (level 0) or cascades (higher levels).
+*
+* Arguments  : none
+*
+* Returns    : The number of ticks to the next event, or 0 if the tick wheel is empty.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Entries of a level always come due before the next spoke boundary of the level above it, so only the
+*                 lowest level holding entries needs to be searched.
+************************************************************************************************************************
+*/
+
+static  OS_TICK  OS_TickWheelNext (void)
+{
+    OS_TICK_LIST  *p_list;
+    OS_TICK        ix;
+    OS_TICK        dist;
+    CPU_INT08U     lvl;
+    CPU_INT08U     shift;
+
+
+    p_list = &OSTickList;
+    lvl    = 0u;
+    while ((lvl                       < OS_TICK_WHEEL_LVL_QTY) &&
+           (p_list->LvlNbrEntries[lvl] == 0u)) {
+        lvl++;
+    }
+    if (lvl == OS_TICK_WHEEL_LVL_QTY) {                         /* Is the wheel empty?                                  */
+        return (0u);
+    }
+
+    shift = lvl * OS_TICK_WHEEL_SPOKE_BITS;
+    ix    = (p_list->WheelCtr >> shift) & OS_TICK_WHEEL_SPOKE_MASK;
+    dist  = 1u;
+    while ((dist < OS_TICK_WHEEL_SPOKE_QTY) &&                  /* Find the first spoke in use past the current one     */
+           (p_list->Spokes[lvl][(ix + dist) & OS_TICK_WHEEL_SPOKE_MASK].FirstPtr == (OS_TCB *)0)) {
+        dist++;
+    }
+
+    return ((dist << shift) - (p_list->WheelCtr & (((OS_TICK)1u << shift) - 1u)));
+}
+#endif
 
 #endif                                                                   /* #if OS_CFG_TICK_EN                                   */
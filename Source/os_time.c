@@ -549,7 +549,9 @@ void  OSTimeSet (OS_TICK   ticks,
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) When posts from ISRs are deferred (OS_CFG_ISR_POST_DEFERRED_EN), the tick is deferred to the ISR handler
+*                 task as well.  Timeouts remove tasks from the pend lists of the kernel objects, which the post
+*                 services then update with the scheduler locked rather than with interrupts disabled.
 ************************************************************************************************************************
 */
 
@@ -561,13 +563,21 @@ void  OSTimeTick (void)
 
     OSTimeTickHook();                                           /* Call user definable hook                             */
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    OS_IntQTickPost(1u);                                        /* See Note #1                                          */
+#else
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
-    OS_SchedRoundRobin(&OSRdyList[OSPrioCur]);                  /* Update quanta ctr for the task which just ran        */
+    OS_SchedRoundRobin(&OSRdyList[OSPrioCur], 1u);              /* Update quanta ctr for the task which just ran        */
 #endif
 
 #if (OS_CFG_TICK_EN > 0u)
     OS_TickUpdate(1u);                                          /* Update from the ISR                                  */
 #endif
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    OS_TaskBudgetTick(OSTCBCurPtr);                             /* Charge the tick to the task's CPU budget             */
+#endif
+#endif
 }
 
 
@@ -582,7 +592,7 @@ void  OSTimeTick (void)
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) When posts from ISRs are deferred, the ticks are processed by the ISR handler task, see OSTimeTick().
 ************************************************************************************************************************
 */
 
@@ -595,6 +605,14 @@ void  OSTimeDynTick (OS_TICK  ticks)
 
     OSTimeTickHook();
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    OS_IntQTickPost(ticks);                                     /* See Note #1                                          */
+#else
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+    OS_SchedRoundRobin(&OSRdyList[OSPrioCur], ticks);           /* Charge the ticks to the task which just ran          */
+#endif
+
     OS_TickUpdate(ticks);                                       /* Update from the ISR                                  */
+#endif
 }
 #endif
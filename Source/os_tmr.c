@@ -45,6 +45,14 @@ static  void  OS_TmrCondCreate(void);
 static  void  OS_TmrCondSignal(void);
 static  void  OS_TmrCondWait  (OS_TICK  timeout);
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+static  void     OS_TmrWheelLink    (OS_TMR      *p_tmr);
+static  void     OS_TmrWheelUnlink  (OS_TMR      *p_tmr);
+static  void     OS_TmrWheelCascade (CPU_INT08U   lvl);
+static  void     OS_TmrWheelAdvance (OS_TICK      ticks);
+static  OS_TICK  OS_TmrWheelNext    (void);
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -191,6 +199,10 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
     p_tmr->CallbackPtrArg =  p_callback_arg;
     p_tmr->NextPtr        = (OS_TMR *)0;
     p_tmr->PrevPtr        = (OS_TMR *)0;
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    p_tmr->Match          =  0u;
+    p_tmr->SpokePtr       = (OS_TMR_SPOKE *)0;
+#endif
 
 #if (OS_CFG_DBG_EN > 0u)
     OS_TmrDbgListAdd(p_tmr);
@@ -370,7 +382,9 @@ CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr,
 OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
                          OS_ERR  *p_err)
 {
+#if (OS_CFG_TMR_WHEEL_EN == 0u)
     OS_TMR   *p_tmr1;
+#endif
     OS_TICK   remain;
 
 
@@ -413,6 +427,13 @@ OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
 
     switch (p_tmr->State) {
         case OS_TMR_STATE_RUNNING:
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+             if (p_tmr->SpokePtr == &OSTmrWheel.Expired) {      /* Expired timers wait for their callback               */
+                 remain = 0u;
+             } else {
+                 remain = p_tmr->Match - OSTmrTaskTickBase;
+             }
+#else
              p_tmr1 = OSTmrListPtr;
              remain = 0u;
              while (p_tmr1 != (OS_TMR *)0) {                    /* Add up all the deltas up until the current timer     */
@@ -422,6 +443,7 @@ OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
                  }
                  p_tmr1 = p_tmr1->NextPtr;
              }
+#endif
              remain /= OSTmrToTicksMult;
             *p_err   = OS_ERR_NONE;
              break;
@@ -1005,6 +1027,10 @@ void  OS_TmrClr (OS_TMR  *p_tmr)
     p_tmr->CallbackPtrArg = (void              *)0;
     p_tmr->NextPtr        = (OS_TMR            *)0;
     p_tmr->PrevPtr        = (OS_TMR            *)0;
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    p_tmr->Match          =                      0u;
+    p_tmr->SpokePtr       = (OS_TMR_SPOKE      *)0;
+#endif
 }
 
 
@@ -1090,12 +1116,28 @@ void  OS_TmrDbgListRemove (OS_TMR  *p_tmr)
 
 void  OS_TmrInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    CPU_INT08U  lvl;
+    CPU_INT08U  ix;
+
+
+#endif
 #if (OS_CFG_DBG_EN > 0u)
     OSTmrQty             =           0u;                        /* Keep track of the number of timers created           */
     OSTmrDbgListPtr      = (OS_TMR *)0;
 #endif
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    for (lvl = 0u; lvl < OS_TMR_WHEEL_LVL_QTY; lvl++) {         /* Create an empty timer wheel                          */
+        for (ix = 0u; ix < OS_TMR_WHEEL_SPOKE_QTY; ix++) {
+            OSTmrWheel.Spokes[lvl][ix].FirstPtr = (OS_TMR *)0;
+        }
+        OSTmrWheel.LvlNbrEntries[lvl] = 0u;
+    }
+    OSTmrWheel.Expired.FirstPtr = (OS_TMR *)0;
+#else
     OSTmrListPtr         = (OS_TMR *)0;                         /* Create an empty timer list                           */
+#endif
 #if (OS_CFG_DBG_EN > 0u)
     OSTmrListEntries     =           0u;
 #endif
@@ -1169,9 +1211,36 @@ void  OS_TmrInit (OS_ERR  *p_err)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) When the timer wheel is enabled, the timer is linked in O(1) and the timer task is only signaled when
+*                 its next wake up time changes.
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+void OS_TmrLink (OS_TMR   *p_tmr,
+                 OS_TICK   time)
+{
+    OS_TICK  next;
+
+
+    next = OS_TmrWheelNext();
+    if (next == 0u) {                                           /* Is the wheel empty?                                  */
+        OSTmrTaskTickBase = time;                               /* Yes, the wheel time starts from now                  */
+    }
+
+    p_tmr->Match = time + p_tmr->Remain;
+    OS_TmrWheelLink(p_tmr);
+#if (OS_CFG_DBG_EN > 0u)
+    OSTmrListEntries++;
+#endif
+
+    if (OS_TmrWheelNext() != next) {                            /* Reload the timer task's timeout if it changed        */
+        OS_TmrCondSignal();
+    }
+}
+
+#else
 void OS_TmrLink (OS_TMR   *p_tmr,
                  OS_TICK   time)
 {
@@ -1247,6 +1316,7 @@ void OS_TmrLink (OS_TMR   *p_tmr,
         p_tmr1->NextPtr  = p_tmr;
     }
 }
+#endif
 
 
 /*
@@ -1266,6 +1336,31 @@ void OS_TmrLink (OS_TMR   *p_tmr,
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+void  OS_TmrUnlink (OS_TMR   *p_tmr,
+                    OS_TICK   time)
+{
+    OS_TICK  next;
+    OS_TICK  next_new;
+
+
+    next = OS_TmrWheelNext();
+    OS_TmrWheelUnlink(p_tmr);
+    p_tmr->Remain = 0u;
+#if (OS_CFG_DBG_EN > 0u)
+    OSTmrListEntries--;
+#endif
+
+    next_new = OS_TmrWheelNext();
+    if (next_new != next) {                                     /* Reload the timer task's timeout if it changed        */
+        if (next_new == 0u) {                                   /* Did we remove the last timer from the wheel?         */
+            OSTmrTaskTickBase = time;
+        }
+        OS_TmrCondSignal();
+    }
+}
+
+#else
 void  OS_TmrUnlink (OS_TMR   *p_tmr,
                     OS_TICK   time)
 {
@@ -1334,6 +1429,7 @@ void  OS_TmrUnlink (OS_TMR   *p_tmr,
         p_tmr->Remain               =           0u;
     }
 }
+#endif
 
 
 /*
@@ -1354,9 +1450,90 @@ void  OS_TmrUnlink (OS_TMR   *p_tmr,
 *                 This method allows timer callbacks to Link/Unlink timers while maintaining the correct delta values.
 *
 *              3) Timer callbacks are allowed to make calls to the Timer APIs.
+*
+*              4) When the timer wheel is enabled, stage a) moves the timers which expired to the 'Expired' list of the
+*                 wheel, so the work done only depends on the number of timers that cascade or expire.
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+void  OS_TmrTask (void  *p_arg)
+{
+    OS_TMR_CALLBACK_PTR   p_fnct;
+    OS_TMR               *p_tmr;
+    OS_TICK               timeout;
+    OS_TICK               time;
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS                ts_start;
+#endif
+    CPU_SR_ALLOC();
+
+
+    (void)p_arg;                                                /* Not using 'p_arg', prevent compiler warning          */
+
+    OS_TmrLock();
+
+    for (;;) {
+        timeout = OS_TmrWheelNext();                            /* Wake up when the next spoke comes due                */
+
+        OS_TmrCondWait(timeout);                                /* Suspend the timer task until it needs to process ... */
+                                                                /* ... the timer wheel again. Also release the mutex... */
+                                                                /* ... so that application tasks can add/remove timers. */
+
+        if (OS_TmrWheelNext() == 0u) {                          /* Nothing to do if the wheel is empty.                 */
+            continue;
+        }
+
+#if (OS_CFG_TS_EN > 0u)
+        ts_start = OS_TS_GET();
+#endif
+
+        CPU_CRITICAL_ENTER();
+#if (OS_CFG_DYN_TICK_EN > 0u)
+        time                       = OSTickCtr + OS_DynTickGet();
+#else
+        time                       = OSTickCtr;
+#endif
+        CPU_CRITICAL_EXIT();
+
+        OS_TmrWheelAdvance(time - OSTmrTaskTickBase);           /* Collect expired timers, OSTmrTaskTickBase = time     */
+
+                                                                /* Process timers that have expired.                    */
+        p_tmr                      = OSTmrWheel.Expired.FirstPtr;
+
+        while (p_tmr != (OS_TMR *)0) {
+            p_tmr->State           = OS_TMR_STATE_TIMEOUT;
+                                                                /* Execute callback function if available               */
+            p_fnct                 = p_tmr->CallbackPtr;
+            if (p_fnct != (OS_TMR_CALLBACK_PTR)0u) {
+                (*p_fnct)(p_tmr, p_tmr->CallbackPtrArg);
+            }
+
+            if (p_tmr->State == OS_TMR_STATE_TIMEOUT) {
+                OS_TmrUnlink(p_tmr, OSTmrTaskTickBase);
+
+                if (p_tmr->Opt == OS_OPT_TMR_PERIODIC) {
+                    p_tmr->State   = OS_TMR_STATE_RUNNING;
+                    p_tmr->Remain  = p_tmr->Period;
+                    OS_TmrLink(p_tmr, OSTmrTaskTickBase);
+                } else {
+                    p_tmr->State   = OS_TMR_STATE_COMPLETED;
+                }
+            }
+
+            p_tmr                  = OSTmrWheel.Expired.FirstPtr;
+        }
+
+#if (OS_CFG_TS_EN > 0u)
+        OSTmrTaskTime = OS_TS_GET() - ts_start;                 /* Measure execution time of timer task                 */
+        if (OSTmrTaskTimeMax < OSTmrTaskTime) {
+            OSTmrTaskTimeMax       = OSTmrTaskTime;
+        }
+#endif
+    }
+}
+
+#else
 void  OS_TmrTask (void  *p_arg)
 {
     OS_TMR_CALLBACK_PTR   p_fnct;
@@ -1457,6 +1634,7 @@ void  OS_TmrTask (void  *p_arg)
 #endif
     }
 }
+#endif
 
 
 /*
@@ -1657,4 +1835,227 @@ static  void  OS_TmrCondSignal (void)
 
     CPU_CRITICAL_EXIT();
 }
+
+
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+/*
+************************************************************************************************************************
+*                                            LINK A TIMER IN THE TIMER WHEEL
+*
+* Description: This function links a timer in the timer wheel spoke matching its 'Match' value.  The level used is that
+*              of the most significant spoke digit in which the match value differs from OSTmrTaskTickBase.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to link.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrWheelLink (OS_TMR  *p_tmr)
+{
+    OS_TMR_SPOKE  *p_spoke;
+    OS_TICK        diff;
+    CPU_INT08U     lvl;
+
+
+    diff = (p_tmr->Match ^ OSTmrTaskTickBase) >> OS_TMR_WHEEL_SPOKE_BITS;
+    lvl  = 0u;
+    while (diff != 0u) {                                        /* Find the most significant digit which differs        */
+        diff >>= OS_TMR_WHEEL_SPOKE_BITS;
+        lvl++;
+    }
+
+    p_spoke         = &OSTmrWheel.Spokes[lvl][(p_tmr->Match >> (lvl * OS_TMR_WHEEL_SPOKE_BITS)) & OS_TMR_WHEEL_SPOKE_MASK];
+    p_tmr->SpokePtr =  p_spoke;
+    p_tmr->PrevPtr  = (OS_TMR *)0;                              /* Insert at the beginning of the spoke                 */
+    p_tmr->NextPtr  =  p_spoke->FirstPtr;
+    if (p_spoke->FirstPtr != (OS_TMR *)0) {
+        p_spoke->FirstPtr->PrevPtr = p_tmr;
+    }
+    p_spoke->FirstPtr = p_tmr;
+
+    OSTmrWheel.LvlNbrEntries[lvl]++;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          UNLINK A TIMER FROM THE TIMER WHEEL
+*
+* Description: This function unlinks a timer from the timer wheel spoke, or the list of expired timers, it is linked in.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to unlink.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrWheelUnlink (OS_TMR  *p_tmr)
+{
+    OS_TMR_SPOKE  *p_spoke;
+    OS_TMR        *p_tmr1;
+    OS_TMR        *p_tmr2;
+    CPU_INT08U     lvl;
+
+
+    p_spoke = p_tmr->SpokePtr;
+    p_tmr1  = p_tmr->PrevPtr;
+    p_tmr2  = p_tmr->NextPtr;
+    if (p_tmr1 == (OS_TMR *)0) {
+        p_spoke->FirstPtr = p_tmr2;
+    } else {
+        p_tmr1->NextPtr   = p_tmr2;
+    }
+    if (p_tmr2 != (OS_TMR *)0) {
+        p_tmr2->PrevPtr   = p_tmr1;
+    }
+    p_tmr->NextPtr  = (OS_TMR       *)0;
+    p_tmr->PrevPtr  = (OS_TMR       *)0;
+    p_tmr->SpokePtr = (OS_TMR_SPOKE *)0;
+
+    if (p_spoke != &OSTmrWheel.Expired) {
+        lvl = (CPU_INT08U)((CPU_ADDR)(p_spoke - &OSTmrWheel.Spokes[0u][0u]) / OS_TMR_WHEEL_SPOKE_QTY);
+        OSTmrWheel.LvlNbrEntries[lvl]--;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                         CASCADE A SPOKE TO THE LOWER LEVELS
+*
+* Description: This function re-links every timer of the current spoke of a level once the wheel time reaches it.
+*
+* Arguments  : lvl            Is the level of the spoke to cascade (1 or higher).
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrWheelCascade (CPU_INT08U  lvl)
+{
+    OS_TMR_SPOKE  *p_spoke;
+    OS_TMR        *p_tmr;
+
+
+    p_spoke = &OSTmrWheel.Spokes[lvl][(OSTmrTaskTickBase >> (lvl * OS_TMR_WHEEL_SPOKE_BITS)) & OS_TMR_WHEEL_SPOKE_MASK];
+    while (p_spoke->FirstPtr != (OS_TMR *)0) {
+        p_tmr = p_spoke->FirstPtr;
+        OS_TmrWheelUnlink(p_tmr);
+        OS_TmrWheelLink(p_tmr);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                                ADVANCE THE TIMER WHEEL
+*
+* Description: This function advances OSTmrTaskTickBase by 'ticks', cascading spokes as their boundary is reached and
+*              moving the timers which expire, in order, to the 'Expired' list of the wheel.
+*
+* Arguments  : ticks          Is the number of ticks which elapsed since OSTmrTaskTickBase.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The 'Expired' list is assumed to be empty when this function is called.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrWheelAdvance (OS_TICK  ticks)
+{
+    OS_TMR_SPOKE  *p_spoke;
+    OS_TMR        *p_tmr;
+    OS_TMR        *p_tail;
+    OS_TICK        step;
+    CPU_INT08U     lvl;
+
+
+    p_tail = (OS_TMR *)0;
+    while (ticks > 0u) {
+        step = OS_TmrWheelNext();                               /* Skip over spokes which are known to be empty         */
+        if ((step == 0u) || (step > ticks)) {
+            step = ticks;
+        }
+        OSTmrTaskTickBase += step;
+        ticks             -= step;
+
+        lvl = 1u;                                               /* Cascade higher levels reaching a spoke boundary      */
+        while ((lvl < OS_TMR_WHEEL_LVL_QTY) &&
+               ((OSTmrTaskTickBase & (((OS_TICK)1u << (lvl * OS_TMR_WHEEL_SPOKE_BITS)) - 1u)) == 0u)) {
+            OS_TmrWheelCascade(lvl);
+            lvl++;
+        }
+
+        p_spoke = &OSTmrWheel.Spokes[0u][OSTmrTaskTickBase & OS_TMR_WHEEL_SPOKE_MASK];
+        while (p_spoke->FirstPtr != (OS_TMR *)0) {              /* Append expired timers to the 'Expired' list          */
+            p_tmr = p_spoke->FirstPtr;
+            OS_TmrWheelUnlink(p_tmr);
+            p_tmr->SpokePtr = &OSTmrWheel.Expired;
+            p_tmr->PrevPtr  =  p_tail;
+            if (p_tail == (OS_TMR *)0) {
+                OSTmrWheel.Expired.FirstPtr = p_tmr;
+            } else {
+                p_tail->NextPtr             = p_tmr;
+            }
+            p_tail          =  p_tmr;
+        }
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                      NUMBER OF TICKS TO THE NEXT TIMER WHEEL EVENT
+*
+* Description: This function returns the number of ticks from OSTmrTaskTickBase until the next spoke holding timers
+*              comes due, at which point the spoke either expires (level 0) or cascades (higher levels).
+*
+* Arguments  : none
+*
+* Returns    : The number of ticks to the next event, or 0 if the timer wheel is empty.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Timers of a level always come due before the next spoke boundary of the level above it, so only the
+*                 lowest level holding timers needs to be searched.
+************************************************************************************************************************
+*/
+
+static  OS_TICK  OS_TmrWheelNext (void)
+{
+    OS_TICK     ix;
+    OS_TICK     dist;
+    CPU_INT08U  lvl;
+    CPU_INT08U  shift;
+
+
+    lvl = 0u;
+    while ((lvl                           < OS_TMR_WHEEL_LVL_QTY) &&
+           (OSTmrWheel.LvlNbrEntries[lvl] == 0u)) {
+        lvl++;
+    }
+    if (lvl == OS_TMR_WHEEL_LVL_QTY) {                          /* Is the wheel empty?                                  */
+        return (0u);
+    }
+
+    shift = lvl * OS_TMR_WHEEL_SPOKE_BITS;
+    ix    = (OSTmrTaskTickBase >> shift) & OS_TMR_WHEEL_SPOKE_MASK;
+    dist  = 1u;
+    while ((dist < OS_TMR_WHEEL_SPOKE_QTY) &&                   /* Find the first spoke in use past the current one     */
+           (OSTmrWheel.Spokes[lvl][(ix + dist) & OS_TMR_WHEEL_SPOKE_MASK].FirstPtr == (OS_TMR *)0)) {
+        dist++;
+    }
+
+    return ((dist << shift) - (OSTmrTaskTickBase & (((OS_TICK)1u << shift) - 1u)));
+}
+#endif
 #endif
@@ -38,6 +38,8 @@ const     CPU_CHAR  *os_type__h = "$Id: $";
                                                        /*                                               <recommended> */
                                                        /* ----------------------------------------------------------- */
 
+typedef   CPU_INT08U      OS_CORE_ID;                  /* Core identifier (SMP),                            <8>/16/32 */
+
 typedef   CPU_INT16U      OS_CPU_USAGE;                /* CPU Usage 0..10000                                  <16>/32 */
 
 typedef   CPU_INT32U      OS_CTR;                      /* Counter,                                                 32 */